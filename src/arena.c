@@ -0,0 +1,77 @@
+/**
+ * @file arena.c
+ * @brief एक simulation instance की सारी memory एक block में रखने वाले arena का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Block malloc से आता है (C99 में aligned_alloc नहीं है), इसलिए Arena
+ * struct के बाद ARENA_ALIGN - 1 bytes ज्यादा लिए जाते हैं और base उनमें
+ * से पहले aligned address पर रखा जाता है।
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+
+/**
+ * @brief capacity bytes का नया arena बनाता है (एक heap allocation)
+ *
+ * Capacity के लिए ARENA_SIZE से हर allocation का size जोड़ें।
+ *
+ * @param capacity allocations के लिए bytes
+ * @return सफल होने पर Arena pointer, memory allocation fail होने पर NULL
+ */
+Arena *arena_init(size_t capacity) {
+    capacity = ARENA_SIZE(capacity);
+    if (capacity > SIZE_MAX - sizeof(Arena) - ARENA_ALIGN) return NULL;
+
+    Arena *arena = malloc(sizeof(Arena) + ARENA_ALIGN - 1 + capacity);
+    if (arena == NULL) return NULL;
+
+    uintptr_t start = (uintptr_t)(arena + 1);
+    arena->base = (char *)arena + ((start + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN - (uintptr_t)arena);
+    arena->capacity = capacity;
+    arena->used = 0;
+    return arena;
+}
+
+/**
+ * @brief arena से zeroed, ARENA_ALIGN पर aligned memory देता है
+ *
+ * Memory यहीं zero होती है (init पर नहीं), ताकि बड़े arenas के pages
+ * तभी touch हों जब वो सच में इस्तेमाल हों।
+ *
+ * @param arena source arena
+ * @param size bytes (0 भी valid है, पर तब भी एक unique pointer मिलता है)
+ * @return सफल होने पर pointer, NULL arena या capacity खत्म होने पर NULL
+ */
+void *arena_alloc(Arena *arena, size_t size) {
+    if (arena == NULL) return NULL;
+
+    size_t rounded = ARENA_SIZE(size > 0 ? size : 1);
+    if (rounded < size || rounded > arena->capacity - arena->used) return NULL;
+
+    char *memory = arena->base + arena->used;
+    arena->used += rounded;
+    memset(memory, 0, size);
+    return memory;
+}
+
+/**
+ * @brief arena के अभी तक दिए गए bytes
+ * @param arena arena
+ * @return used bytes (NULL होने पर 0)
+ */
+size_t arena_used(const Arena *arena) {
+    return arena != NULL ? arena->used : 0;
+}
+
+/**
+ * @brief arena और उससे मिली सारी memory एक साथ free करता है
+ * @param arena free करने वाला arena (NULL हो सकता है)
+ */
+void arena_free(Arena *arena) {
+    free(arena);
+}
@@ -0,0 +1,71 @@
+/**
+ * @file arena.h
+ * @brief एक simulation instance की सारी memory एक block में रखने वाले arena का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Arena एक ही heap allocation है जिसमें से allocations सिर्फ आगे बढ़ते
+ * pointer (bump) से मिलती हैं; अलग-अलग free नहीं होता। Instance के setup
+ * में boards, rules और scratch buffers arena से आते हैं, इसलिए stepping के
+ * दौरान कोई heap allocation नहीं होता और teardown एक arena_free है।
+ *
+ * हर allocation ARENA_ALIGN (cache line) पर aligned है, इसलिए अलग workers
+ * के buffers कभी एक cache line share नहीं करते (false sharing नहीं)।
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+/**
+ * @brief हर arena allocation का alignment (bytes, cache line)
+ */
+#define ARENA_ALIGN 64
+
+/**
+ * @brief bytes को ARENA_ALIGN तक round up करता है (arena में असल में लगने वाली जगह)
+ */
+#define ARENA_SIZE(bytes) (((bytes) + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN)
+
+/**
+ * @brief Bump allocator का state (खुद भी arena के block में रहता है)
+ */
+typedef struct Arena {
+    char *base;             /**< पहली allocation (ARENA_ALIGN पर aligned) */
+    size_t capacity;        /**< base से usable bytes */
+    size_t used;            /**< अभी तक दिए गए bytes */
+} Arena;
+
+/**
+ * @brief capacity bytes का नया arena बनाता है (एक heap allocation)
+ *
+ * Capacity के लिए ARENA_SIZE से हर allocation का size जोड़ें।
+ *
+ * @param capacity allocations के लिए bytes
+ * @return सफल होने पर Arena pointer, memory allocation fail होने पर NULL
+ */
+Arena *arena_init(size_t capacity);
+
+/**
+ * @brief arena से zeroed, ARENA_ALIGN पर aligned memory देता है
+ * @param arena source arena
+ * @param size bytes (0 भी valid है, पर तब भी एक unique pointer मिलता है)
+ * @return सफल होने पर pointer, NULL arena या capacity खत्म होने पर NULL
+ */
+void *arena_alloc(Arena *arena, size_t size);
+
+/**
+ * @brief arena के अभी तक दिए गए bytes
+ * @param arena arena
+ * @return used bytes (NULL होने पर 0)
+ */
+size_t arena_used(const Arena *arena);
+
+/**
+ * @brief arena और उससे मिली सारी memory एक साथ free करता है
+ * @param arena free करने वाला arena (NULL हो सकता है)
+ */
+void arena_free(Arena *arena);
+
+#endif // ARENA_H
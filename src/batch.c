@@ -0,0 +1,283 @@
+/**
+ * @file batch.c
+ * @brief एक process में कई independent boards चलाने वाले batch runner का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * हर worker का deque jobs के indices की एक range [head, tail) है, जो एक
+ * uint64_t में packed है (low 32 bits head, high 32 bits tail)। Owner
+ * head से लेता है और thieves tail से; दोनों एक ही word पर compare-exchange
+ * करते हैं, इसलिए कोई lock नहीं है और हर job ठीक एक बार चलता है। Jobs
+ * बाद में नहीं जुड़ते, इसलिए सभी deques खाली दिखते ही worker खत्म हो
+ * जाता है।
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arena.h"
+#include "batch.h"
+#include "cycle.h"
+#include "simd.h"
+
+/**
+ * @brief एक worker का jobs deque (अपनी cache line में, ताकि false sharing न हो)
+ */
+typedef struct BatchQueue {
+    uint64_t range;                         /**< Low 32 bits: head, high 32 bits: tail (atomic) */
+    char padding[64 - sizeof(uint64_t)];    /**< Cache line की बाकी जगह */
+} BatchQueue;
+
+/**
+ * @brief एक worker के reuse होने वाले buffers
+ */
+typedef struct BatchWorker {
+    Board *front;               /**< Current generation */
+    Board *back;                /**< Next generation का buffer */
+    CycleDetector *cycles;      /**< Stabilization detector (window 0 पर NULL) */
+    Rules *rules;               /**< Current job के rules की worker-local copy */
+    const Rules *source;        /**< rules किस job के Rules की copy है */
+} BatchWorker;
+
+/**
+ * @brief pool_run के workers के लिए shared arguments
+ */
+typedef struct BatchTask {
+    const BatchConfig *config;
+    const BatchJob *jobs;
+    BatchResult *results;
+    BatchQueue *queues;         /**< हर worker का deque */
+    BatchWorker **workers;      /**< हर worker के buffers (हर एक अपनी cache lines में) */
+    int num_workers;            /**< Deques की संख्या */
+    int failed;                 /**< किसी job में error (atomic) */
+} BatchTask;
+
+/**
+ * @brief head और tail को deque के word में pack करता है
+ * @param head पहला बचा job
+ * @param tail आखिरी बचे job के बाद का index
+ * @return packed range
+ */
+static uint64_t batch_pack(uint32_t head, uint32_t tail) {
+    return ((uint64_t)tail << 32) | head;
+}
+
+/**
+ * @brief अपने deque के आगे से एक job लेता है
+ * @param queue worker का अपना deque
+ * @param job job index store करने के लिए pointer
+ * @return job मिला तो 1, deque खाली हो तो 0
+ */
+static int batch_take(BatchQueue *queue, size_t *job) {
+    uint64_t range = __atomic_load_n(&queue->range, __ATOMIC_ACQUIRE);
+    for (;;) {
+        uint32_t head = (uint32_t)range, tail = (uint32_t)(range >> 32);
+        if (head >= tail) return 0;
+        if (__atomic_compare_exchange_n(&queue->range, &range, batch_pack(head + 1, tail), 1,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            *job = head;
+            return 1;
+        }
+    }
+}
+
+/**
+ * @brief दूसरे worker के deque के पीछे से एक job चुराता है
+ * @param queue victim का deque
+ * @param job job index store करने के लिए pointer
+ * @return job मिला तो 1, deque खाली हो तो 0
+ */
+static int batch_steal(BatchQueue *queue, size_t *job) {
+    uint64_t range = __atomic_load_n(&queue->range, __ATOMIC_ACQUIRE);
+    for (;;) {
+        uint32_t head = (uint32_t)range, tail = (uint32_t)(range >> 32);
+        if (head >= tail) return 0;
+        if (__atomic_compare_exchange_n(&queue->range, &range, batch_pack(head, tail - 1), 1,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            *job = tail - 1;
+            return 1;
+        }
+    }
+}
+
+/**
+ * @brief एक job चलाता है
+ * @param config common settings
+ * @param job चलाने वाला job
+ * @param worker worker के buffers
+ * @param result result store करने के लिए pointer
+ * @return सफल होने पर 0, stepping error पर -1
+ */
+static int batch_run_job(const BatchConfig *config, const BatchJob *job, BatchWorker *worker,
+                         BatchResult *result) {
+    BoardStats stats;
+    uint64_t start, period;
+
+    result->generations = 0;
+    result->stable_generation = 0;
+    result->period = 0;
+    result->stable = 0;
+
+    // Shared Rules की जगह worker की अपनी copy पढ़ी जाती है (jobs अक्सर rules share करते हैं)
+    if (worker->source != job->rules) {
+        *worker->rules = *job->rules;
+        worker->source = job->rules;
+    }
+
+    if (board_random_fill(worker->front, job->seed, config->density, NULL) != 0) return -1;
+    if (worker->cycles != NULL) {
+        cycle_detector_reset(worker->cycles);
+        cycle_detector_push(worker->cycles, board_hash(worker->front), 0, NULL, NULL);
+    }
+
+    for (long g = 0; g < config->generations; g++) {
+        if (board_next(worker->front, worker->back, worker->rules) != 0) return -1;
+        Board *temp = worker->front;
+        worker->front = worker->back;
+        worker->back = temp;
+        result->generations = (uint64_t)g + 1;
+
+        if (worker->cycles != NULL &&
+            cycle_detector_push(worker->cycles, board_hash(worker->front), (uint64_t)g + 1, &start, &period) == 1) {
+            result->stable = 1;
+            result->stable_generation = start;
+            result->period = period;
+            break;
+        }
+    }
+
+    board_stats(worker->front, &stats);
+    result->population = stats.population;
+    return 0;
+}
+
+/**
+ * @brief worker पहले अपने deque के jobs चलाता है, फिर दूसरों के चुराता है
+ * @param arg BatchTask pointer
+ * @param worker_index worker का index (अपना deque)
+ * @param num_workers कुल workers (unused, task में है)
+ */
+static void batch_task(void *arg, int worker_index, int num_workers) {
+    (void)num_workers;
+    BatchTask *task = arg;
+    BatchWorker *worker = task->workers[worker_index];
+    size_t job;
+
+    for (;;) {
+        int found = batch_take(&task->queues[worker_index], &job);
+        for (int i = 1; !found && i < task->num_workers; i++) {
+            found = batch_steal(&task->queues[(worker_index + i) % task->num_workers], &job);
+        }
+        if (!found) break;
+
+        if (batch_run_job(task->config, &task->jobs[job], worker, &task->results[job]) != 0) {
+            __atomic_store_n(&task->failed, 1, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+/**
+ * @brief batch_run के arena की capacity निकालता है
+ * @param config common settings
+ * @param num_workers workers की संख्या
+ * @return arena के bytes
+ */
+static size_t batch_arena_size(const BatchConfig *config, int num_workers) {
+    size_t worker = ARENA_SIZE(sizeof(BatchWorker)) + ARENA_SIZE(sizeof(Rules)) +
+                    2 * board_arena_size(config->height, config->width);
+    if (config->cycle_window > 0) worker += cycle_detector_arena_size(config->cycle_window);
+    return ARENA_SIZE((size_t)num_workers * sizeof(BatchQueue)) +
+           ARENA_SIZE((size_t)num_workers * sizeof(BatchWorker *)) + (size_t)num_workers * worker;
+}
+
+/**
+ * @brief jobs को pool के workers पर work stealing से चलाता है
+ *
+ * Jobs पहले workers में बराबर contiguous ranges में बांटे जाते हैं; इसके
+ * बाद balance stealing से होता है। Deques, workers के boards, rules की
+ * copies और cycle detectors सब एक arena में हैं: jobs चलते समय कोई
+ * allocation नहीं होता और अंत में एक free।
+ *
+ * @param config common settings
+ * @param jobs jobs का array
+ * @param count jobs की संख्या
+ * @param results count results का array (jobs के क्रम में भरता है)
+ * @param pool workers का pool (NULL = calling thread पर)
+ * @return सफल होने पर 0, invalid arguments, memory या stepping error पर -1
+ */
+int batch_run(const BatchConfig *config, const BatchJob *jobs, size_t count,
+              BatchResult *results, ThreadPool *pool) {
+    if (config == NULL || jobs == NULL || results == NULL) return -1;
+    if (config->height == 0 || config->width == 0 || config->generations < 0) return -1;
+    if (!(config->density >= 0.0 && config->density <= 1.0)) return -1;
+    if (count > UINT32_MAX) return -1;
+    for (size_t i = 0; i < count; i++) {
+        // Population byte sums से आती है, इसलिए सिर्फ two-state rules
+        if (jobs[i].rules == NULL || jobs[i].rules->kernel == RULES_KERNEL_GENERATIONS) return -1;
+    }
+
+    int num_workers = pool != NULL ? pool_size(pool) : 1;
+    Arena *arena = arena_init(batch_arena_size(config, num_workers));
+    if (arena == NULL) return -1;
+
+    int status = -1;
+    BatchQueue *queues = arena_alloc(arena, (size_t)num_workers * sizeof(BatchQueue));
+    BatchWorker **workers = arena_alloc(arena, (size_t)num_workers * sizeof(BatchWorker *));
+    if (queues == NULL || workers == NULL) goto cleanup;
+    for (int w = 0; w < num_workers; w++) {
+        BatchWorker *worker = workers[w] = arena_alloc(arena, sizeof(BatchWorker));
+        if (worker == NULL) goto cleanup;
+        worker->rules = arena_alloc(arena, sizeof(Rules));
+        worker->front = board_init_arena(arena, config->height, config->width, config->edge);
+        worker->back = board_init_arena(arena, config->height, config->width, config->edge);
+        if (worker->rules == NULL || worker->front == NULL || worker->back == NULL) goto cleanup;
+        if (config->cycle_window > 0) {
+            worker->cycles = cycle_detector_init_arena(arena, config->cycle_window);
+            if (worker->cycles == NULL) goto cleanup;
+        }
+
+        size_t begin = count * (size_t)w / (size_t)num_workers;
+        size_t end = count * (size_t)(w + 1) / (size_t)num_workers;
+        queues[w].range = batch_pack((uint32_t)begin, (uint32_t)end);
+    }
+
+    // Kernel detection workers शुरू होने से पहले
+    simd_row_kernel();
+
+    BatchTask task = { config, jobs, results, queues, workers, num_workers, 0 };
+    if (num_workers <= 1) {
+        batch_task(&task, 0, 1);
+    } else if (pool_run(pool, batch_task, &task) != 0) {
+        goto cleanup;
+    }
+    status = task.failed ? -1 : 0;
+
+cleanup:
+    arena_free(arena);
+    return status;
+}
+
+/**
+ * @brief results को CSV file में लिखता है (एक line प्रति job)
+ * @param filename output file
+ * @param jobs jobs का array
+ * @param results results का array
+ * @param count jobs की संख्या
+ * @return सफल होने पर 0, file error होने पर -1
+ */
+int batch_write_csv(const char *filename, const BatchJob *jobs, const BatchResult *results, size_t count) {
+    if (filename == NULL || jobs == NULL || results == NULL) return -1;
+
+    FILE *file = fopen(filename, "w");
+    if (file == NULL) return -1;
+
+    fprintf(file, "job,rule,seed,generations,population,stable,stable_generation,period\n");
+    for (size_t i = 0; i < count; i++) {
+        const BatchResult *result = &results[i];
+        fprintf(file, "%zu,\"%s\",%llu,%llu,%llu,%d,%llu,%llu\n", i, jobs[i].rules->name,
+                (unsigned long long)jobs[i].seed, (unsigned long long)result->generations,
+                (unsigned long long)result->population, result->stable,
+                (unsigned long long)result->stable_generation, (unsigned long long)result->period);
+    }
+    return fclose(file) == 0 ? 0 : -1;
+}
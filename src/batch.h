@@ -0,0 +1,87 @@
+/**
+ * @file batch.h
+ * @brief एक process में कई independent boards चलाने वाले batch runner का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Rule exploration के लिए हजारों छोटे boards (अलग rules और random seeds)
+ * एक साथ चलते हैं। हर board single-threaded step होता है और parallelism
+ * boards के बीच है: हर worker का अपना jobs का deque है, और अपना deque
+ * खाली होने पर worker दूसरों के deque के पीछे से job चुरा लेता है (work
+ * stealing), ताकि जल्दी stable होने वाले boards से workers idle न रहें।
+ *
+ * हर worker boards की एक front/back pair और एक cycle detector एक बार
+ * बनाता है और सभी jobs में reuse करता है। पूरे batch की यह memory एक
+ * arena (देखें arena.h) में है, इसलिए jobs की संख्या से allocations नहीं
+ * बढ़तीं और stepping में कोई allocation नहीं होता।
+ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "board.h"
+#include "pool.h"
+#include "rules.h"
+
+/**
+ * @brief Batch के सभी boards के common settings
+ */
+typedef struct BatchConfig {
+    size_t height;          /**< हर board की ऊंचाई */
+    size_t width;           /**< हर board की चौड़ाई */
+    BoardEdge edge;         /**< बोर्ड के किनारे */
+    long generations;       /**< ज्यादा से ज्यादा generations प्रति board */
+    size_t cycle_window;    /**< Stabilization detection की window (0 = detection नहीं) */
+    double density;         /**< Random initial boards में जीवित cells का fraction */
+} BatchConfig;
+
+/**
+ * @brief एक board का job
+ */
+typedef struct BatchJob {
+    Rules *rules;           /**< Rules (jobs के बीच shared हो सकते हैं, बदले नहीं जाते) */
+    uint64_t seed;          /**< Random initial board का seed */
+} BatchJob;
+
+/**
+ * @brief एक board का result
+ */
+typedef struct BatchResult {
+    uint64_t generations;       /**< कितनी generations चलीं (stable होने पर कम) */
+    uint64_t population;        /**< आखिरी generation के जीवित cells */
+    uint64_t stable_generation; /**< Cycle की पहली generation (stable न हो तो 0) */
+    uint64_t period;            /**< Cycle का period (stable न हो तो 0; 1 = still life) */
+    int stable;                 /**< Window के अंदर cycle मिला तो 1 */
+} BatchResult;
+
+/**
+ * @brief jobs को pool के workers पर work stealing से चलाता है
+ *
+ * हर job का initial board उसके seed और config->density से
+ * board_random_fill बनाता है, इसलिए same seed हमेशा same board देता है,
+ * चाहे job कोई भी worker चलाए।
+ *
+ * @param config common settings
+ * @param jobs jobs का array
+ * @param count jobs की संख्या
+ * @param results count results का array (jobs के क्रम में भरता है)
+ * @param pool workers का pool (NULL = calling thread पर)
+ * @return सफल होने पर 0, invalid arguments (Generations rules, गलत density भी), memory या stepping error पर -1
+ */
+int batch_run(const BatchConfig *config, const BatchJob *jobs, size_t count,
+              BatchResult *results, ThreadPool *pool);
+
+/**
+ * @brief results को CSV file में लिखता है (एक line प्रति job)
+ * @param filename output file
+ * @param jobs jobs का array
+ * @param results results का array
+ * @param count jobs की संख्या
+ * @return सफल होने पर 0, file error होने पर -1
+ */
+int batch_write_csv(const char *filename, const BatchJob *jobs, const BatchResult *results, size_t count);
+
+#endif // BATCH_H
@@ -0,0 +1,561 @@
+/**
+ * @file bench.c
+ * @brief Stepping engines का benchmark harness (gameoflife-bench)
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * हर engine को दिए गए pattern files और अलग-अलग sizes/densities के random
+ * boards पर चलाता है। हर case में पहले warmup होता है, जिससे per-trial
+ * generations तय होती हैं (लगभग BENCH_TRIAL_SECONDS का trial), फिर कई
+ * trials हर बार same initial board से चलते हैं। Results stdout पर CSV
+ * में आते हैं (एक line प्रति engine/case), progress stderr पर।
+ *
+ * यह binary SDL के बिना link होता है।
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "board.h"
+#include "gpu_board.h"
+#include "hashlife.h"
+#include "packed_board.h"
+#include "pattern.h"
+#include "pool.h"
+#include "profile.h"
+#include "rules.h"
+#include "sparse_board.h"
+
+/**
+ * @brief Warmup कम से कम इतने seconds चलता है
+ */
+#define BENCH_WARMUP_SECONDS 0.1
+
+/**
+ * @brief एक trial का target time (seconds)
+ */
+#define BENCH_TRIAL_SECONDS 0.25
+
+/**
+ * @brief एक trial की maximum generations
+ *
+ * Hashlife stable patterns पर हर doubling को लगभग constant time में कर
+ * लेता है; limit के बिना calibration उसे HASHLIFE_MAX_LEVEL तक ले जाता।
+ */
+#define BENCH_MAX_GENERATIONS (1L << 22)
+
+/**
+ * @brief Default trials प्रति case
+ */
+#define BENCH_DEFAULT_TRIALS 5
+
+/**
+ * @brief Maximum trials प्रति case
+ */
+#define BENCH_MAX_TRIALS 100
+
+/**
+ * @brief List options (--sizes, --densities, --engines) की maximum entries
+ */
+#define BENCH_MAX_LIST 16
+
+/**
+ * @brief Random boards का fixed seed (runs के बीच same boards)
+ */
+#define BENCH_SEED 12345ULL
+
+/**
+ * @brief Benchmark होने वाले engines
+ */
+typedef enum BenchEngine {
+    BENCH_BOARD = 0,    /**< board_next (single thread) */
+    BENCH_PARALLEL,     /**< board_next_parallel (worker pool) */
+    BENCH_BLOCKED,      /**< board_step_n_parallel (worker pool) */
+    BENCH_PACKED,       /**< packed_board_next_parallel */
+    BENCH_HASHLIFE,     /**< hashlife_step (unbounded plane) */
+    BENCH_SPARSE,       /**< sparse_board_next (unbounded plane) */
+    BENCH_GPU,          /**< gpu_board_next (GPU=1 builds) */
+    BENCH_ENGINE_COUNT
+} BenchEngine;
+
+/**
+ * @brief Engines के नाम (CSV और --engines में)
+ */
+static const char *engine_names[BENCH_ENGINE_COUNT] = {"board", "parallel", "blocked", "packed", "hashlife", "sparse", "gpu"};
+
+/**
+ * @brief Benchmark के options
+ */
+typedef struct BenchOptions {
+    int engines[BENCH_ENGINE_COUNT];    /**< कौन से engines चलाने हैं */
+    long sizes[BENCH_MAX_LIST];         /**< Random boards की sides */
+    int size_count;                     /**< sizes में entries */
+    double densities[BENCH_MAX_LIST];   /**< Random boards की densities */
+    int density_count;                  /**< densities में entries */
+    int trials;                         /**< Trials प्रति case */
+    long generations;                   /**< Trial की generations (0 = warmup से calibrate) */
+    int threads;                        /**< Worker threads (0 = सभी cores) */
+    const char *rule_name;              /**< Rule set (NULL = Conway) */
+} BenchOptions;
+
+/**
+ * @brief एक engine का state, एक benchmark case के लिए
+ */
+typedef struct BenchRun {
+    BenchEngine engine;         /**< Engine */
+    const Board *initial;       /**< हर trial का initial board */
+    Rules *rules;               /**< Rules */
+    ThreadPool *pool;           /**< Worker pool */
+    Board *front;               /**< Board engines की current generation */
+    Board *back;                /**< Board engines का scratch board */
+    PackedBoard *packed_front;  /**< Packed engine की current generation */
+    PackedBoard *packed_back;   /**< Packed engine का scratch board */
+    HashLife *life;             /**< Hashlife universe */
+    SparseBoard *sparse;        /**< Sparse engine का plane */
+    GpuBoard *gpu;              /**< GPU engine के device buffers */
+} BenchRun;
+
+/**
+ * @brief एक बोर्ड की cells दूसरे (same size के) बोर्ड में copy करता है
+ * @param dst target बोर्ड
+ * @param src source बोर्ड
+ */
+static void bench_copy(Board *dst, const Board *src) {
+    for (size_t x = 0; x < src->height; x++) {
+        memcpy(&dst->cells[BOARD_INDEX(dst, x, 0)], &src->cells[BOARD_INDEX(src, x, 0)], src->width);
+    }
+    board_mark_all_dirty(dst);
+}
+
+/**
+ * @brief engine को initial board पर reset करता है (timing के बाहर)
+ * @param run engine state
+ * @return सफल होने पर 0, error होने पर -1
+ */
+static int bench_reset(BenchRun *run) {
+    switch (run->engine) {
+        case BENCH_PACKED:
+            return packed_board_from_board(run->packed_front, run->initial);
+        case BENCH_HASHLIFE:
+            // नया universe, ताकि पिछले trial के memoized results न मिलें
+            if (run->life != NULL) hashlife_free(run->life);
+            run->life = hashlife_init(run->rules, 0);
+            if (run->life == NULL) return -1;
+            return hashlife_from_board(run->life, run->initial);
+        case BENCH_SPARSE:
+            if (sparse_board_clear(run->sparse) != 0) return -1;
+            return sparse_board_from_board(run->sparse, run->initial, 0, 0);
+        case BENCH_GPU:
+            return gpu_board_from_board(run->gpu, run->initial);
+        default:
+            bench_copy(run->front, run->initial);
+            return 0;
+    }
+}
+
+/**
+ * @brief engine को generations आगे बढ़ाता है
+ * @param run engine state
+ * @param generations कितनी generations
+ * @return सफल होने पर 0, error होने पर -1
+ */
+static int bench_step(BenchRun *run, long generations) {
+    if (run->engine == BENCH_HASHLIFE) {
+        return hashlife_step(run->life, (uint64_t)generations);
+    }
+    if (run->engine == BENCH_GPU) {
+        // Dispatches async हैं; gpu_board_next GPU के पूरा करने पर लौटता है
+        return gpu_board_next(run->gpu, run->rules, generations);
+    }
+    if (run->engine == BENCH_BLOCKED) {
+        return board_step_n_parallel(run->front, run->rules, generations, run->pool);
+    }
+
+    for (long g = 0; g < generations; g++) {
+        int status;
+        if (run->engine == BENCH_SPARSE) {
+            status = sparse_board_next(run->sparse, run->rules);
+        } else if (run->engine == BENCH_PACKED) {
+            status = packed_board_next_parallel(run->packed_front, run->packed_back, run->rules, run->pool);
+            PackedBoard *temp = run->packed_front;
+            run->packed_front = run->packed_back;
+            run->packed_back = temp;
+        } else {
+            status = run->engine == BENCH_BOARD
+                ? board_next(run->front, run->back, run->rules)
+                : board_next_parallel(run->front, run->back, run->rules, run->pool);
+            Board *temp = run->front;
+            run->front = run->back;
+            run->back = temp;
+        }
+        if (status != 0) return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief engine state की memory free करता है
+ * @param run engine state
+ */
+static void bench_run_free(BenchRun *run) {
+    if (run->front != NULL) board_free(run->front);
+    if (run->back != NULL) board_free(run->back);
+    if (run->packed_front != NULL) packed_board_free(run->packed_front);
+    if (run->packed_back != NULL) packed_board_free(run->packed_back);
+    if (run->life != NULL) hashlife_free(run->life);
+    if (run->sparse != NULL) sparse_board_free(run->sparse);
+    if (run->gpu != NULL) gpu_board_free(run->gpu);
+}
+
+/**
+ * @brief qsort के लिए doubles की तुलना
+ * @param a पहली value
+ * @param b दूसरी value
+ * @return a < b तो negative, बराबर तो 0, वरना positive
+ */
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief एक engine को एक case पर benchmark करके CSV line print करता है
+ *
+ * Warmup में generations दोगुनी होती रहती हैं जब तक BENCH_WARMUP_SECONDS
+ * पूरे न हों; उसी rate से trial की generations तय होती हैं।
+ *
+ * @param opts benchmark options
+ * @param engine engine
+ * @param pattern case का नाम (file या "random")
+ * @param density random board की density (pattern file के लिए negative)
+ * @param initial initial board
+ * @param rules rules
+ * @param pool worker pool
+ * @return सफल होने पर 0, error होने पर -1
+ */
+static int bench_case(const BenchOptions *opts, BenchEngine engine, const char *pattern, double density,
+                      const Board *initial, Rules *rules, ThreadPool *pool) {
+    BenchRun run = {engine, initial, rules, pool, NULL, NULL, NULL, NULL, NULL, NULL, NULL};
+    double rates[BENCH_MAX_TRIALS];
+    int status = -1;
+
+    if (engine == BENCH_PACKED) {
+        run.packed_front = packed_board_init(initial->height, initial->width);
+        run.packed_back = packed_board_init(initial->height, initial->width);
+        if (run.packed_front == NULL || run.packed_back == NULL) goto cleanup;
+    } else if (engine == BENCH_SPARSE) {
+        run.sparse = sparse_board_init();
+        if (run.sparse == NULL) goto cleanup;
+    } else if (engine == BENCH_GPU) {
+        run.gpu = gpu_board_init(initial->height, initial->width);
+        if (run.gpu == NULL) goto cleanup;
+    } else if (engine != BENCH_HASHLIFE) {
+        run.front = board_init_padded(initial->height, initial->width, initial->edge);
+        run.back = board_init_padded(initial->height, initial->width, initial->edge);
+        if (run.front == NULL || run.back == NULL) goto cleanup;
+    }
+
+    // Warmup + calibration
+    long generations = 1;
+    double elapsed = 0;
+    double warmup_start = now_seconds();
+    while (now_seconds() - warmup_start < BENCH_WARMUP_SECONDS) {
+        if (bench_reset(&run) != 0) goto cleanup;
+        double start = now_seconds();
+        if (bench_step(&run, generations) != 0) goto cleanup;
+        elapsed = now_seconds() - start;
+        if (elapsed < BENCH_WARMUP_SECONDS / 4 && generations < BENCH_MAX_GENERATIONS) generations *= 2;
+    }
+    if (opts->generations > 0) {
+        generations = opts->generations;
+    } else if (elapsed > 0) {
+        double per_trial = (double)generations * BENCH_TRIAL_SECONDS / elapsed;
+        generations = per_trial < 1 ? 1 : per_trial > BENCH_MAX_GENERATIONS ? BENCH_MAX_GENERATIONS : (long)per_trial;
+    }
+
+    for (int t = 0; t < opts->trials; t++) {
+        if (bench_reset(&run) != 0) goto cleanup;
+        double start = now_seconds();
+        if (bench_step(&run, generations) != 0) goto cleanup;
+        double seconds = now_seconds() - start;
+        rates[t] = seconds > 0 ? (double)generations / seconds : 0;
+    }
+
+    qsort(rates, (size_t)opts->trials, sizeof(double), compare_double);
+    double median = opts->trials % 2
+        ? rates[opts->trials / 2]
+        : (rates[opts->trials / 2 - 1] + rates[opts->trials / 2]) / 2;
+    double best = rates[opts->trials - 1];
+    double cells = (double)initial->height * (double)initial->width;
+    int threads = engine == BENCH_PARALLEL || engine == BENCH_BLOCKED || engine == BENCH_PACKED ? pool_size(pool) : 1;
+
+    if (density < 0) {
+        printf("%s,%s,%zu,%zu,,%d,%ld,%d,%.3f,%.3f,%.6e,%.4f\n", engine_names[engine], pattern,
+               initial->height, initial->width, threads, generations, opts->trials,
+               median, best, median * cells, median > 0 ? 1e9 / (median * cells) : 0);
+    } else {
+        printf("%s,%s,%zu,%zu,%.3f,%d,%ld,%d,%.3f,%.3f,%.6e,%.4f\n", engine_names[engine], pattern,
+               initial->height, initial->width, density, threads, generations, opts->trials,
+               median, best, median * cells, median > 0 ? 1e9 / (median * cells) : 0);
+    }
+    fflush(stdout);
+    status = 0;
+
+cleanup:
+    bench_run_free(&run);
+    return status;
+}
+
+/**
+ * @brief सभी चुने गए engines एक case पर चलाता है
+ * @param opts benchmark options
+ * @param pattern case का नाम
+ * @param density random board की density (pattern file के लिए negative)
+ * @param initial initial board
+ * @param rules rules
+ * @param pool worker pool
+ * @return सभी सफल होने पर 0, कोई fail होने पर -1
+ */
+static int bench_all_engines(const BenchOptions *opts, const char *pattern, double density,
+                             const Board *initial, Rules *rules, ThreadPool *pool) {
+    int status = 0;
+
+    for (int e = 0; e < BENCH_ENGINE_COUNT; e++) {
+        if (!opts->engines[e]) continue;
+        fprintf(stderr, "%s: %s %zux%zu\n", engine_names[e], pattern, initial->height, initial->width);
+        if (bench_case(opts, (BenchEngine)e, pattern, density, initial, rules, pool) != 0) {
+            fprintf(stderr, "Error benchmarking %s on %s\n", engine_names[e], pattern);
+            status = -1;
+        }
+    }
+    return status;
+}
+
+/**
+ * @brief comma-separated numbers की list parse करता है
+ * @param text list string (जैसे "256,1024")
+ * @param values parsed values
+ * @param count parsed entries store करने के लिए pointer
+ * @return सफल होने पर 0, invalid list होने पर -1
+ */
+static int parse_list(const char *text, double *values, int *count) {
+    *count = 0;
+    while (*text) {
+        char *end = NULL;
+        double value = strtod(text, &end);
+        if (end == text || value < 0 || *count >= BENCH_MAX_LIST) return -1;
+        values[(*count)++] = value;
+        if (*end == ',') end++;
+        else if (*end != '\0') return -1;
+        text = end;
+    }
+    return *count > 0 ? 0 : -1;
+}
+
+/**
+ * @brief usage text print करता है
+ * @param program program का नाम (argv[0])
+ */
+static void bench_usage(const char *program) {
+    printf("Usage: %s [options] [pattern-file...]\n", program);
+    printf("Options:\n");
+    printf("  --engines LIST      Engines to run: board,parallel,blocked,packed,hashlife,\n");
+    printf("                      sparse,gpu\n");
+    printf("                      (default all; gpu only in GPU=1 builds)\n");
+    printf("  --sizes LIST        Random board sides (default 256,1024,2048; empty = none)\n");
+    printf("  --densities LIST    Random board densities (default 0.05,0.2,0.5)\n");
+    printf("  --trials N          Timed trials per case (default %d)\n", BENCH_DEFAULT_TRIALS);
+    printf("  --generations N     Generations per trial (default: calibrated to ~%.2f s)\n", BENCH_TRIAL_SECONDS);
+    printf("  --threads N         Worker threads, 0 = all cores (default 0)\n");
+    printf("  --rule NAME         Rule set: conway, highlife, daynight, maze or a rule string\n");
+    printf("                      such as B36/S23, 23/3, B2-a/S12 (Hensel) or B2/S/C3\n");
+    printf("                      (Generations; engines without support report an error)\n");
+    printf("Output: CSV on stdout with columns\n");
+    printf("  engine,pattern,height,width,density,threads,generations,trials,\n");
+    printf("  gens_per_sec_median,gens_per_sec_best,cells_per_sec_median,ns_per_cell_median\n");
+}
+
+/**
+ * @brief command line options parse करता है
+ * @param argc arguments की संख्या
+ * @param argv arguments का array
+ * @param opts parsed options
+ * @param first_file पहली pattern file का index store करने के लिए pointer
+ * @return सफल होने पर 0, --help पर 1, invalid arguments पर -1
+ */
+static int bench_parse(int argc, char **argv, BenchOptions *opts, int *first_file) {
+    static const double default_sizes[] = {256, 1024, 2048};
+    static const double default_densities[] = {0.05, 0.2, 0.5};
+    double list[BENCH_MAX_LIST];
+    int count;
+
+    for (int e = 0; e < BENCH_ENGINE_COUNT; e++) opts->engines[e] = 1;
+    opts->engines[BENCH_GPU] = gpu_board_supported();
+    opts->size_count = 3;
+    for (int i = 0; i < 3; i++) opts->sizes[i] = (long)default_sizes[i];
+    opts->density_count = 3;
+    for (int i = 0; i < 3; i++) opts->densities[i] = default_densities[i];
+    opts->trials = BENCH_DEFAULT_TRIALS;
+    opts->generations = 0;
+    opts->threads = 0;
+    opts->rule_name = NULL;
+
+    int i = 1;
+    for (; i < argc && argv[i][0] == '-' && argv[i][1] == '-'; i++) {
+        const char *arg = argv[i];
+        if (strcmp(arg, "--help") == 0) return 1;
+        if (i + 1 >= argc) {
+            printf("Missing value for option %s\n", arg);
+            return -1;
+        }
+        const char *value = argv[++i];
+
+        if (strcmp(arg, "--engines") == 0) {
+            for (int e = 0; e < BENCH_ENGINE_COUNT; e++) opts->engines[e] = 0;
+            const char *name = value;
+            while (*name) {
+                size_t len = strcspn(name, ",");
+                int found = 0;
+                for (int e = 0; e < BENCH_ENGINE_COUNT; e++) {
+                    if (strlen(engine_names[e]) == len && strncmp(name, engine_names[e], len) == 0) {
+                        opts->engines[e] = found = 1;
+                    }
+                }
+                if (!found) {
+                    printf("Unknown engine in list: %s\n", value);
+                    return -1;
+                }
+                name += len + (name[len] == ',');
+            }
+        } else if (strcmp(arg, "--sizes") == 0) {
+            opts->size_count = 0;
+            if (*value && parse_list(value, list, &count) != 0) {
+                printf("Invalid size list: %s\n", value);
+                return -1;
+            }
+            for (int s = 0; *value && s < count; s++) {
+                if (list[s] < 1) {
+                    printf("Invalid size list: %s\n", value);
+                    return -1;
+                }
+                opts->sizes[opts->size_count++] = (long)list[s];
+            }
+        } else if (strcmp(arg, "--densities") == 0) {
+            if (parse_list(value, list, &count) != 0) {
+                printf("Invalid density list: %s\n", value);
+                return -1;
+            }
+            for (int d = 0; d < count; d++) {
+                if (list[d] > 1) {
+                    printf("Invalid density list: %s\n", value);
+                    return -1;
+                }
+                opts->densities[d] = list[d];
+            }
+            opts->density_count = count;
+        } else if (strcmp(arg, "--trials") == 0) {
+            opts->trials = atoi(value);
+            if (opts->trials < 1 || opts->trials > BENCH_MAX_TRIALS) {
+                printf("Invalid trial count: %s\n", value);
+                return -1;
+            }
+        } else if (strcmp(arg, "--generations") == 0) {
+            opts->generations = atol(value);
+            if (opts->generations < 1) {
+                printf("Invalid generation count: %s\n", value);
+                return -1;
+            }
+        } else if (strcmp(arg, "--threads") == 0) {
+            opts->threads = atoi(value);
+        } else if (strcmp(arg, "--rule") == 0) {
+            opts->rule_name = value;
+        } else {
+            printf("Unknown option: %s\n", arg);
+            return -1;
+        }
+    }
+
+    *first_file = i;
+    return 0;
+}
+
+/**
+ * @brief Main function - सभी cases पर चुने गए engines benchmark करता है
+ * @param argc command line arguments की संख्या
+ * @param argv command line arguments का array
+ * @return program exit status (0=success, non-zero=error)
+ */
+int main(int argc, char **argv) {
+    BenchOptions opts;
+    int first_file = argc;
+    int parsed = bench_parse(argc, argv, &opts, &first_file);
+    if (parsed != 0) {
+        bench_usage(argv[0]);
+        return parsed > 0 ? 0 : 1;
+    }
+
+    Rules *rules = opts.rule_name ? rules_from_name(opts.rule_name) : rules_conway();
+    if (rules == NULL) {
+        printf("Unknown rule set: %s\n", opts.rule_name);
+        return 1;
+    }
+    ThreadPool *pool = pool_init(opts.threads);
+    if (pool == NULL) {
+        printf("Error creating thread pool\n");
+        rules_free(rules);
+        return 1;
+    }
+
+    int error_code = 0;
+    printf("engine,pattern,height,width,density,threads,generations,trials,"
+           "gens_per_sec_median,gens_per_sec_best,cells_per_sec_median,ns_per_cell_median\n");
+
+    // Pattern files अपने natural size पर
+    for (int f = first_file; f < argc; f++) {
+        size_t height = 0, width = 0;
+        if (pattern_dimensions(argv[f], &height, &width) != 0 || height == 0 || width == 0) {
+            fprintf(stderr, "Error reading pattern: %s\n", argv[f]);
+            error_code = 1;
+            continue;
+        }
+
+        Board *initial = board_init_padded(height, width, BOARD_EDGE_DEAD);
+        if (initial == NULL || pattern_load(argv[f], initial) != 0) {
+            fprintf(stderr, "Error loading pattern: %s\n", argv[f]);
+            error_code = 1;
+        } else {
+            const char *name = strrchr(argv[f], '/');
+            if (bench_all_engines(&opts, name ? name + 1 : argv[f], -1, initial, rules, pool) != 0) error_code = 1;
+        }
+        if (initial != NULL) board_free(initial);
+    }
+
+    // Random boards, हर size और density पर
+    for (int s = 0; s < opts.size_count; s++) {
+        for (int d = 0; d < opts.density_count; d++) {
+            size_t side = (size_t)opts.sizes[s];
+            Board *initial = board_init_padded(side, side, BOARD_EDGE_DEAD);
+            if (initial == NULL) {
+                fprintf(stderr, "Error allocating %zux%zu board\n", side, side);
+                error_code = 1;
+                continue;
+            }
+            uint64_t seed = BENCH_SEED + (uint64_t)(s * BENCH_MAX_LIST + d);
+            if (board_random_fill(initial, seed, opts.densities[d], pool) != 0) {
+                fprintf(stderr, "Invalid density: %g\n", opts.densities[d]);
+                error_code = 1;
+                board_free(initial);
+                continue;
+            }
+            if (bench_all_engines(&opts, "random", opts.densities[d], initial, rules, pool) != 0) error_code = 1;
+            board_free(initial);
+        }
+    }
+
+    pool_free(pool);
+    rules_free(rules);
+    return error_code;
+}
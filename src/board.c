@@ -8,73 +8,276 @@
  * Performance optimization के लिए 1D array का उपयोग किया गया है।
  */
 
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 #include "board.h"
-
-#define BOARD_HEIGHT 32 
-#define BOARD_WIDTH BOARD_HEIGHT
+#include "pattern.h"
+#include "rng.h"
+#include "simd.h"
+#include "term.h"
 
 #define MIN(x, y) ((x) < (y) ? x : y)
 #define MAX(x, y) ((x) > (y) ? x : y)
 
 /**
- * @brief नया बोर्ड initialize करता है और memory allocate करता है
- * 
- * यह function एक नया Board struct create करता है और सभी cells को
- * zero (मृत) state में initialize करता है।
+ * @brief arena से या (arena NULL हो तो) heap से zeroed memory लेता है
+ * @param arena source arena (NULL = calloc)
+ * @param count elements की संख्या
+ * @param size हर element के bytes
+ * @return सफल होने पर pointer, memory allocation fail होने पर NULL
+ */
+static void *board_calloc(Arena *arena, size_t count, size_t size) {
+    if (arena != NULL) return count <= SIZE_MAX / size ? arena_alloc(arena, count * size) : NULL;
+    return calloc(count, size);
+}
+
+/**
+ * @brief दिए गए layout का stride निकालता है
+ * @param width बोर्ड की चौड़ाई
+ * @param halo ghost border की चौड़ाई
+ * @return एक row से अगली row तक bytes
+ */
+static size_t board_stride(size_t width, size_t halo) {
+    size_t stride = width + 2 * halo;
+    if (halo > 0) {
+        stride = (stride + BOARD_ROW_ALIGN - 1) / BOARD_ROW_ALIGN * BOARD_ROW_ALIGN;
+    }
+    return stride;
+}
+
+/**
+ * @brief दिए गए layout के साथ बोर्ड allocate करता है
  * 
  * @param height बोर्ड की ऊंचाई (rows की संख्या)
  * @param width बोर्ड की चौड़ाई (columns की संख्या)
+ * @param halo ghost border की चौड़ाई (0 या BOARD_HALO)
+ * @param edge किनारों का behavior
+ * @param arena जिस arena से सारी memory आए (NULL = heap)
  * @return सफल होने पर Board pointer, memory allocation fail होने पर NULL
  */
-Board *board_init(size_t height, size_t width) {
-    Board *board = malloc(sizeof(Board));
+static Board *board_alloc(size_t height, size_t width, size_t halo, BoardEdge edge, Arena *arena) {
+    Board *board = board_calloc(arena, 1, sizeof(Board));
     if (!board) {
         return NULL;
     }    
     // बोर्ड dimensions set करें
     board->height = height;
     board->width = width;
+    board->halo = halo;
+    board->edge = edge;
+    board->stride = board_stride(width, halo);
+    board->arena = arena;
+
+    // सभी cells (ghost cells सहित) को zero (मृत) state में initialize करें (1 byte प्रति cell)
+    size_t rows = height + 2 * halo;
+    board->storage = board_calloc(arena, rows * board->stride, sizeof(char));
+    board->cells = board->storage ? board->storage + halo * board->stride + halo : NULL;
+
+    // Dirty-region tracking के लिए tiles
+    board->tile_rows = (height + BOARD_TILE_SIZE - 1) / BOARD_TILE_SIZE;
+    board->tile_cols = (width + BOARD_TILE_SIZE - 1) / BOARD_TILE_SIZE;
+    size_t tiles = board->tile_rows * board->tile_cols;
+    board->tile_stamp = board_calloc(arena, tiles ? tiles : 1, sizeof(uint64_t));
+    board->tile_active = board_calloc(arena, tiles ? tiles : 1, sizeof(uint8_t));
+    board->tile_stats = board_calloc(arena, tiles ? tiles : 1, sizeof(BoardTileStats));
+    board->tile_hash = board_calloc(arena, tiles ? tiles : 1, sizeof(BoardTileHash));
+    board->parent = NULL;
+    board->parent_version = 0;
+    board->version = 0;
+    board->step_scratch = NULL;
+    board->step_scratch_size = 0;
+    board->text_frame = NULL;
+    board->text_frame_size = 0;
+
+    if ((!board->storage && rows * board->stride > 0) || !board->tile_stamp || !board->tile_active ||
+        !board->tile_stats || !board->tile_hash) {
+        // Arena की memory arena के साथ ही free होती है
+        if (arena == NULL) {
+            free(board->storage);
+            free(board->tile_stamp);
+            free(board->tile_active);
+            free(board->tile_stats);
+            free(board->tile_hash);
+            free(board);
+        }
+        return NULL;
+    }
 
-    // सभी cells को zero (मृत) state में initialize करें
-    board->cells = calloc(sizeof(void *), height * width);
+    // नए बोर्ड का content किसी दूसरे बोर्ड से match नहीं माना जाता
+    board_mark_all_dirty(board);
 
     return board;
 }
 
+/**
+ * @brief नया बोर्ड initialize करता है और memory allocate करता है
+ * 
+ * यह function एक नया Board struct create करता है और सभी cells को
+ * zero (मृत) state में initialize करता है। Rows contiguous हैं
+ * (stride = width) और किनारे dead हैं।
+ * 
+ * @param height बोर्ड की ऊंचाई (rows की संख्या)
+ * @param width बोर्ड की चौड़ाई (columns की संख्या)
+ * @return सफल होने पर Board pointer, memory allocation fail होने पर NULL
+ */
+Board *board_init(size_t height, size_t width) {
+    return board_alloc(height, width, 0, BOARD_EDGE_DEAD, NULL);
+}
+
+/**
+ * @brief ghost border (halo) और padded stride वाला नया बोर्ड initialize करता है
+ * 
+ * Stride BOARD_ROW_ALIGN का multiple होता है। Ghost cells शुरू में 0 हैं।
+ * 
+ * @param height बोर्ड की ऊंचाई (rows की संख्या)
+ * @param width बोर्ड की चौड़ाई (columns की संख्या)
+ * @param edge किनारों का behavior
+ * @return सफल होने पर Board pointer, memory allocation fail होने पर NULL
+ */
+Board *board_init_padded(size_t height, size_t width, BoardEdge edge) {
+    return board_alloc(height, width, BOARD_HALO, edge, NULL);
+}
+
+/**
+ * @brief board_init_arena के एक बोर्ड को arena में चाहिए bytes
+ *
+ * @param height बोर्ड की ऊंचाई (rows की संख्या)
+ * @param width बोर्ड की चौड़ाई (columns की संख्या)
+ * @return arena capacity में जोड़ने वाले bytes
+ */
+size_t board_arena_size(size_t height, size_t width) {
+    size_t rows = height + 2 * BOARD_HALO;
+    size_t tiles = ((height + BOARD_TILE_SIZE - 1) / BOARD_TILE_SIZE) *
+                   ((width + BOARD_TILE_SIZE - 1) / BOARD_TILE_SIZE);
+    if (tiles == 0) tiles = 1;
+    return ARENA_SIZE(sizeof(Board)) + ARENA_SIZE(rows * board_stride(width, BOARD_HALO)) +
+           ARENA_SIZE(tiles * sizeof(uint64_t)) + ARENA_SIZE(tiles * sizeof(uint8_t)) +
+           ARENA_SIZE(tiles * sizeof(BoardTileStats)) + ARENA_SIZE(tiles * sizeof(BoardTileHash));
+}
+
+/**
+ * @brief arena में padded बोर्ड बनाता है (board_init_padded जैसा layout)
+ *
+ * Struct, cells और tile arrays सब arena से आते हैं; board_free इनमें से
+ * कुछ free नहीं करता, सिर्फ board_step_n का lazily allocated scratch।
+ *
+ * @param arena source arena (कम से कम board_arena_size bytes खाली)
+ * @param height बोर्ड की ऊंचाई (rows की संख्या)
+ * @param width बोर्ड की चौड़ाई (columns की संख्या)
+ * @param edge किनारों का behavior
+ * @return सफल होने पर Board pointer, NULL arena या arena भर जाने पर NULL
+ */
+Board *board_init_arena(Arena *arena, size_t height, size_t width, BoardEdge edge) {
+    if (arena == NULL) return NULL;
+    return board_alloc(height, width, BOARD_HALO, edge, arena);
+}
+
+/**
+ * @brief ghost cells को edge mode के अनुसार भरता है
+ * 
+ * पहले ghost rows (interior columns) भरी जाती हैं, फिर हर row (ghost rows
+ * सहित) के ghost columns, इसलिए corners भी सही diagonal corner से आते हैं।
+ * 
+ * @param board halo वाला बोर्ड
+ * @return सफल होने पर 0, NULL या halo के बिना बोर्ड होने पर -1
+ */
+int board_fill_halo(Board *board) {
+    if (board == NULL || board->halo == 0) return -1;
+    if (board->height == 0 || board->width == 0) return 0;
+    
+    const size_t stride = board->stride, width = board->width;
+    char *first = board->cells;
+    char *last = board->cells + (board->height - 1) * stride;
+    
+    if (board->edge == BOARD_EDGE_TORUS) {
+        memcpy(first - stride, last, width);
+        memcpy(last + stride, first, width);
+        for (char *row = first - stride; row <= last + stride; row += stride) {
+            row[-1] = row[width - 1];
+            row[width] = row[0];
+        }
+    } else {
+        memset(first - stride - 1, 0, width + 2);
+        memset(last + stride - 1, 0, width + 2);
+        for (char *row = first; row <= last; row += stride) {
+            row[-1] = 0;
+            row[width] = 0;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief board_format_text के frame के ज्यादा से ज्यादा bytes
+ *
+ * @param board source बोर्ड
+ * @return सभी cells जीवित होने पर frame के bytes (हर cell 6, हर row + 1)
+ */
+size_t board_text_size(const Board *board) {
+    if (board == NULL) return 0;
+    return board->height * (board->width * 6 + 1);
+}
+
+/**
+ * @brief पूरे बोर्ड का text frame buffer में बनाता है
+ *
+ * जीवित cells ██ और मृत cells "  " हैं, हर row के बाद newline। Buffer
+ * में कम से कम board_text_size bytes होने चाहिए; कोई null terminator नहीं
+ * लिखा जाता।
+ *
+ * @param board source बोर्ड
+ * @param buffer output buffer
+ * @return लिखे गए bytes
+ */
+size_t board_format_text(const Board *board, char *buffer) {
+    char *out = buffer;
+    for (size_t x = 0; x < board->height; x++) {
+        const char *row = &board->cells[BOARD_INDEX(board, x, 0)];
+        for (size_t y = 0; y < board->width; y++) {
+            if (row[y] == 1) {
+                memcpy(out, "██", 6);
+                out += 6;
+            } else {
+                out[0] = ' ';
+                out[1] = ' ';
+                out += 2;
+            }
+        }
+        *out++ = '\n';
+    }
+    return (size_t)(out - buffer);
+}
+
 /**
  * @brief बोर्ड को terminal में visual format में print करता है
  * 
- * यह function बोर्ड को terminal में Unicode blocks का उपयोग करके
- * print करता है। जीवित cells ██ और मृत cells "  " के रूप में दिखाई जाती हैं।
+ * पूरा frame बोर्ड के text_frame buffer में बनता है (board_format_text)
+ * और stdout पर एक write में जाता है, row-by-row printf नहीं होता। Buffer
+ * पहली call पर allocate होता है, इसलिए बार-बार print करने पर कोई
+ * allocation नहीं होता।
  * 
  * @param board print करने वाला बोर्ड
- * @return सफल होने पर 0, memory allocation fail होने पर -1
+ * @return सफल होने पर 0, memory allocation या write fail होने पर -1
  */
 int board_print(Board *board) {
-    // एक line के लिए buffer allocate करें (प्रति cell 2 chars + null terminator)
-    char *line = malloc(board->width * 2 + 1);
-    
-    if (line == NULL) {
-        return -1;
-    }
+    if (board == NULL) return -1;
     
-    for (size_t i = 0; i < board->width * board->height; i++) {
-        // 1D index को 2D coordinates में convert करें
-        size_t x = i / board->width;
-        size_t y = i % board->width;
-        COPY_CELL(&line[y * 2], board->cells[x * board->width + y]);
-        // जब row का अंत आ जाए तो line print करें
-        if (y == board->width - 1) {
-            line[board->width * 2] = '\0';  // Null terminate
-            printf("%s\n", line);
-        }
+    size_t needed = board_text_size(board);
+    if (board->text_frame_size < needed) {
+        char *frame = malloc(needed);
+        if (frame == NULL) return -1;
+        free(board->text_frame);
+        board->text_frame = frame;
+        board->text_frame_size = needed;
     }
     
-    free(line);
-    return 0;
+    size_t size = board_format_text(board, board->text_frame);
+    fflush(stdout);
+    return term_write(STDOUT_FILENO, board->text_frame, size);
 }
 
 /**
@@ -89,8 +292,21 @@ int board_print(Board *board) {
 int board_free(Board *board) {
     if (board == NULL) return -1;
     
-    // cells array की memory free करें
-    free(board->cells);
+    // Arena वाले बोर्ड की memory arena_free के साथ जाती है
+    if (board->arena != NULL) {
+        free(board->step_scratch);
+        free(board->text_frame);
+        return 0;
+    }
+    
+    // cells array और tile tracking की memory free करें
+    free(board->storage);
+    free(board->tile_stamp);
+    free(board->tile_active);
+    free(board->tile_stats);
+    free(board->tile_hash);
+    free(board->step_scratch);
+    free(board->text_frame);
     
     // बोर्ड struct की memory free करें
     free(board);
@@ -103,7 +319,9 @@ int board_free(Board *board) {
  * 
  * यह function दिए गए cell के आसपास के neighbors count करता है और
  * current rules के अनुसार determine करता है कि cell next generation में
- * जीवित रहेगी या मरेगी।
+ * जीवित रहेगी या मरेगी। Halo वाले बोर्ड पर आठों neighbors सीधे पढ़े जाते
+ * हैं (torus पर ghost cells board_fill_halo से भरी होनी चाहिए); बिना
+ * halo वाले बोर्ड पर बोर्ड के बाहर के neighbors मृत माने जाते हैं।
  * 
  * @param board current बोर्ड state
  * @param rules apply करने वाले game rules
@@ -115,23 +333,605 @@ int board_free(Board *board) {
 int is_cell_alive_next_gen(struct Board *board, Rules *rules, size_t x, size_t y, int *result) {
     if (board == NULL || rules == NULL || result == NULL || x >= board->height || y >= board->width) return -1;
     
-    // cell के आसपास के जीवित neighbors count करें
-    int count = 0;
-    for (size_t i = MAX((int)x-1, 0); i <= MIN(x+1, board->height - 1); i++) {
-        for (size_t j = MAX((int)y-1, 0); j <= MIN(y+1, board->width - 1); j++) {
-            // current cell को count न करें
-            if (i == x && j == y) continue; 
-
-            // neighbor जीवित है तो count increment करें
-            // 2D coordinates को 1D index में convert करें
-            size_t index = i * board->width + j;
-            count += board->cells[index];
+    const char *cell = &board->cells[BOARD_INDEX(board, x, y)];
+    unsigned index = 0;
+    
+    // 3x3 neighborhood index (देखें RULES_NEIGHBORHOOD_SIZE); सिर्फ state 1 जीवित है
+    for (int dj = -1; dj <= 1; dj++) {
+        for (int di = -1; di <= 1; di++) {
+            index <<= 1;
+            // बिना halo वाले बोर्ड पर बोर्ड के बाहर के neighbors मृत हैं
+            if (board->halo == 0 && ((x == 0 && di < 0) || (x + 1 == board->height && di > 0) ||
+                                     (y == 0 && dj < 0) || (y + 1 == board->width && dj > 0))) continue;
+            index |= cell[di * (ptrdiff_t)board->stride + dj] == 1;
+        }
+    }
+    
+    // Generations में dying cells कभी सीधे जीवित नहीं होतीं
+    *result = (uint8_t)*cell <= 1 && rules->neighborhood[index];
+    return 0;
+}
+
+/**
+ * @brief Tile stamps के लिए global counter (हर नए content को unique stamp मिलता है)
+ */
+static uint64_t stamp_counter = 0;
+
+/**
+ * @brief नया unique tile stamp return करता है (thread-safe)
+ * @return नया stamp
+ */
+static uint64_t next_stamp(void) {
+    return __atomic_add_fetch(&stamp_counter, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief (x, y) cell वाली tile को changed mark करता है
+ * 
+ * Tile को नया stamp मिलता है, इसलिए अगले step में वो और उसके neighbors
+ * recompute होंगे और renderer उसे redraw करेगा।
+ * 
+ * @param board target बोर्ड
+ * @param x बदली गई cell की row
+ * @param y बदली गई cell का column
+ * @return सफल होने पर 0, NULL pointer या out of bounds होने पर -1
+ */
+int board_mark_dirty(Board *board, size_t x, size_t y) {
+    if (board == NULL || x >= board->height || y >= board->width) return -1;
+    
+    size_t tile = (x / BOARD_TILE_SIZE) * board->tile_cols + y / BOARD_TILE_SIZE;
+    board->tile_stamp[tile] = next_stamp();
+    board->version++;
+    return 0;
+}
+
+/**
+ * @brief बोर्ड की सभी tiles को changed mark करता है
+ * 
+ * Clear, random fill या file load जैसे पूरे बोर्ड वाले बदलावों के बाद
+ * call होता है।
+ * 
+ * @param board target बोर्ड
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int board_mark_all_dirty(Board *board) {
+    if (board == NULL) return -1;
+    
+    uint64_t stamp = next_stamp();
+    for (size_t i = 0; i < board->tile_rows * board->tile_cols; i++) {
+        board->tile_stamp[i] = stamp;
+    }
+    board->version++;
+    return 0;
+}
+
+/**
+ * @brief एक बोर्ड का content दूसरे (same size के) बोर्ड में copy करता है
+ *
+ * Same stamp = same content, इसलिए सिर्फ वो tiles copy होती हैं जिनका
+ * stamp dst में src से अलग है, और stamps भी साथ copy होते हैं। Simulator
+ * के snapshots में हर publish पर सिर्फ बदला हुआ हिस्सा copy होता है।
+ * Ghost cells copy नहीं होते।
+ *
+ * @param dst target बोर्ड
+ * @param src source बोर्ड
+ * @return सफल होने पर 0, NULL pointer या dimensions अलग होने पर -1
+ */
+int board_copy(Board *dst, const Board *src) {
+    if (dst == NULL || src == NULL || dst->height != src->height || dst->width != src->width) return -1;
+
+    int changed = 0;
+    for (size_t tx = 0; tx < src->tile_rows; tx++) {
+        size_t x_end = (tx + 1) * BOARD_TILE_SIZE < src->height ? (tx + 1) * BOARD_TILE_SIZE : src->height;
+        for (size_t ty = 0; ty < src->tile_cols; ty++) {
+            size_t tile = tx * src->tile_cols + ty;
+            if (dst->tile_stamp[tile] == src->tile_stamp[tile]) continue;
+
+            size_t y0 = ty * BOARD_TILE_SIZE;
+            size_t span = src->width - y0 < BOARD_TILE_SIZE ? src->width - y0 : BOARD_TILE_SIZE;
+            for (size_t x = tx * BOARD_TILE_SIZE; x < x_end; x++) {
+                memcpy(&dst->cells[BOARD_INDEX(dst, x, y0)], &src->cells[BOARD_INDEX(src, x, y0)], span);
+            }
+            dst->tile_stamp[tile] = src->tile_stamp[tile];
+            changed = 1;
+        }
+    }
+
+    if (changed) dst->version++;
+    return 0;
+}
+
+/**
+ * @brief एक row के columns [y_begin, y_end) के लिए compiled neighborhood table से next generation compute करता है
+ * 
+ * Row में 3x3 neighborhood का 9-bit index sliding window की तरह
+ * maintain किया जाता है: अगले column पर index को 3 bits shift करके
+ * नया column जोड़ दिया जाता है, और result rules->neighborhood table से
+ * सीधे मिलता है। Halo वाले बोर्ड पर ghost rows/columns सीधे पढ़े जाते
+ * हैं; बिना halo वाले बोर्ड पर बाहर की rows को mask से 0 कर दिया जाता है।
+ * इसलिए per-cell कोई bounds check या error branch नहीं है।
+ * 
+ * @param board current generation का बोर्ड
+ * @param out next generation store करने के लिए output बोर्ड
+ * @param rules apply करने वाले game rules
+ * @param x row
+ * @param y_begin पहला column (inclusive)
+ * @param y_end आखिरी column (exclusive, y_begin से बड़ा)
+ * @return कोई cell बदली तो non-zero, वरना 0
+ */
+static unsigned board_next_span(Board *board, Board *out, Rules *rules, size_t x, size_t y_begin, size_t y_end) {
+    const size_t stride = board->stride;
+    const uint8_t *table = rules->neighborhood;
+    const char *mid = &board->cells[BOARD_INDEX(board, x, 0)];
+    // बोर्ड के बाहर की rows (halo न हो तो): pointer current row पर रखें और mask 0 करें
+    const unsigned up_mask = x > 0 || board->halo > 0;
+    const unsigned down_mask = x + 1 < board->height || board->halo > 0;
+    const char *up = up_mask ? mid - stride : mid;
+    const char *down = down_mask ? mid + stride : mid;
+    const int has_left = y_begin > 0 || board->halo > 0;
+    const int has_right = y_end < board->width || board->halo > 0;
+    char *dst = &out->cells[BOARD_INDEX(out, x, 0)];
+    unsigned changed = 0;
+    
+// एक column के 3 bits: ऊपर=bit 2, बीच=bit 1, नीचे=bit 0
+#define COLUMN_BITS(y) ((((unsigned)up[y] & up_mask) << 2) | ((unsigned)mid[y] << 1) | ((unsigned)down[y] & down_mask))
+    
+    // बायां column span के बाहर है (बोर्ड और halo के बाहर हो तो 0)
+    unsigned index = ((has_left ? COLUMN_BITS((ptrdiff_t)y_begin - 1) : 0) << 3) | COLUMN_BITS(y_begin);
+    size_t y = y_begin;
+    for (; y + 1 < y_end; y++) {
+        index = ((index << 3) & (RULES_NEIGHBORHOOD_SIZE - 1)) | COLUMN_BITS(y + 1);
+        uint8_t next = table[index];
+        changed |= next ^ (uint8_t)mid[y];
+        dst[y] = next;
+    }
+    
+    // आखिरी column: दायां column span के बाहर है
+    index = ((index << 3) & (RULES_NEIGHBORHOOD_SIZE - 1)) | (has_right ? COLUMN_BITS(y_end) : 0);
+#undef COLUMN_BITS
+    uint8_t next = table[index];
+    changed |= next ^ (uint8_t)mid[y];
+    dst[y] = next;
+    
+    return changed;
+}
+
+/**
+ * @brief Generations rules (states > 2) के लिए एक row के columns [y_begin, y_end) compute करता है
+ * 
+ * board_next_span जैसा sliding 9-bit index, पर सिर्फ state 1 की cells
+ * जीवित गिनी जाती हैं। Table से जीवित न होने वाली state 1 cell dying
+ * state 2 में जाती है, dying cells हर generation एक state आगे बढ़कर
+ * states पर 0 हो जाती हैं, और उन पर birth नहीं होता।
+ * 
+ * @param board current generation का बोर्ड
+ * @param out next generation store करने के लिए output बोर्ड
+ * @param rules apply करने वाले game rules
+ * @param x row
+ * @param y_begin पहला column (inclusive)
+ * @param y_end आखिरी column (exclusive, y_begin से बड़ा)
+ * @return कोई cell बदली तो non-zero, वरना 0
+ */
+static unsigned board_next_span_states(Board *board, Board *out, Rules *rules, size_t x, size_t y_begin, size_t y_end) {
+    const size_t stride = board->stride;
+    const uint8_t *table = rules->neighborhood;
+    const unsigned states = (unsigned)rules->states;
+    const uint8_t *mid = (const uint8_t *)&board->cells[BOARD_INDEX(board, x, 0)];
+    const unsigned up_mask = x > 0 || board->halo > 0;
+    const unsigned down_mask = x + 1 < board->height || board->halo > 0;
+    const uint8_t *up = up_mask ? mid - stride : mid;
+    const uint8_t *down = down_mask ? mid + stride : mid;
+    const int has_left = y_begin > 0 || board->halo > 0;
+    const int has_right = y_end < board->width || board->halo > 0;
+    uint8_t *dst = (uint8_t *)&out->cells[BOARD_INDEX(out, x, 0)];
+    unsigned changed = 0;
+    
+#define COLUMN_BITS(y) ((((unsigned)(up[y] == 1) & up_mask) << 2) | ((unsigned)(mid[y] == 1) << 1) | ((unsigned)(down[y] == 1) & down_mask))
+    
+    unsigned index = ((has_left ? COLUMN_BITS((ptrdiff_t)y_begin - 1) : 0) << 3) | COLUMN_BITS(y_begin);
+    for (size_t y = y_begin; y < y_end; y++) {
+        unsigned right = y + 1 < y_end || has_right ? COLUMN_BITS(y + 1) : 0;
+        index = ((index << 3) & (RULES_NEIGHBORHOOD_SIZE - 1)) | right;
+        unsigned cur = mid[y];
+        unsigned next = cur <= 1 ? table[index] : 0;
+        if (!next && cur != 0) next = cur + 1 < states ? cur + 1 : 0;
+        changed |= next ^ cur;
+        dst[y] = (uint8_t)next;
+    }
+#undef COLUMN_BITS
+    
+    return changed;
+}
+
+/**
+ * @brief SIMD kernel से एक row के columns [y_begin, y_end) compute करता है
+ * 
+ * Vector loads हर column के बाएं/दाएं neighbor भी पढ़ते हैं। Halo वाले
+ * बोर्ड पर पूरा span vector से होता है; बिना halo के बोर्ड के पहले और
+ * आखिरी column scalar से। जो columns vector width में पूरे नहीं आते,
+ * वो scalar board_next_span से होते हैं।
+ * 
+ * @param board current generation का बोर्ड
+ * @param out next generation store करने के लिए output बोर्ड
+ * @param rules apply करने वाले game rules
+ * @param kernel SIMD row kernel
+ * @param x row
+ * @param y_begin पहला column (inclusive)
+ * @param y_end आखिरी column (exclusive, y_begin से बड़ा)
+ * @return कोई cell बदली तो non-zero, वरना 0
+ */
+static unsigned board_next_span_simd(Board *board, Board *out, Rules *rules, SimdRowKernel kernel,
+                                     size_t x, size_t y_begin, size_t y_end) {
+    const size_t stride = board->stride;
+    unsigned changed = 0;
+    
+    // Vector range: दोनों तरफ एक column का neighbor valid memory में हो
+    size_t v_begin = board->halo > 0 ? y_begin : MAX(y_begin, (size_t)1);
+    size_t v_end = board->halo > 0 ? y_end : MIN(y_end, board->width - 1);
+    if (v_begin >= v_end) return board_next_span(board, out, rules, x, y_begin, y_end);
+    
+    const unsigned up_mask = x > 0 || board->halo > 0;
+    const unsigned down_mask = x + 1 < board->height || board->halo > 0;
+    const char *mid = &board->cells[BOARD_INDEX(board, x, v_begin)];
+    size_t done = kernel(up_mask ? mid - stride : mid, mid, down_mask ? mid + stride : mid,
+                         up_mask, down_mask, &out->cells[BOARD_INDEX(out, x, v_begin)],
+                         v_end - v_begin, rules, &changed);
+    
+    if (y_begin < v_begin) changed |= board_next_span(board, out, rules, x, y_begin, v_begin);
+    if (v_begin + done < y_end) changed |= board_next_span(board, out, rules, x, v_begin + done, y_end);
+    return changed;
+}
+
+/**
+ * @brief तय करता है कि इस step में कौन सी tiles recompute होंगी
+ * 
+ * Tile को skip तभी किया जा सकता है जब out ही board का parent हो (और
+ * उसके बाद out बदला न हो), और tile व उसके आठ neighbors के stamps board
+ * और out में same हों। तब tile का next content board जैसा ही है, और
+ * out में वही content पहले से है। बाकी सभी tiles active होती हैं।
+ * Torus पर neighbor tiles सामने वाले किनारे तक wrap होती हैं।
+ * 
+ * @param board current generation का बोर्ड
+ * @param out output बोर्ड (पिछली generation)
+ */
+static void board_plan_tiles(Board *board, Board *out) {
+    const size_t rows = board->tile_rows, cols = board->tile_cols;
+    const int can_skip = board->parent == out && board->parent_version == out->version;
+    const int wrap = board->edge == BOARD_EDGE_TORUS;
+    
+    for (size_t tx = 0; tx < rows; tx++) {
+        for (size_t ty = 0; ty < cols; ty++) {
+            uint8_t active = !can_skip;
+            for (int di = -1; !active && di <= 1; di++) {
+                for (int dj = -1; dj <= 1; dj++) {
+                    size_t i = tx + rows + (size_t)(ptrdiff_t)di, j = ty + cols + (size_t)(ptrdiff_t)dj;
+                    if (!wrap && (i < rows || i >= 2 * rows || j < cols || j >= 2 * cols)) continue;
+                    size_t tile = (i % rows) * cols + j % cols;
+                    if (board->tile_stamp[tile] != out->tile_stamp[tile]) {
+                        active = 1;
+                        break;
+                    }
+                }
+            }
+            board->tile_active[tx * cols + ty] = active;
+        }
+    }
+}
+
+/**
+ * @brief इससे multiply करने पर word के आठ bytes का sum top byte में आता है
+ */
+#define BYTE_SUM 0x0101010101010101ULL
+
+/**
+ * @brief row के columns [0, count) scalar words से गिनता है (SIMD के बाद का हिस्सा)
+ * 
+ * Cells 8-8 करके uint64_t words में पढ़े जाते हैं। Cells 0 या 1 हैं,
+ * इसलिए words को सीधे जोड़ने पर हर byte में उस byte-column की count आती
+ * है (max 8, overflow नहीं) और एक multiply से सभी bytes का sum top byte
+ * में आ जाता है।
+ * 
+ * @param cur नई generation की row
+ * @param old पिछली generation की row (NULL = births/deaths नहीं)
+ * @param count कितने columns (BOARD_TILE_SIZE से ज्यादा नहीं)
+ * @param counts population, births और deaths जोड़ने के लिए array
+ * @param columns हर column का OR accumulator
+ */
+static void board_count_span(const char *cur, const char *old, size_t count,
+                             uint64_t counts[3], unsigned char *columns) {
+    uint64_t now[BOARD_TILE_SIZE / 8], before[BOARD_TILE_SIZE / 8];
+    const size_t words = (count + 7) / 8;
+    if (count == 0 || count > BOARD_TILE_SIZE) return;
+    
+    // count 8 का multiple न हो तो आखिरी word के बाकी bytes 0 रहें
+    now[words - 1] = 0;
+    before[words - 1] = 0;
+    memcpy(now, cur, count);
+    if (old != NULL) memcpy(before, old, count);
+    
+    uint64_t population = 0, births = 0, deaths = 0;
+    for (size_t w = 0; w < words; w++) {
+        population += now[w];
+        if (old != NULL) {
+            births += now[w] & ~before[w];
+            deaths += before[w] & ~now[w];
         }
     }
+    counts[0] += (population * BYTE_SUM) >> 56;
+    counts[1] += (births * BYTE_SUM) >> 56;
+    counts[2] += (deaths * BYTE_SUM) >> 56;
+    for (size_t y = 0; y < count; y++) columns[y] |= (unsigned char)cur[y];
+}
+
+/**
+ * @brief एक tile का summary scan करता है
+ * 
+ * पूरी tile SIMD count kernel की एक call में गिनी जाती है (bytes का sum =
+ * population, prev दिया हो तो births = नया & ~पुराना और deaths =
+ * पुराना & ~नया), और vector width में न आने वाले columns हर row में
+ * board_count_span से। Rows का OR जीवित columns बताता है।
+ * 
+ * @param board जिस बोर्ड की tile scan होनी है
+ * @param prev पिछली generation का बोर्ड (NULL = births/deaths 0)
+ * @param count SIMD count kernel (NULL = scalar)
+ * @param tile tile का index
+ * @param stats result store करने के लिए pointer
+ */
+static void board_scan_tile(const Board *board, const Board *prev, SimdBlockCount count, size_t tile,
+                            BoardTileStats *stats) {
+    const size_t x_begin = tile / board->tile_cols * BOARD_TILE_SIZE;
+    const size_t rows = MIN((size_t)BOARD_TILE_SIZE, board->height - x_begin);
+    const size_t y_begin = tile % board->tile_cols * BOARD_TILE_SIZE;
+    const size_t span = MIN((size_t)BOARD_TILE_SIZE, board->width - y_begin);
+    const char *cur = &board->cells[BOARD_INDEX(board, x_begin, y_begin)];
+    const char *old = prev != NULL ? &prev->cells[BOARD_INDEX(prev, x_begin, y_begin)] : NULL;
+    unsigned char columns[BOARD_TILE_SIZE] = {0};
+    uint64_t tile_counts[3] = {0, 0, 0};
+    uint64_t live_rows = 0;
+    
+    size_t done = count ? count(cur, board->stride, old, prev ? prev->stride : 0, rows, span,
+                                tile_counts, columns, &live_rows) : 0;
+    for (size_t r = 0; done < span && r < rows; r++) {
+        uint64_t before = tile_counts[0];
+        board_count_span(cur + r * board->stride + done, old ? old + r * prev->stride + done : NULL,
+                         span - done, tile_counts, columns + done);
+        if (tile_counts[0] != before) live_rows |= (uint64_t)1 << r;
+    }
+    
+    size_t min_x = live_rows ? (size_t)__builtin_ctzll(live_rows) : 0;
+    size_t max_x = live_rows ? 63 - (size_t)__builtin_clzll(live_rows) : 0;
+    size_t min_y = 0, max_y = 0;
+    if (tile_counts[0] > 0) {
+        while (!columns[min_y]) min_y++;
+        max_y = span - 1;
+        while (!columns[max_y]) max_y--;
+    }
+    
+    stats->stamp = board->tile_stamp[tile];
+    stats->population = (uint32_t)tile_counts[0];
+    stats->births = (uint32_t)tile_counts[1];
+    stats->deaths = (uint32_t)tile_counts[2];
+    stats->min_x = (uint8_t)min_x;
+    stats->max_x = (uint8_t)max_x;
+    stats->min_y = (uint8_t)min_y;
+    stats->max_y = (uint8_t)max_y;
+}
 
-    // rules apply करके determine करें कि cell जीवित रहेगी या मरेगी
-    size_t current_index = x * board->width + y;
-    return rules_apply(rules, board->cells[current_index], count, result);
+/**
+ * @brief content न बदलने वाली tile का summary out में रखता है
+ * 
+ * Board में उसी stamp का summary हो तो वही copy होता है, out में पहले से
+ * valid हो तो रहता है; दोनों न हों तभी tile scan होती है। Births और
+ * deaths 0 हैं।
+ * 
+ * @param board current generation का बोर्ड
+ * @param out output बोर्ड (tile का stamp set हो चुका है)
+ * @param count SIMD count kernel (NULL = scalar)
+ * @param tile tile का index
+ */
+static void board_keep_tile_stats(const Board *board, Board *out, SimdBlockCount count, size_t tile) {
+    BoardTileStats *stats = &out->tile_stats[tile];
+    if (board->tile_stats[tile].stamp == out->tile_stamp[tile]) {
+        *stats = board->tile_stats[tile];
+    } else if (stats->stamp != out->tile_stamp[tile]) {
+        board_scan_tile(out, NULL, count, tile, stats);
+    }
+    stats->births = 0;
+    stats->deaths = 0;
+}
+
+/**
+ * @brief tile summaries को पूरे बोर्ड के statistics में जोड़ता है
+ * @param board जिसके tile summaries valid हैं
+ * @param stats result store करने के लिए pointer
+ */
+static void board_reduce_stats(const Board *board, BoardStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+    stats->min_x = SIZE_MAX;
+    stats->min_y = SIZE_MAX;
+    
+    for (size_t tx = 0; tx < board->tile_rows; tx++) {
+        for (size_t ty = 0; ty < board->tile_cols; ty++) {
+            const BoardTileStats *tile = &board->tile_stats[tx * board->tile_cols + ty];
+            stats->births += tile->births;
+            stats->deaths += tile->deaths;
+            if (tile->population == 0) continue;
+            
+            stats->population += tile->population;
+            stats->min_x = MIN(stats->min_x, tx * BOARD_TILE_SIZE + tile->min_x);
+            stats->max_x = MAX(stats->max_x, tx * BOARD_TILE_SIZE + tile->max_x);
+            stats->min_y = MIN(stats->min_y, ty * BOARD_TILE_SIZE + tile->min_y);
+            stats->max_y = MAX(stats->max_y, ty * BOARD_TILE_SIZE + tile->max_y);
+        }
+    }
+    
+    if (stats->population == 0) {
+        stats->min_x = 0;
+        stats->min_y = 0;
+    }
+}
+
+/**
+ * @brief current generation की population और bounding box देता है (births/deaths 0)
+ * 
+ * Tile summaries valid हों तो reuse होते हैं, वरना tiles scan होती हैं।
+ * 
+ * @param board source बोर्ड
+ * @param stats statistics store करने के लिए pointer
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int board_stats(Board *board, BoardStats *stats) {
+    if (board == NULL || stats == NULL) return -1;
+    
+    for (size_t tile = 0; tile < board->tile_rows * board->tile_cols; tile++) {
+        if (board->tile_stats[tile].stamp != board->tile_stamp[tile]) {
+            board_scan_tile(board, NULL, simd_block_count(), tile, &board->tile_stats[tile]);
+        }
+        board->tile_stats[tile].births = 0;
+        board->tile_stats[tile].deaths = 0;
+    }
+    board_reduce_stats(board, stats);
+    return 0;
+}
+
+/**
+ * @brief 64-bit value को mix करता है (splitmix64 का finalizer)
+ * @param value input
+ * @return mixed value
+ */
+static uint64_t mix64(uint64_t value) {
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+/**
+ * @brief एक tile के content का hash compute करता है
+ * 
+ * Hash tile के index से seed होता है, इसलिए same pattern अलग tiles में
+ * अलग hash देता है। Row के cells 8-8 करके words में पढ़े जाते हैं (आखिरी
+ * अधूरे word के बाकी bytes 0)।
+ * 
+ * @param board source बोर्ड
+ * @param tile tile का index
+ * @return tile का hash
+ */
+static uint64_t board_hash_tile(const Board *board, size_t tile) {
+    const size_t x_begin = tile / board->tile_cols * BOARD_TILE_SIZE;
+    const size_t x_end = MIN(x_begin + BOARD_TILE_SIZE, board->height);
+    const size_t y_begin = tile % board->tile_cols * BOARD_TILE_SIZE;
+    const size_t span = MIN((size_t)BOARD_TILE_SIZE, board->width - y_begin);
+    const size_t words = (span + 7) / 8;
+    uint64_t row[BOARD_TILE_SIZE / 8];
+    uint64_t hash = mix64(tile + 1);
+    
+    row[words - 1] = 0;
+    for (size_t x = x_begin; x < x_end; x++) {
+        if (span == BOARD_TILE_SIZE) {
+            memcpy(row, &board->cells[BOARD_INDEX(board, x, y_begin)], BOARD_TILE_SIZE);
+        } else {
+            memcpy(row, &board->cells[BOARD_INDEX(board, x, y_begin)], span);
+        }
+        for (size_t w = 0; w < words; w++) {
+            hash = (hash ^ row[w]) * 0x9e3779b97f4a7c15ULL;
+            hash ^= hash >> 32;
+        }
+    }
+    return mix64(hash);
+}
+
+/**
+ * @brief बोर्ड के cells का 64-bit hash return करता है
+ * 
+ * Same stamp = same content, इसलिए जिन tiles का cached hash उनके current
+ * stamp का है वो दोबारा hash नहीं होतीं। front/back swap loop में एक
+ * stable tile हर बोर्ड में सिर्फ एक बार hash होती है।
+ * 
+ * @param board source बोर्ड
+ * @return hash (NULL होने पर 0)
+ */
+uint64_t board_hash(Board *board) {
+    if (board == NULL) return 0;
+    
+    uint64_t hash = 0;
+    for (size_t tile = 0; tile < board->tile_rows * board->tile_cols; tile++) {
+        BoardTileHash *cached = &board->tile_hash[tile];
+        if (cached->stamp != board->tile_stamp[tile]) {
+            cached->hash = board_hash_tile(board, tile);
+            cached->stamp = board->tile_stamp[tile];
+        }
+        hash += cached->hash;
+    }
+    return hash;
+}
+
+/**
+ * @brief tiles की एक row की next generation compute करता है
+ * 
+ * Active tiles recompute होती हैं; जिनका content बदला उन्हें नया stamp
+ * मिलता है, बाकी को board वाला stamp (content same है)। Inactive tiles
+ * में out का content पहले से सही है, सिर्फ stamp copy होता है। stats
+ * set हो तो बदली हुई tile उसी समय scan होती है जब उसकी rows cache में हैं।
+ * 
+ * @param board current generation का बोर्ड
+ * @param out output बोर्ड
+ * @param rules apply करने वाले rules
+ * @param kernel SIMD row kernel (NULL = scalar)
+ * @param tile_x tiles की row
+ * @param stamp इस step का नया stamp
+ * @param stats tile summaries भरने हैं या नहीं
+ * @param count SIMD count kernel (NULL = scalar)
+ */
+static void board_next_tile_row(Board *board, Board *out, Rules *rules, SimdRowKernel kernel,
+                                size_t tile_x, uint64_t stamp, int stats, SimdBlockCount count) {
+    const size_t cols = board->tile_cols;
+    size_t x_begin = tile_x * BOARD_TILE_SIZE;
+    size_t x_end = MIN(x_begin + BOARD_TILE_SIZE, board->height);
+    
+    for (size_t ty = 0; ty < cols; ty++) {
+        size_t tile = tile_x * cols + ty;
+        if (!board->tile_active[tile]) {
+            out->tile_stamp[tile] = board->tile_stamp[tile];
+            if (stats) board_keep_tile_stats(board, out, count, tile);
+            continue;
+        }
+        
+        size_t y_begin = ty * BOARD_TILE_SIZE;
+        size_t y_end = MIN(y_begin + BOARD_TILE_SIZE, board->width);
+        unsigned changed = 0;
+        if (rules->kernel == RULES_KERNEL_GENERATIONS) {
+            for (size_t x = x_begin; x < x_end; x++) {
+                changed |= board_next_span_states(board, out, rules, x, y_begin, y_end);
+            }
+        } else {
+            for (size_t x = x_begin; x < x_end; x++) {
+                changed |= kernel ? board_next_span_simd(board, out, rules, kernel, x, y_begin, y_end)
+                                  : board_next_span(board, out, rules, x, y_begin, y_end);
+            }
+        }
+        out->tile_stamp[tile] = changed ? stamp : board->tile_stamp[tile];
+        if (stats) {
+            if (changed) {
+                board_scan_tile(out, board, count, tile, &out->tile_stats[tile]);
+            } else {
+                board_keep_tile_stats(board, out, count, tile);
+            }
+        }
+    }
+}
+
+/**
+ * @brief step खत्म होने पर out का parent/version update करता है
+ * @param board current generation का बोर्ड
+ * @param out output बोर्ड (अब next generation)
+ */
+static void board_finish_step(Board *board, Board *out) {
+    out->version++;
+    out->parent = board;
+    out->parent_version = board->version;
 }
 
 /**
@@ -139,7 +939,10 @@ int is_cell_alive_next_gen(struct Board *board, Rules *rules, size_t x, size_t y
  * 
  * यह function current बोर्ड state को input के रूप में लेता है और
  * दिए गए rules के अनुसार next generation को output बोर्ड में calculate करता है।
- * Double buffering technique का उपयोग किया गया है।
+ * Double buffering technique का उपयोग किया गया है। Rules की compiled
+ * neighborhood table (देखें rules_compile) सीधे use होती है, इसलिए
+ * per-cell rules_apply call नहीं होता। Stable tiles skip होती हैं
+ * (देखें board_plan_tiles), इसलिए cost activity के proportional है।
  * 
  * @param board current generation का बोर्ड
  * @param out next generation store करने के लिए output बोर्ड
@@ -147,52 +950,472 @@ int is_cell_alive_next_gen(struct Board *board, Rules *rules, size_t x, size_t y
  * @return सफल होने पर 0, error होने पर -1
  */
 int board_next(Board *board, Board *out, Rules *rules) {
+    return board_next_parallel(board, out, rules, NULL);
+}
+
+/**
+ * @brief board_next_parallel के workers के लिए shared arguments
+ */
+typedef struct NextTask {
+    Board *board;
+    Board *out;
+    Rules *rules;
+    SimdRowKernel kernel;   /**< SIMD row kernel (NULL = scalar) */
+    uint64_t stamp;
+    int stats;              /**< Tile summaries भरने हैं या नहीं */
+    SimdBlockCount count;     /**< SIMD count kernel (NULL = scalar) */
+    size_t next_tile_row;   /**< अगली बची tile row (workers atomically लेते हैं) */
+} NextTask;
+
+/**
+ * @brief worker बची हुई tile rows एक-एक करके लेकर compute करता है
+ * 
+ * Tile rows dynamically बांटी जाती हैं ताकि जिन bands में activity ज्यादा
+ * है उनका काम सभी workers में balance हो जाए।
+ * 
+ * @param arg NextTask pointer
+ * @param worker_index worker का index (unused)
+ * @param num_workers कुल workers (unused)
+ */
+static void board_next_task(void *arg, int worker_index, int num_workers) {
+    (void)worker_index;
+    (void)num_workers;
+    NextTask *task = arg;
+    
+    for (;;) {
+        size_t tile_x = __atomic_fetch_add(&task->next_tile_row, 1, __ATOMIC_RELAXED);
+        if (tile_x >= task->board->tile_rows) break;
+        board_next_tile_row(task->board, task->out, task->rules, task->kernel, tile_x, task->stamp, task->stats, task->count);
+    }
+}
+
+/**
+ * @brief thread pool पर tile row bands में बांटकर अगली generation generate करता है
+ * 
+ * पहले single pass में तय होता है कौन सी tiles active हैं, फिर workers
+ * tile rows (BOARD_TILE_SIZE rows के bands) को आपस में बांटकर compute
+ * करते हैं। pool_run सभी bands पूरे होने पर return करता है, इसलिए caller
+ * इसके बाद सीधे front/back swap कर सकता है।
+ * 
+ * @param board current generation का बोर्ड
+ * @param out next generation store करने के लिए output बोर्ड
+ * @param rules apply करने वाले game rules
+ * @param pool persistent thread pool (NULL होने पर single-threaded)
+ * @return सफल होने पर 0, error होने पर -1
+ */
+int board_next_parallel(Board *board, Board *out, Rules *rules, ThreadPool *pool) {
+    return board_next_stats(board, out, rules, pool, NULL);
+}
+
+/**
+ * @brief अगली generation generate करता है और उसी pass में statistics भी देता है
+ * 
+ * Workers tile summaries out->tile_stats में भरते हैं (हर tile को एक ही
+ * worker लिखता है), और pool_run के बाद एक serial pass उन्हें जोड़ता है।
+ * इसलिए workers के बीच कोई shared counter या atomic नहीं है।
+ * 
+ * @param board current generation का बोर्ड
+ * @param out next generation store करने के लिए output बोर्ड
+ * @param rules apply करने वाले game rules
+ * @param pool persistent thread pool (NULL होने पर single-threaded)
+ * @param stats statistics store करने के लिए pointer (NULL = statistics नहीं)
+ * @return सफल होने पर 0, error होने पर -1
+ */
+int board_next_stats(Board *board, Board *out, Rules *rules, ThreadPool *pool, BoardStats *stats) {
     if (board == NULL || out == NULL || rules == NULL) return -1;
     if (board->width != out->width || board->height != out->height) return -1;
+    if (board == out || board->edge != out->edge) return -1;
+    // Byte sums dying states को भी गिनते
+    if (stats != NULL && rules->kernel == RULES_KERNEL_GENERATIONS) return -1;
     
-    // 1D array में single loop - better performance
-    for (size_t i = 0; i < board->width * board->height; i++) {
-        // 1D index को 2D coordinates में convert करें neighbor checking के लिए
-        size_t x = i / board->width;
-        size_t y = i % board->width;
-        
-        int cell_result;
-        int status = is_cell_alive_next_gen(board, rules, x, y, &cell_result);
-        if (status == -1) return -1; // Error from is_cell_alive_next_gen
-        
-        out->cells[i] = cell_result;
+    // Torus पर ghost cells सामने वाले किनारे की current cells होनी चाहिए
+    if (board->edge == BOARD_EDGE_TORUS && board_fill_halo(board) != 0) return -1;
+    
+    board_plan_tiles(board, out);
+    
+    // Kernel यहीं (workers शुरू होने से पहले) चुना जाता है; SIMD sums सिर्फ outer-totalistic rules पर
+    SimdRowKernel kernel = simd_row_kernel();
+    if (rules->kernel != RULES_KERNEL_TOTALISTIC) kernel = NULL;
+    NextTask task = { board, out, rules, kernel, next_stamp(), stats != NULL, simd_block_count(), 0 };
+    if (pool == NULL || pool_size(pool) <= 1 || board->tile_rows <= 1) {
+        board_next_task(&task, 0, 1);
+    } else if (pool_run(pool, board_next_task, &task) != 0) {
+        return -1;
     }
     
+    board_finish_step(board, out);
+    if (stats != NULL) board_reduce_stats(out, stats);
     return 0;
 }
 
 /**
- * @brief min और max के बीच random number generate करता है
- * @param min minimum value (inclusive)
- * @param max maximum value (inclusive)
- * @return min और max के बीच का random integer
+ * @brief board_step_n के एक pass (depth generations) की shared state
  */
-static int randint(int min, int max) {
-    return rand() % (max + 1 - min) + min;
+typedef struct StepTask {
+    Board *board;
+    Rules *rules;
+    SimdRowKernel kernel;   /**< SIMD row kernel (NULL = scalar) */
+    size_t depth;           /**< इस pass की generations (और blocks की halo) */
+    size_t tile_x;          /**< Compute हो रही tile row */
+    char *result;           /**< इस tile row का result (BOARD_TILE_SIZE rows, stride = width) */
+    const char *saved;      /**< Torus पर pass से पहले की rows [0, depth) (stride = width) */
+    char *blocks;           /**< हर worker के दो block buffers */
+    size_t block_stride;    /**< Block buffer की rows के बीच bytes */
+    size_t block_size;      /**< एक block buffer के bytes */
+    size_t next_block;      /**< अगला बचा column block (workers atomically लेते हैं) */
+} StepTask;
+
+/**
+ * @brief pass शुरू होने से पहले की global row x का pointer देता है
+ * 
+ * Tile rows in place लिखी जाती हैं, पर एक tile row का result तभी लिखा
+ * जाता है जब अगली tile row compute हो चुकी हो, इसलिए पड़ोसी tile rows
+ * अभी पुरानी हैं। Torus पर सिर्फ rows [0, depth) आखिरी tile rows तक
+ * overwrite हो चुकी होती हैं; वो pass की शुरुआत में saved में copy हैं।
+ * 
+ * @param task pass की state
+ * @param x global row (बोर्ड के बाहर भी हो सकती है)
+ * @return row के column 0 का pointer, dead edge पर बोर्ड के बाहर NULL
+ */
+static const char *board_step_source(const StepTask *task, ptrdiff_t x) {
+    const Board *board = task->board;
+    const ptrdiff_t height = (ptrdiff_t)board->height;
+    
+    if (board->edge != BOARD_EDGE_TORUS) {
+        return x < 0 || x >= height ? NULL : &board->cells[BOARD_INDEX(board, (size_t)x, 0)];
+    }
+    size_t row = (size_t)(((x % height) + height) % height);
+    return row < task->depth ? task->saved + row * board->width : &board->cells[BOARD_INDEX(board, row, 0)];
 }
 
 /**
- * @brief बोर्ड को random values से fill करता है
+ * @brief एक block को उसकी halo के साथ scratch में लाकर depth generations चलाता है
  * 
- * यह function बोर्ड के सभी cells को randomly जीवित या मृत state में
- * set करता है। जीवित होने की probability approximately 20% है।
+ * Scratch में block के चारों तरफ depth cells की halo है। Generation s
+ * पर सिर्फ वो cells compute होती हैं जो halo के अंदर s cells दूर हैं
+ * (उनके neighbors पिछली generation में valid थे), इसलिए depth generations
+ * बाद ठीक block valid रहता है। Dead edge पर बोर्ड के बाहर की cells कभी
+ * compute नहीं होतीं और दोनों buffers में 0 रहती हैं। पूरा input मृत हो
+ * और rules मृत neighborhood में जन्म न दें, तो stepping skip होती है।
  * 
- * @param board fill करने वाला बोर्ड
- * @return सफल होने पर 0, NULL pointer होने पर -1
+ * @param task pass की state
+ * @param block column block का index
+ * @param front पहला scratch buffer
+ * @param back दूसरा scratch buffer
  */
-int board_random_fill(Board *board) {
-    if (board == NULL) return -1;
+static void board_step_block(StepTask *task, size_t block, char *front, char *back) {
+    const Board *board = task->board;
+    const Rules *rules = task->rules;
+    const size_t depth = task->depth, stride = task->block_stride, width = board->width;
+    const size_t x0 = task->tile_x * BOARD_TILE_SIZE, y0 = block * BOARD_STEP_BLOCK;
+    const size_t block_rows = MIN((size_t)BOARD_TILE_SIZE, board->height - x0);
+    const size_t block_cols = MIN((size_t)BOARD_STEP_BLOCK, width - y0);
+    const size_t rows = block_rows + 2 * depth, cols = block_cols + 2 * depth;
+    const int torus = board->edge == BOARD_EDGE_TORUS;
     
-    // 1D array में single loop
-    for (size_t i = 0; i < board->width * board->height; i++) {
-        board->cells[i] = randint(0, 4) == 0;  // 20% chance of being alive
+    // बोर्ड के अंदर का local हिस्सा [row_lo, row_hi) x [col_lo, col_hi) (torus पर पूरा scratch)
+    const ptrdiff_t gx = (ptrdiff_t)x0 - (ptrdiff_t)depth, gy = (ptrdiff_t)y0 - (ptrdiff_t)depth;
+    size_t row_lo = 0, row_hi = rows, col_lo = 0, col_hi = cols;
+    if (!torus) {
+        row_lo = gx < 0 ? (size_t)-gx : 0;
+        row_hi = MIN(rows, (size_t)((ptrdiff_t)board->height - gx));
+        col_lo = gy < 0 ? (size_t)-gy : 0;
+        col_hi = MIN(cols, (size_t)((ptrdiff_t)width - gy));
     }
     
+    unsigned live = 0;
+    for (size_t i = 0; i < rows; i++) {
+        char *dst = front + i * stride;
+        const char *src = board_step_source(task, gx + (ptrdiff_t)i);
+        if (src == NULL) {
+            memset(dst, 0, cols);
+            continue;
+        }
+        if (torus) {
+            // Columns wrap होते हैं: row के अंत तक के segments में copy
+            size_t col = (size_t)((gy % (ptrdiff_t)width + (ptrdiff_t)width) % (ptrdiff_t)width);
+            for (size_t j = 0; j < cols;) {
+                size_t len = MIN(width - col, cols - j);
+                memcpy(dst + j, src + col, len);
+                j += len;
+                col = 0;
+            }
+        } else {
+            memset(dst, 0, col_lo);
+            memcpy(dst + col_lo, src + gy + (ptrdiff_t)col_lo, col_hi - col_lo);
+            memset(dst + col_hi, 0, cols - col_hi);
+        }
+        for (size_t j = 0; j < cols; j++) live |= (unsigned char)dst[j];
+    }
+    
+    char *result = task->result + y0;
+    if (live == 0 && rules->neighborhood[0] == 0) {
+        for (size_t i = 0; i < block_rows; i++) memset(result + i * width, 0, block_cols);
+        return;
+    }
+    // Dead edge के पास back के बाहर वाले cells भी पढ़े जाते हैं, उन्हें 0 होना चाहिए
+    if (row_lo > 0 || row_hi < rows || col_lo > 0 || col_hi < cols) memset(back, 0, task->block_size);
+    
+    // Scratch buffers के views; halo > 0 से span kernels ghost cells की तरह पड़ोसी cells पढ़ते हैं
+    Board cur = { .cells = front, .height = rows, .width = cols, .stride = stride, .halo = 1 };
+    Board next = { .cells = back, .height = rows, .width = cols, .stride = stride, .halo = 1 };
+    for (size_t s = 1; s <= depth; s++) {
+        size_t x_begin = MAX(s, row_lo), x_end = MIN(rows - s, row_hi);
+        size_t y_begin = MAX(s, col_lo), y_end = MIN(cols - s, col_hi);
+        for (size_t x = x_begin; x < x_end; x++) {
+            if (rules->kernel == RULES_KERNEL_GENERATIONS) {
+                board_next_span_states(&cur, &next, task->rules, x, y_begin, y_end);
+            } else if (task->kernel != NULL) {
+                board_next_span_simd(&cur, &next, task->rules, task->kernel, x, y_begin, y_end);
+            } else {
+                board_next_span(&cur, &next, task->rules, x, y_begin, y_end);
+            }
+        }
+        char *temp = cur.cells;
+        cur.cells = next.cells;
+        next.cells = temp;
+    }
+    
+    for (size_t i = 0; i < block_rows; i++) {
+        memcpy(result + i * width, cur.cells + (depth + i) * stride + depth, block_cols);
+    }
+}
+
+/**
+ * @brief worker बचे हुए column blocks एक-एक करके लेकर compute करता है
+ * @param arg StepTask pointer
+ * @param worker_index worker का index (अपने scratch buffers चुनने के लिए)
+ * @param num_workers कुल workers (unused)
+ */
+static void board_step_task(void *arg, int worker_index, int num_workers) {
+    (void)num_workers;
+    StepTask *task = arg;
+    char *front = task->blocks + 2 * (size_t)worker_index * task->block_size;
+    
+    for (;;) {
+        size_t block = __atomic_fetch_add(&task->next_block, 1, __ATOMIC_RELAXED);
+        if (block * BOARD_STEP_BLOCK >= task->board->width) break;
+        board_step_block(task, block, front, front + task->block_size);
+    }
+}
+
+/**
+ * @brief एक tile row का result बोर्ड में लिखता है और बदली tiles को stamp देता है
+ * @param board target बोर्ड
+ * @param result tile row का result (stride = width)
+ * @param tile_x tile row
+ * @param stamp बदली हुई tiles का नया stamp
+ * @return कोई tile बदली तो 1, वरना 0
+ */
+static int board_step_flush(Board *board, const char *result, size_t tile_x, uint64_t stamp) {
+    const size_t x_begin = tile_x * BOARD_TILE_SIZE;
+    const size_t x_end = MIN(x_begin + BOARD_TILE_SIZE, board->height);
+    int changed = 0;
+    
+    for (size_t ty = 0; ty < board->tile_cols; ty++) {
+        size_t y0 = ty * BOARD_TILE_SIZE;
+        size_t span = MIN((size_t)BOARD_TILE_SIZE, board->width - y0);
+        int tile_changed = 0;
+        for (size_t x = x_begin; x < x_end; x++) {
+            const char *src = result + (x - x_begin) * board->width + y0;
+            char *dst = &board->cells[BOARD_INDEX(board, x, y0)];
+            if (memcmp(dst, src, span) != 0) {
+                memcpy(dst, src, span);
+                tile_changed = 1;
+            }
+        }
+        if (tile_changed) {
+            board->tile_stamp[tile_x * board->tile_cols + ty] = stamp;
+            changed = 1;
+        }
+    }
+    return changed;
+}
+
+/**
+ * @brief बोर्ड को in place n generations आगे बढ़ाता है (temporal blocking)
+ * 
+ * board_step_n_parallel को pool के बिना call करता है।
+ * 
+ * @param board बोर्ड (result भी इसी में आता है)
+ * @param rules apply करने वाले rules
+ * @param n कितनी generations
+ * @return सफल होने पर 0, NULL pointer, negative n या memory error पर -1
+ */
+int board_step_n(Board *board, Rules *rules, long n) {
+    return board_step_n_parallel(board, rules, n, NULL);
+}
+
+/**
+ * @brief बोर्ड को in place n generations आगे बढ़ाता है, tile row के blocks workers में बांटकर
+ * 
+ * हर pass BOARD_STEP_DEPTH तक generations चलाता है (torus पर बोर्ड की
+ * ऊंचाई और चौड़ाई से ज्यादा नहीं, ताकि wrap हुई halo पड़ोसी tile rows तक
+ * ही पहुँचे)। Pass में tile rows ऊपर से नीचे compute होती हैं; हर tile
+ * row के column blocks आपस में independent हैं और workers में बंटते हैं।
+ * Tile row का result उसके नीचे वाली tile row compute होने के बाद बोर्ड
+ * में लिखा जाता है, क्योंकि उसकी halo को अभी पुरानी rows चाहिए।
+ * Scratch (दो tile row results, saved rows और हर worker के block buffers)
+ * बोर्ड के साथ एक बार allocate होता है और calls के बीच reuse होता है।
+ * 
+ * @param board बोर्ड (result भी इसी में आता है)
+ * @param rules apply करने वाले rules
+ * @param n कितनी generations
+ * @param pool workers का pool (NULL होने पर single-threaded)
+ * @return सफल होने पर 0, NULL pointer, negative n या memory error पर -1
+ */
+int board_step_n_parallel(Board *board, Rules *rules, long n, ThreadPool *pool) {
+    if (board == NULL || rules == NULL || n < 0) return -1;
+    if (n == 0 || board->height == 0 || board->width == 0) return 0;
+    
+    const size_t width = board->width;
+    const int workers = pool != NULL ? pool_size(pool) : 1;
+    const size_t block_stride = (BOARD_STEP_BLOCK + 2 * BOARD_STEP_DEPTH + BOARD_ROW_ALIGN - 1) /
+                                BOARD_ROW_ALIGN * BOARD_ROW_ALIGN;
+    const size_t block_size = (BOARD_TILE_SIZE + 2 * BOARD_STEP_DEPTH) * block_stride;
+    const size_t band_size = BOARD_TILE_SIZE * width;
+    const size_t needed = 2 * band_size + BOARD_STEP_DEPTH * width + 2 * (size_t)workers * block_size;
+    
+    if (board->step_scratch_size < needed) {
+        char *scratch = malloc(needed);
+        if (scratch == NULL) return -1;
+        free(board->step_scratch);
+        board->step_scratch = scratch;
+        board->step_scratch_size = needed;
+    }
+    char *results[2] = { board->step_scratch, board->step_scratch + band_size };
+    char *saved = board->step_scratch + 2 * band_size;
+    
+    // Kernel यहीं (workers शुरू होने से पहले) चुना जाता है; SIMD sums सिर्फ outer-totalistic rules पर
+    SimdRowKernel kernel = simd_row_kernel();
+    if (rules->kernel != RULES_KERNEL_TOTALISTIC) kernel = NULL;
+    const size_t blocks = (width + BOARD_STEP_BLOCK - 1) / BOARD_STEP_BLOCK;
+    int changed = 0;
+    
+    for (long done = 0; done < n;) {
+        size_t depth = (size_t)MIN(n - done, (long)BOARD_STEP_DEPTH);
+        if (board->edge == BOARD_EDGE_TORUS) {
+            depth = MIN(depth, MIN(board->height, width));
+            for (size_t x = 0; x < depth; x++) {
+                memcpy(saved + x * width, &board->cells[BOARD_INDEX(board, x, 0)], width);
+            }
+        }
+        
+        StepTask task = { board, rules, kernel, depth, 0, NULL, saved, saved + BOARD_STEP_DEPTH * width,
+                          block_stride, block_size, 0 };
+        uint64_t stamp = next_stamp();
+        for (size_t tx = 0; tx < board->tile_rows; tx++) {
+            task.tile_x = tx;
+            task.result = results[tx & 1];
+            task.next_block = 0;
+            if (pool == NULL || workers <= 1 || blocks <= 1) {
+                board_step_task(&task, 0, 1);
+            } else if (pool_run(pool, board_step_task, &task) != 0) {
+                return -1;
+            }
+            if (tx > 0) changed |= board_step_flush(board, results[(tx - 1) & 1], tx - 1, stamp);
+        }
+        changed |= board_step_flush(board, results[(board->tile_rows - 1) & 1], board->tile_rows - 1, stamp);
+        done += (long)depth;
+    }
+    
+    // Content अब किसी parent की next generation नहीं है
+    board->parent = NULL;
+    if (changed) board->version++;
+    return 0;
+}
+
+/**
+ * @brief board_random_fill के workers के लिए shared arguments
+ */
+typedef struct RandomFillTask {
+    Board *board;           /**< Target बोर्ड */
+    const RngFill *fill;    /**< Seed और density */
+    int num_bands;          /**< Row bands की संख्या */
+} RandomFillTask;
+
+/**
+ * @brief बोर्ड की rows [begin, end) random भरता है
+ *
+ * हर 64 cells का word एक बार बनता है और फिर 8 cells के groups में bytes
+ * में फैलता है: byte k में सिर्फ bit k रखकर उसे 0/1 किया जाता है।
+ *
+ * @param board target बोर्ड
+ * @param fill seed और density
+ * @param begin पहली row (inclusive)
+ * @param end आखिरी row (exclusive)
+ */
+static void board_random_rows(Board *board, const RngFill *fill, size_t begin, size_t end) {
+    const uint64_t spread = 0x0101010101010101ULL, select = 0x8040201008040201ULL;
+    const uint64_t low7 = 0x7f7f7f7f7f7f7f7fULL;
+
+    for (size_t x = begin; x < end; x++) {
+        char *row = &board->cells[BOARD_INDEX(board, x, 0)];
+        for (size_t base = 0; base < board->width; base += 64) {
+            uint64_t bits = rng_fill_word(fill, x, base / 64);
+            size_t count = board->width - base < 64 ? board->width - base : 64;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            if (count == 64) {
+                for (size_t j = 0; j < 64; j += 8) {
+                    uint64_t bytes = ((((bits >> j) & 0xff) * spread & select) + low7) >> 7 & spread;
+                    memcpy(&row[base + j], &bytes, sizeof(bytes));
+                }
+                continue;
+            }
+#endif
+            for (size_t j = 0; j < count; j++) {
+                row[base + j] = (char)((bits >> j) & 1);
+            }
+        }
+    }
+}
+
+/**
+ * @brief pool worker: अपने row band को random भरता है
+ * @param arg RandomFillTask pointer
+ * @param worker_index worker का index
+ * @param num_workers कुल workers (unused)
+ */
+static void board_random_task(void *arg, int worker_index, int num_workers) {
+    (void)num_workers;
+    RandomFillTask *task = arg;
+    if (worker_index >= task->num_bands) return;
+
+    size_t height = task->board->height;
+    size_t begin = height * (size_t)worker_index / (size_t)task->num_bands;
+    size_t end = height * (size_t)(worker_index + 1) / (size_t)task->num_bands;
+    board_random_rows(task->board, task->fill, begin, end);
+}
+
+/**
+ * @brief बोर्ड को seed से दी गई density पर random भरता है
+ *
+ * Rows workers के बीच bands में बंटती हैं; हर cell सिर्फ seed, row और
+ * column से बनता है, इसलिए bands की संख्या से output नहीं बदलता।
+ *
+ * @param board fill करने वाला बोर्ड
+ * @param seed random seed
+ * @param density जीवित cells का fraction (0 से 1, देखें RNG_DEFAULT_DENSITY)
+ * @param pool workers का pool (NULL होने पर single-threaded)
+ * @return सफल होने पर 0, NULL pointer या density range के बाहर होने पर -1
+ */
+int board_random_fill(Board *board, uint64_t seed, double density, ThreadPool *pool) {
+    if (board == NULL) return -1;
+
+    RngFill fill;
+    if (rng_fill_init(&fill, seed, density) != 0) return -1;
+
+    int num_bands = pool_size(pool);
+    if ((size_t)num_bands > board->height) num_bands = (int)board->height;
+
+    if (pool == NULL || num_bands <= 1) {
+        board_random_rows(board, &fill, 0, board->height);
+    } else {
+        RandomFillTask task = { board, &fill, num_bands };
+        if (pool_run(pool, board_random_task, &task) != 0) return -1;
+    }
+
+    board_mark_all_dirty(board);
     return 0;
 }
 
@@ -208,61 +1431,82 @@ int board_random_fill(Board *board) {
 int board_clear(Board *board) {
     if (board == NULL) return -1;
     
-    for (size_t i = 0; i < board->width * board->height; i++) {
-        board->cells[i] = 0;
+    for (size_t x = 0; x < board->height; x++) {
+        memset(&board->cells[BOARD_INDEX(board, x, 0)], 0, board->width);
     }
     
+    board_mark_all_dirty(board);
     return 0;
 }
 
 /**
- * @brief text file से बोर्ड pattern load करता है
+ * @brief pattern file से बोर्ड load करता है
  * 
- * यह function text file से pattern read करके बोर्ड में load करता है।
- * File format: '0' = मृत cell, कोई भी अन्य character = जीवित cell।
- * प्रत्येक line एक row represent करती है।
+ * Format (plain text, RLE या Macrocell) content से पहचाना जाता है;
+ * parsing pattern_load में है। Plain text में '0' = मृत cell और कोई भी
+ * अन्य character = जीवित cell, प्रत्येक line एक row। बोर्ड से बड़े
+ * patterns clip होते हैं।
  * 
  * @param filename load करने वाली file का नाम
  * @param board target बोर्ड जहाँ pattern load करना है
- * @return सफल होने पर 0, file error या bounds error होने पर -1
+ * @return सफल होने पर 0, file या format error होने पर -1
  */
 int board_from_file(char *filename, Board *board) {
+    return pattern_load(filename, board);
+}
+
+/**
+ * @brief pattern file का size पता करता है ताकि बोर्ड उसी size का बनाया जा सके
+ * 
+ * Plain text में height = lines की संख्या (आखिरी line newline के बिना भी
+ * गिनी जाती है) और width = सबसे लंबी line की length ('\r' line ending
+ * ignore होती है)। RLE में header का size, Macrocell में जीवित cells का
+ * bounding box।
+ * 
+ * @param filename pattern file का नाम
+ * @param height rows की संख्या store करने के लिए pointer
+ * @param width columns की संख्या store करने के लिए pointer
+ * @return सफल होने पर 0, NULL pointer या file error होने पर -1
+ */
+int board_file_dimensions(const char *filename, size_t *height, size_t *width) {
+    return pattern_dimensions(filename, height, width);
+}
+
+/**
+ * @brief बोर्ड को text file में लिखता है
+ * 
+ * Format वही है जो board_from_file पढ़ता है: हर row एक line है,
+ * '1' = जीवित cell और '0' = मृत cell। हर row पहले एक line buffer में
+ * बनती है ताकि हर cell के लिए अलग I/O call न हो।
+ * 
+ * @param filename लिखने वाली file का नाम
+ * @param board source बोर्ड
+ * @return सफल होने पर 0, file error या memory allocation fail होने पर -1
+ */
+int board_to_file(const char *filename, Board *board) {
     if (filename == NULL || board == NULL) return -1;
     
-    FILE *file = NULL;
-    file = fopen(filename, "r");
-
-    // अगर file open नहीं हो सकी
+    FILE *file = fopen(filename, "w");
     if (file == NULL) return -1;
-
-    // पहले बोर्ड को clear करें
-    board_clear(board);
-
-    // प्रत्येक character read करें
-    char c = 0;
-    size_t x = 0, y = 0;
-
-    while ((c = fgetc(file)) != EOF) {
-        if (c == '\n') {
-            y = 0;
-            x++;
-            continue;
-        }
-
-        // bounds check करें
-        if (x >= board->height || y >= board->width) {
-            fclose(file);
-            return -1;
+    
+    // एक row + newline के लिए buffer
+    char *line = malloc(board->width + 1);
+    if (line == NULL) {
+        fclose(file);
+        return -1;
+    }
+    
+    int status = 0;
+    for (size_t x = 0; x < board->height && status == 0; x++) {
+        const char *row = &board->cells[BOARD_INDEX(board, x, 0)];
+        for (size_t y = 0; y < board->width; y++) {
+            line[y] = row[y] == 1 ? '1' : '0';
         }
-
-        // 2D coordinates को 1D index में convert करें
-        size_t index = x * board->width + y;
-        // '0' को छोड़कर सभी characters को जीवित cell माना जाता है
-        board->cells[index] = c != '0'; 
-        y++;
+        line[board->width] = '\n';
+        if (fwrite(line, 1, board->width + 1, file) != board->width + 1) status = -1;
     }
-
-    // file close करें और success return करें
-    fclose(file);
-    return 0;
+    
+    free(line);
+    if (fclose(file) != 0) status = -1;
+    return status;
 }
@@ -11,21 +11,143 @@
 #ifndef BOARD_H
 #define BOARD_H
 
+#include <stdint.h>
 #include <string.h>  // For memcpy in COPY_CELL macro
 #include "rules.h"   // Include rules system
+#include "pool.h"    // Parallel stepping के लिए thread pool
+#include "arena.h"   // Arena में allocate होने वाले boards
+
+/**
+ * @brief बोर्ड के किनारों का behavior
+ */
+typedef enum BoardEdge {
+    BOARD_EDGE_DEAD = 0,    /**< बोर्ड के बाहर की cells हमेशा मृत */
+    BOARD_EDGE_TORUS        /**< किनारे wrap होते हैं (ऊपर-नीचे और बाएं-दाएं जुड़े) */
+} BoardEdge;
+
+/**
+ * @brief एक tile के cells का summary (board_next_stats का per-tile result)
+ *
+ * Population और bounds उस content के हैं जिसका stamp इसमें है; stamps
+ * content-unique हैं, इसलिए जब तक tile का stamp न बदले, यह summary
+ * फिर से scan किए बिना reuse हो सकता है।
+ */
+typedef struct BoardTileStats {
+    uint64_t stamp;         /**< जिस tile stamp के लिए population और bounds valid हैं (0 = कोई नहीं) */
+    uint32_t population;    /**< जीवित cells */
+    uint32_t births;        /**< आखिरी step में जन्मी cells */
+    uint32_t deaths;        /**< आखिरी step में मरी cells */
+    uint8_t min_x;          /**< Tile के अंदर जीवित cells की पहली row (population > 0 पर) */
+    uint8_t max_x;          /**< आखिरी row */
+    uint8_t min_y;          /**< पहला column */
+    uint8_t max_y;          /**< आखिरी column */
+} BoardTileStats;
+
+/**
+ * @brief एक tile के content का cached hash (board_hash)
+ */
+typedef struct BoardTileHash {
+    uint64_t stamp;         /**< जिस tile stamp का hash है (0 = कोई नहीं) */
+    uint64_t hash;          /**< Tile के content और position का hash */
+} BoardTileHash;
+
+/**
+ * @brief एक generation के statistics (board_next_stats)
+ */
+typedef struct BoardStats {
+    uint64_t population;    /**< Next generation के जीवित cells */
+    uint64_t births;        /**< मृत से जीवित हुई cells */
+    uint64_t deaths;        /**< जीवित से मृत हुई cells */
+    size_t min_x;           /**< जीवित cells के bounding box की पहली row (population 0 पर सभी bounds 0) */
+    size_t max_x;           /**< Bounding box की आखिरी row (inclusive) */
+    size_t min_y;           /**< Bounding box का पहला column */
+    size_t max_y;           /**< Bounding box का आखिरी column (inclusive) */
+} BoardStats;
 
 /**
  * @brief गेम बोर्ड स्ट्रक्चर जो सभी cells को store करता है
  * 
  * यह स्ट्रक्चर गेम के grid को represent करता है। Memory efficiency के लिए
- * 1D array का उपयोग किया गया है instead of 2D array।
+ * 1D array का उपयोग किया गया है instead of 2D array। Row का pitch stride
+ * है (width से बड़ा हो सकता है), इसलिए cell (x, y) हमेशा
+ * cells[BOARD_INDEX(board, x, y)] पर है।
+ *
+ * board_init_padded से बने बोर्ड के चारों तरफ एक cell का ghost border
+ * (halo) होता है: rows -1 और height, columns -1 और width भी valid memory
+ * हैं। Dead edges पर ghost cells 0 रहती हैं, torus पर board_fill_halo
+ * उन्हें सामने वाले किनारे से भरता है। इससे stepping kernels में कोई
+ * edge branch नहीं रहता।
  */
 typedef struct Board {
-    char *cells;        /**< सेल्स का 1D array (0=मृत, 1=जीवित) */
+    char *cells;        /**< Cell (0, 0) का pointer (0=मृत, 1=जीवित) */
     size_t height;      /**< बोर्ड की ऊंचाई */
     size_t width;       /**< बोर्ड की चौड़ाई */
+    size_t stride;      /**< एक row से अगली row तक bytes */
+    size_t halo;        /**< Ghost border की चौड़ाई (0 या BOARD_HALO) */
+    BoardEdge edge;     /**< किनारों का behavior */
+    char *storage;      /**< Allocated buffer (halo सहित) */
+    size_t tile_rows;   /**< Tiles की rows (BOARD_TILE_SIZE cells प्रति tile) */
+    size_t tile_cols;   /**< Tiles के columns */
+    uint64_t *tile_stamp;         /**< हर tile के content का stamp: same stamp = same content */
+    uint8_t *tile_active;         /**< Stepping scratch: इस step में tile recompute होगी या नहीं */
+    BoardTileStats *tile_stats;   /**< हर tile का summary (board_next_stats भरता है) */
+    BoardTileHash *tile_hash;     /**< हर tile का cached hash (board_hash भरता है) */
+    const struct Board *parent;   /**< जिस बोर्ड से यह generation compute हुई (NULL = कोई नहीं) */
+    uint64_t parent_version;      /**< Compute के समय parent का version */
+    uint64_t version;             /**< Content बदलने पर हर बार increment होता है */
+    char *step_scratch;           /**< board_step_n के blocks और bands का buffer (पहली call पर allocate) */
+    size_t step_scratch_size;     /**< step_scratch के bytes */
+    char *text_frame;             /**< board_print का frame buffer (पहली call पर allocate, बाद में reuse) */
+    size_t text_frame_size;       /**< text_frame के bytes */
+    Arena *arena;                 /**< जिस arena में बोर्ड की memory है (NULL = heap, board_free free करता है) */
 } Board;
 
+/**
+ * @brief Dirty-region tracking के लिए tile का size (cells में, square)
+ *
+ * हर tile का एक stamp होता है जो tile का content बदलने पर नया हो जाता
+ * है। Stepping में जिस tile और उसके आठ neighbor tiles के stamps पिछली
+ * generation जैसे हैं, वो recompute नहीं होती, और renderer सिर्फ बदले
+ * हुए stamps वाली tiles फिर से draw करता है।
+ */
+#define BOARD_TILE_SIZE 64
+
+/**
+ * @brief board_init_padded के ghost border की चौड़ाई (cells में)
+ */
+#define BOARD_HALO 1
+
+/**
+ * @brief Padded बोर्ड का stride इसका multiple होता है (rows vector-friendly रहती हैं)
+ */
+#define BOARD_ROW_ALIGN 16
+
+/**
+ * @brief board_step_n का एक pass ज्यादा से ज्यादा इतनी generations चलाता है
+ *
+ * हर block के चारों तरफ इतनी ही cells की halo scratch में आती है। बड़ी
+ * depth = कम DRAM passes, पर halo का redundant compute ज्यादा।
+ */
+#define BOARD_STEP_DEPTH 8
+
+/**
+ * @brief board_step_n के block की चौड़ाई (cells में, BOARD_TILE_SIZE का multiple)
+ *
+ * Block की ऊंचाई एक tile row (BOARD_TILE_SIZE) है; दोनों scratch buffers
+ * मिलकर L2 cache में रहते हैं।
+ */
+#define BOARD_STEP_BLOCK 1024
+
+/**
+ * @brief Cell (x, y) का cells array में index
+ * @param board बोर्ड
+ * @param x row
+ * @param y column
+ *
+ * Ghost cells तक row pointer से ±stride और ±1 offset से पहुँचें।
+ */
+#define BOARD_INDEX(board, x, y) ((x) * (board)->stride + (y))
+
 /**
  * @brief सेल को terminal में print करने के लिए macro
  * @param dest गंतव्य buffer
@@ -43,9 +165,80 @@ typedef struct Board {
 Board *board_init(size_t height, size_t width);
 
 /**
- * @brief बोर्ड को terminal में print करता है
+ * @brief ghost border (halo) और padded stride वाला नया बोर्ड initialize करता है
+ *
+ * Stepping kernels ghost rows/columns को सीधे पढ़ते हैं, इसलिए किनारों
+ * के लिए अलग code path नहीं चाहिए। BOARD_EDGE_TORUS पर हर step से पहले
+ * ghost cells सामने वाले किनारे से भरे जाते हैं।
+ *
+ * @param height बोर्ड की ऊंचाई
+ * @param width बोर्ड की चौड़ाई
+ * @param edge किनारों का behavior
+ * @return सफल होने पर Board pointer, असफल होने पर NULL
+ */
+Board *board_init_padded(size_t height, size_t width, BoardEdge edge);
+
+/**
+ * @brief board_init_arena के एक बोर्ड को arena में चाहिए bytes
+ * @param height बोर्ड की ऊंचाई
+ * @param width बोर्ड की चौड़ाई
+ * @return arena capacity में जोड़ने वाले bytes
+ */
+size_t board_arena_size(size_t height, size_t width);
+
+/**
+ * @brief arena में padded बोर्ड बनाता है (board_init_padded जैसा layout)
+ *
+ * बोर्ड की सारी memory arena की है और arena_free के साथ जाती है;
+ * board_free फिर भी call किया जा सकता है (सिर्फ step scratch free होता है)।
+ *
+ * @param arena source arena
+ * @param height बोर्ड की ऊंचाई
+ * @param width बोर्ड की चौड़ाई
+ * @param edge किनारों का behavior
+ * @return सफल होने पर Board pointer, असफल होने पर NULL
+ */
+Board *board_init_arena(Arena *arena, size_t height, size_t width, BoardEdge edge);
+
+/**
+ * @brief ghost cells को edge mode के अनुसार भरता है
+ *
+ * Torus पर हर ghost cell सामने वाले किनारे की cell की copy बनती है
+ * (corners diagonal वाली corner की), dead edges पर सभी 0 होते हैं।
+ * board_next इसे automatically call करता है; cells directly पढ़ने वाले
+ * code को edits के बाद इसे खुद call करना चाहिए।
+ *
+ * @param board halo वाला बोर्ड
+ * @return सफल होने पर 0, NULL या halo के बिना बोर्ड होने पर -1
+ */
+int board_fill_halo(Board *board);
+
+/**
+ * @brief board_format_text के frame के ज्यादा से ज्यादा bytes
+ * @param board source बोर्ड
+ * @return buffer का जरूरी size
+ */
+size_t board_text_size(const Board *board);
+
+/**
+ * @brief पूरे बोर्ड का text frame (██ और "  ", हर row के बाद newline) buffer में बनाता है
+ *
+ * बार-बार print करने वाले callers एक ही buffer reuse कर सकते हैं।
+ *
+ * @param board source बोर्ड
+ * @param buffer कम से कम board_text_size bytes का buffer
+ * @return लिखे गए bytes (कोई null terminator नहीं)
+ */
+size_t board_format_text(const Board *board, char *buffer);
+
+/**
+ * @brief बोर्ड को terminal में print करता है (पूरा frame एक write में)
+ *
+ * Frame बोर्ड के अपने buffer में बनता है, जो पहली call पर allocate होकर
+ * बाद की calls में reuse होता है।
+ *
  * @param board प्रिंट करने वाला बोर्ड
- * @return सफल होने पर 0, असफल होने पर -1
+ * @return सफल होने पर 0, memory allocation या write fail होने पर -1
  */
 int board_print(Board *board);
 
@@ -69,6 +262,11 @@ int is_cell_alive_next_gen(struct Board *board, Rules *rules, size_t x, size_t y
 
 /**
  * @brief specified rules का उपयोग करके अगली generation generate करता है
+ *
+ * अगर out ही board का parent है (सामान्य front/back swap loop), तो सिर्फ
+ * वो tiles recompute होती हैं जो पिछली generation में बदलीं या किसी बदली
+ * हुई tile के बगल में हैं; बाकी tiles में out पहले से सही content रखता है।
+ *
  * @param board current बोर्ड
  * @param out output बोर्ड जहाँ next generation store होगी
  * @param rules apply करने वाले rules
@@ -77,20 +275,180 @@ int is_cell_alive_next_gen(struct Board *board, Rules *rules, size_t x, size_t y
 int board_next(Board *board, Board *out, Rules *rules);
 
 /**
- * @brief बोर्ड को random values से fill करता है
- * @param board fill करने वाला बोर्ड
+ * @brief thread pool पर row bands में बांटकर अगली generation generate करता है
+ *
+ * हर output row सिर्फ input की तीन rows पर depend करती है, इसलिए बोर्ड को
+ * workers के बीच row bands में बांटा जाता है। pool_run हर generation के
+ * अंत में barrier का काम करता है। pool NULL होने पर board_next जैसा है।
+ *
+ * @param board current बोर्ड
+ * @param out output बोर्ड जहाँ next generation store होगी
+ * @param rules apply करने वाले rules
+ * @param pool workers का pool (main में एक बार बनाया गया)
  * @return सफल होने पर 0, असफल होने पर -1
  */
-int board_random_fill(Board *board);
+int board_next_parallel(Board *board, Board *out, Rules *rules, ThreadPool *pool);
+
+/**
+ * @brief अगली generation generate करता है और उसी pass में statistics भी देता है
+ *
+ * हर बदली हुई tile compute होने के तुरंत बाद (जब उसकी rows cache में
+ * हैं) SIMD byte sums (सिर्फ scalar CPUs पर 8 cells प्रति word) से गिनी
+ * जाती है: population, births, deaths और bounding box। Skip हुई tiles का content नहीं बदला,
+ * इसलिए उनका पिछला summary (stamp match होने पर) बिना scan के reuse होता
+ * है। stats NULL होने पर यह board_next_parallel जैसा ही है, per-tile सिर्फ
+ * एक branch का खर्च। Byte sums cell values गिनते हैं, इसलिए statistics
+ * सिर्फ two-state rules पर मिलते हैं।
+ *
+ * @param board current बोर्ड
+ * @param out output बोर्ड जहाँ next generation store होगी
+ * @param rules apply करने वाले rules
+ * @param pool workers का pool (NULL होने पर single-threaded)
+ * @param stats statistics store करने के लिए pointer (NULL = statistics नहीं)
+ * @return सफल होने पर 0, असफल या Generations rules के साथ stats होने पर -1
+ */
+int board_next_stats(Board *board, Board *out, Rules *rules, ThreadPool *pool, BoardStats *stats);
 
 /**
- * @brief file से बोर्ड load करता है
+ * @brief बोर्ड को in place n generations आगे बढ़ाता है (temporal blocking)
+ *
+ * board_next हर generation में पूरा बोर्ड memory से एक बार पढ़ता और
+ * लिखता है, इसलिए cache से बड़े बोर्ड bandwidth-bound हो जाते हैं। यहाँ
+ * बोर्ड blocks में बंटता है और हर block अपनी BOARD_STEP_DEPTH cells की
+ * halo के साथ cache-resident scratch में copy होकर वहीं कई generations
+ * चलता है (हर generation के बाद valid हिस्सा एक cell सिकुड़ता है, यानी
+ * trapezoid)। इससे हर BOARD_STEP_DEPTH generations पर बोर्ड memory से
+ * सिर्फ एक बार गुजरता है। Result board_next के loop जैसा ही है।
+ *
+ * बदली हुई tiles को नया stamp मिलता है। पूरी तरह मृत regions (B0 के
+ * बिना) compute नहीं होतीं, पर बाकी सभी blocks हर pass में compute होती
+ * हैं, इसलिए बहुत sparse activity पर board_next का tile skipping बेहतर है।
+ *
+ * @param board बोर्ड (result भी इसी में आता है)
+ * @param rules apply करने वाले rules
+ * @param n कितनी generations
+ * @return सफल होने पर 0, NULL pointer, negative n या memory error पर -1
+ */
+int board_step_n(Board *board, Rules *rules, long n);
+
+/**
+ * @brief board_step_n, पर हर tile row के blocks thread pool के workers में बंटते हैं
+ * @param board बोर्ड (result भी इसी में आता है)
+ * @param rules apply करने वाले rules
+ * @param n कितनी generations
+ * @param pool workers का pool (NULL होने पर single-threaded)
+ * @return सफल होने पर 0, NULL pointer, negative n या memory error पर -1
+ */
+int board_step_n_parallel(Board *board, Rules *rules, long n, ThreadPool *pool);
+
+/**
+ * @brief current generation की population और bounding box देता है (births/deaths 0)
+ *
+ * Tile summaries valid हों तो reuse होते हैं, वरना tiles scan होती हैं।
+ *
+ * @param board source बोर्ड
+ * @param stats statistics store करने के लिए pointer
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int board_stats(Board *board, BoardStats *stats);
+
+/**
+ * @brief बोर्ड के cells का 64-bit hash return करता है
+ *
+ * Hash हर tile के hash (content और tile की position) का sum है। Tile
+ * hashes उनके stamp के साथ cache होते हैं, इसलिए सिर्फ वो tiles फिर से
+ * hash होती हैं जिनका stamp पिछली call के बाद बदला; stable बोर्ड पर
+ * यह लगभग free है। Same cells वाले same size के बोर्ड्स का hash same
+ * होता है (ghost cells शामिल नहीं)।
+ *
+ * @param board source बोर्ड
+ * @return hash (NULL होने पर 0)
+ */
+uint64_t board_hash(Board *board);
+
+/**
+ * @brief (x, y) cell वाली tile को changed mark करता है
+ *
+ * cells को directly बदलने के बाद यह call करना जरूरी है, वरना stepping
+ * उस tile को stable मानकर skip कर सकती है और renderer उसे redraw नहीं करेगा।
+ *
+ * @param board target बोर्ड
+ * @param x बदली गई cell की row
+ * @param y बदली गई cell का column
+ * @return सफल होने पर 0, out of bounds होने पर -1
+ */
+int board_mark_dirty(Board *board, size_t x, size_t y);
+
+/**
+ * @brief बोर्ड की सभी tiles को changed mark करता है (पूरा बोर्ड बदलने के बाद)
+ * @param board target बोर्ड
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int board_mark_all_dirty(Board *board);
+
+/**
+ * @brief एक बोर्ड का content दूसरे (same size के) बोर्ड में copy करता है
+ *
+ * सिर्फ वो tiles copy होती हैं जिनका stamp dst में src से अलग है;
+ * stamps भी copy होते हैं, इसलिए renderer बिना बदली tiles redraw नहीं करता।
+ *
+ * @param dst target बोर्ड
+ * @param src source बोर्ड
+ * @return सफल होने पर 0, NULL pointer या dimensions अलग होने पर -1
+ */
+int board_copy(Board *dst, const Board *src);
+
+/**
+ * @brief tile (tile_x, tile_y) का stamp return करता है
+ * @param board source बोर्ड
+ * @param tile_x tile की row
+ * @param tile_y tile का column
+ * @return tile का stamp
+ */
+static inline uint64_t board_tile_stamp(const Board *board, size_t tile_x, size_t tile_y) {
+    return board->tile_stamp[tile_x * board->tile_cols + tile_y];
+}
+
+/**
+ * @brief बोर्ड को seed से दी गई density पर random भरता है
+ *
+ * Cells rng_fill_word से आते हैं, इसलिए same seed और density का बोर्ड
+ * thread count पर depend नहीं करता और rng_fill_rows से भरे same size के
+ * PackedBoard जैसा ही होता है।
+ *
+ * @param board fill करने वाला बोर्ड
+ * @param seed random seed
+ * @param density जीवित cells का fraction (0 से 1, देखें RNG_DEFAULT_DENSITY)
+ * @param pool workers का pool (NULL होने पर single-threaded)
+ * @return सफल होने पर 0, NULL pointer या density range के बाहर होने पर -1
+ */
+int board_random_fill(Board *board, uint64_t seed, double density, ThreadPool *pool);
+
+/**
+ * @brief file से बोर्ड load करता है (plain text, RLE या Macrocell; बड़े patterns clip होते हैं)
  * @param filename load करने वाली file का नाम
  * @param board target बोर्ड
  * @return सफल होने पर 0, असफल होने पर -1
  */
 int board_from_file(char *filename, Board *board);
 
+/**
+ * @brief pattern file का size (lines की संख्या और सबसे लंबी line) पता करता है
+ * @param filename pattern file का नाम
+ * @param height rows की संख्या store करने के लिए pointer
+ * @param width columns की संख्या store करने के लिए pointer
+ * @return सफल होने पर 0, file error होने पर -1
+ */
+int board_file_dimensions(const char *filename, size_t *height, size_t *width);
+
+/**
+ * @brief बोर्ड को file में उसी text format में लिखता है जो board_from_file पढ़ता है
+ * @param filename लिखने वाली file का नाम
+ * @param board source बोर्ड
+ * @return सफल होने पर 0, असफल होने पर -1
+ */
+int board_to_file(const char *filename, Board *board);
+
 /**
  * @brief बोर्ड के सभी cells को clear करता है (सभी को मृत बनाता है)
  * @param board clear करने वाला बोर्ड
@@ -0,0 +1,420 @@
+/**
+ * @file checkpoint.c
+ * @brief बोर्ड के binary checkpoints (save/restore) का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Payload पहले memory में बनता है (बोर्ड का 1/8 या उससे कम), ताकि
+ * header में उसका size और checksum लिखा जा सके। Runs encoding को भी उतनी ही
+ * memory मिलती है; उससे बड़ी हो जाए तो bits encoding use होती है।
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "checkpoint.h"
+
+/**
+ * @brief Header का size bytes में
+ *
+ * Layout: magic[8], version u32, encoding u32, height u64, width u64,
+ * generation u64, birth u16, survival u16, edge u8, reserved[3],
+ * payload size u64, payload checksum u32, reserved u32, rule name[64],
+ * birth exclusions u16[9], survival exclusions u16[9], reserved[28]।
+ */
+#define CHECKPOINT_HEADER_SIZE 192
+
+/**
+ * @brief Version 1 header का size (rule name तक)
+ */
+#define CHECKPOINT_V1_HEADER_SIZE 128
+
+/**
+ * @brief एक LEB128 varint (uint64_t) की maximum bytes
+ */
+#define CHECKPOINT_VARINT_MAX 10
+
+/**
+ * @brief Payload की encodings
+ */
+enum {
+    CHECKPOINT_BITS = 0,    /**< हर row ceil(width / 8) bytes */
+    CHECKPOINT_RUNS = 1     /**< Alternating मृत/जीवित runs, varint lengths */
+};
+
+/**
+ * @brief little-endian में n bytes लिखता है
+ * @param p destination
+ * @param value लिखने वाली value
+ * @param n bytes की संख्या
+ */
+static void put_le(uint8_t *p, uint64_t value, int n) {
+    for (int i = 0; i < n; i++) {
+        p[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+/**
+ * @brief little-endian में n bytes पढ़ता है
+ * @param p source
+ * @param n bytes की संख्या
+ * @return पढ़ी गई value
+ */
+static uint64_t get_le(const uint8_t *p, int n) {
+    uint64_t value = 0;
+    for (int i = 0; i < n; i++) {
+        value |= (uint64_t)p[i] << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * @brief payload का FNV-1a checksum
+ * @param data payload
+ * @param size payload का size
+ * @return 32-bit checksum
+ */
+static uint32_t checkpoint_checksum(const uint8_t *data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief bits encoding में एक row के bytes
+ * @param width बोर्ड की चौड़ाई
+ * @return bytes की संख्या
+ */
+static size_t checkpoint_row_bytes(size_t width) {
+    return width / 8 + (width % 8 != 0);
+}
+
+/**
+ * @brief payload में एक run length varint के रूप में जोड़ता है
+ * @param out payload buffer
+ * @param size buffer में अभी तक लिखे bytes (आगे बढ़ता है)
+ * @param limit buffer का size
+ * @param run run की length
+ * @return सफल होने पर 0, buffer में जगह न हो तो -1
+ */
+static int put_varint(uint8_t *out, size_t *size, size_t limit, uint64_t run) {
+    if (limit - *size < CHECKPOINT_VARINT_MAX) return -1;
+
+    do {
+        uint8_t byte = run & 0x7F;
+        run >>= 7;
+        out[(*size)++] = byte | (run ? 0x80 : 0);
+    } while (run);
+    return 0;
+}
+
+/**
+ * @brief बोर्ड को runs encoding में लिखता है
+ * @param board source बोर्ड
+ * @param out payload buffer
+ * @param limit buffer का size (runs इससे छोटे ही accept होते हैं)
+ * @param size लिखे गए bytes store करने के लिए pointer
+ * @return सफल होने पर 0, runs buffer में fit न हों तो -1
+ */
+static int encode_runs(const Board *board, uint8_t *out, size_t limit, size_t *size) {
+    char state = 0;
+    uint64_t run = 0;
+    *size = 0;
+
+    for (size_t x = 0; x < board->height; x++) {
+        const char *row = &board->cells[BOARD_INDEX(board, x, 0)];
+        for (size_t y = 0; y < board->width; y++) {
+            if (row[y] != state) {
+                if (put_varint(out, size, limit, run) != 0) return -1;
+                state = row[y];
+                run = 0;
+            }
+            run++;
+        }
+    }
+    return put_varint(out, size, limit, run);
+}
+
+/**
+ * @brief बोर्ड को bits encoding में लिखता है
+ * @param board source बोर्ड
+ * @param out payload buffer (height * row bytes)
+ */
+static void encode_bits(const Board *board, uint8_t *out) {
+    size_t row_bytes = checkpoint_row_bytes(board->width);
+
+    for (size_t x = 0; x < board->height; x++) {
+        const char *row = &board->cells[BOARD_INDEX(board, x, 0)];
+        uint8_t *dst = &out[x * row_bytes];
+        memset(dst, 0, row_bytes);
+        for (size_t y = 0; y < board->width; y++) {
+            dst[y / 8] |= (uint8_t)((row[y] & 1) << (y % 8));
+        }
+    }
+}
+
+/**
+ * @brief bits payload को बोर्ड में decode करता है
+ * @param board target बोर्ड
+ * @param data payload
+ */
+static void decode_bits(Board *board, const uint8_t *data) {
+    size_t row_bytes = checkpoint_row_bytes(board->width);
+
+    for (size_t x = 0; x < board->height; x++) {
+        char *row = &board->cells[BOARD_INDEX(board, x, 0)];
+        const uint8_t *src = &data[x * row_bytes];
+        for (size_t y = 0; y < board->width; y++) {
+            row[y] = (src[y / 8] >> (y % 8)) & 1;
+        }
+    }
+}
+
+/**
+ * @brief runs payload को बोर्ड में decode करता है
+ * @param board target बोर्ड
+ * @param data payload
+ * @param size payload का size
+ * @return सफल होने पर 0, runs बोर्ड से मेल न खाएं तो -1
+ */
+static int decode_runs(Board *board, const uint8_t *data, size_t size) {
+    uint64_t total = (uint64_t)board->height * board->width;
+    uint64_t pos = 0;
+    char state = 0;
+    size_t offset = 0;
+
+    while (offset < size) {
+        uint64_t run = 0;
+        int shift = 0;
+        uint8_t byte;
+        do {
+            if (offset >= size || shift >= 64) return -1;
+            byte = data[offset++];
+            run |= (uint64_t)(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+
+        if (run > total - pos) return -1;
+
+        // Run कई rows में फैला हो सकता है
+        while (run > 0) {
+            size_t x = pos / board->width;
+            size_t y = pos % board->width;
+            size_t span = board->width - y;
+            if (span > run) span = run;
+            memset(&board->cells[BOARD_INDEX(board, x, y)], state, span);
+            pos += span;
+            run -= span;
+        }
+        state = !state;
+    }
+
+    return pos == total ? 0 : -1;
+}
+
+/**
+ * @brief बोर्ड, generation counter और rules को checkpoint file में लिखता है
+ *
+ * @param filename checkpoint file का नाम
+ * @param board save करने वाला बोर्ड
+ * @param generation बोर्ड की current generation
+ * @param rules current rules (masks, Hensel exclusions और नाम save होते हैं)
+ * @return सफल होने पर 0, error या Generations rules (cells 1 bit में) होने पर -1
+ */
+int board_save(const char *filename, const Board *board, uint64_t generation, const Rules *rules) {
+    if (!filename || !board || !board->cells || !rules) return -1;
+    // Payload में हर cell का सिर्फ एक bit है
+    if (rules->states > 2) return -1;
+
+    size_t row_bytes = checkpoint_row_bytes(board->width);
+    if (board->height > SIZE_MAX / row_bytes) return -1;
+    size_t bits_size = board->height * row_bytes;
+
+    int status = -1;
+    FILE *file = NULL;
+    char *temp_name = NULL;
+    uint8_t *payload = malloc(bits_size);
+    if (payload == NULL) goto cleanup;
+
+    // Runs bits से छोटे हों तभी use होते हैं
+    uint32_t encoding = CHECKPOINT_RUNS;
+    size_t payload_size = 0;
+    if (encode_runs(board, payload, bits_size, &payload_size) != 0) {
+        encoding = CHECKPOINT_BITS;
+        payload_size = bits_size;
+        encode_bits(board, payload);
+    }
+
+    uint8_t header[CHECKPOINT_HEADER_SIZE] = {0};
+    memcpy(header, CHECKPOINT_MAGIC, 8);
+    put_le(header + 8, CHECKPOINT_VERSION, 4);
+    put_le(header + 12, encoding, 4);
+    put_le(header + 16, board->height, 8);
+    put_le(header + 24, board->width, 8);
+    put_le(header + 32, generation, 8);
+    put_le(header + 40, rules->birth_rules, 2);
+    put_le(header + 42, rules->survival_rules, 2);
+    header[44] = (uint8_t)board->edge;
+    put_le(header + 48, payload_size, 8);
+    put_le(header + 56, checkpoint_checksum(payload, payload_size), 4);
+    memcpy(header + 64, rules->name, strnlen(rules->name, 63));
+    for (int count = 0; count <= MAX_NEIGHBORS; count++) {
+        put_le(header + 128 + 2 * count, rules->birth_excluded[count], 2);
+        put_le(header + 146 + 2 * count, rules->survival_excluded[count], 2);
+    }
+
+    // पहले temporary file में लिखें, फिर rename (पुराना checkpoint सुरक्षित रहता है)
+    size_t name_len = strlen(filename);
+    temp_name = malloc(name_len + 5);
+    if (temp_name == NULL) goto cleanup;
+    memcpy(temp_name, filename, name_len);
+    memcpy(temp_name + name_len, ".tmp", 5);
+
+    file = fopen(temp_name, "wb");
+    if (file == NULL) goto cleanup;
+    if (fwrite(header, 1, sizeof(header), file) != sizeof(header)) goto cleanup;
+    if (fwrite(payload, 1, payload_size, file) != payload_size) goto cleanup;
+    if (fflush(file) != 0 || fsync(fileno(file)) != 0) goto cleanup;
+
+    int close_status = fclose(file);
+    file = NULL;
+    if (close_status != 0) goto cleanup;
+    if (rename(temp_name, filename) != 0) goto cleanup;
+    status = 0;
+
+cleanup:
+    if (file != NULL) fclose(file);
+    if (status != 0 && temp_name != NULL) remove(temp_name);
+    free(temp_name);
+    free(payload);
+    return status;
+}
+
+/**
+ * @brief खुली file से header पढ़कर validate करता है
+ * @param file checkpoint file (शुरुआत पर)
+ * @param info header जानकारी store करने के लिए pointer
+ * @param encoding payload encoding store करने के लिए pointer
+ * @param payload_size payload size store करने के लिए pointer
+ * @param checksum payload checksum store करने के लिए pointer
+ * @return सफल होने पर 0, format error होने पर -1
+ */
+static int read_header(FILE *file, CheckpointInfo *info, uint32_t *encoding,
+                       uint64_t *payload_size, uint32_t *checksum) {
+    uint8_t header[CHECKPOINT_HEADER_SIZE] = {0};
+    if (fread(header, 1, CHECKPOINT_V1_HEADER_SIZE, file) != CHECKPOINT_V1_HEADER_SIZE) return -1;
+    if (memcmp(header, CHECKPOINT_MAGIC, 8) != 0) return -1;
+    uint64_t version = get_le(header + 8, 4);
+    if (version != 1 && version != CHECKPOINT_VERSION) return -1;
+    // Version 1 में exclusions नहीं थे, वो 0 (outer-totalistic) ही रहते हैं
+    if (version == CHECKPOINT_VERSION) {
+        size_t rest = CHECKPOINT_HEADER_SIZE - CHECKPOINT_V1_HEADER_SIZE;
+        if (fread(header + CHECKPOINT_V1_HEADER_SIZE, 1, rest, file) != rest) return -1;
+    }
+
+    *encoding = (uint32_t)get_le(header + 12, 4);
+    uint64_t height = get_le(header + 16, 8);
+    uint64_t width = get_le(header + 24, 8);
+    if (*encoding != CHECKPOINT_BITS && *encoding != CHECKPOINT_RUNS) return -1;
+    if (height == 0 || width == 0 || height > SIZE_MAX || width > SIZE_MAX) return -1;
+    if (header[44] > BOARD_EDGE_TORUS) return -1;
+
+    info->height = (size_t)height;
+    info->width = (size_t)width;
+    info->edge = (BoardEdge)header[44];
+    info->generation = get_le(header + 32, 8);
+    info->birth_rules = (uint16_t)get_le(header + 40, 2);
+    info->survival_rules = (uint16_t)get_le(header + 42, 2);
+    memcpy(info->rule_name, header + 64, sizeof(info->rule_name));
+    info->rule_name[sizeof(info->rule_name) - 1] = '\0';
+    for (int count = 0; count <= MAX_NEIGHBORS; count++) {
+        info->birth_excluded[count] = (uint16_t)get_le(header + 128 + 2 * count, 2);
+        info->survival_excluded[count] = (uint16_t)get_le(header + 146 + 2 * count, 2);
+    }
+
+    *payload_size = get_le(header + 48, 8);
+    *checksum = (uint32_t)get_le(header + 56, 4);
+    return 0;
+}
+
+/**
+ * @brief checkpoint file से बोर्ड restore करता है
+ *
+ * @param filename checkpoint file का नाम
+ * @param board target बोर्ड
+ * @param generation saved generation store करने के लिए pointer (NULL हो सकता है)
+ * @param rules saved masks, Hensel exclusions और नाम यहाँ लिखे जाते हैं (NULL हो सकता है)
+ * @return सफल होने पर 0, file/format/checksum error या size mismatch पर -1
+ */
+int board_load(const char *filename, Board *board, uint64_t *generation, Rules *rules) {
+    if (!filename || !board || !board->cells) return -1;
+
+    int status = -1;
+    uint8_t *payload = NULL;
+    FILE *file = fopen(filename, "rb");
+    if (file == NULL) return -1;
+
+    CheckpointInfo info;
+    uint32_t encoding, checksum;
+    uint64_t payload_size;
+    if (read_header(file, &info, &encoding, &payload_size, &checksum) != 0) goto cleanup;
+    if (info.height != board->height || info.width != board->width) goto cleanup;
+
+    // Runs हमेशा bits से छोटे save होते हैं, bits का size exact है
+    size_t bits_size = board->height * checkpoint_row_bytes(board->width);
+    if (encoding == CHECKPOINT_BITS ? payload_size != bits_size : payload_size > bits_size) goto cleanup;
+
+    payload = malloc(payload_size ? (size_t)payload_size : 1);
+    if (payload == NULL) goto cleanup;
+    if (fread(payload, 1, (size_t)payload_size, file) != payload_size) goto cleanup;
+    if (checkpoint_checksum(payload, (size_t)payload_size) != checksum) goto cleanup;
+
+    if (encoding == CHECKPOINT_BITS) {
+        decode_bits(board, payload);
+    } else if (decode_runs(board, payload, (size_t)payload_size) != 0) {
+        goto cleanup;
+    }
+    board_mark_all_dirty(board);
+
+    if (generation) *generation = info.generation;
+    if (rules) {
+        rules->birth_rules = info.birth_rules;
+        rules->survival_rules = info.survival_rules;
+        memcpy(rules->birth_excluded, info.birth_excluded, sizeof(rules->birth_excluded));
+        memcpy(rules->survival_excluded, info.survival_excluded, sizeof(rules->survival_excluded));
+        rules->states = 2;
+        memcpy(rules->name, info.rule_name, sizeof(rules->name));
+        rules_compile(rules);
+    }
+    status = 0;
+
+cleanup:
+    free(payload);
+    fclose(file);
+    return status;
+}
+
+/**
+ * @brief checkpoint का सिर्फ header पढ़ता है
+ * @param filename checkpoint file का नाम
+ * @param info header जानकारी store करने के लिए pointer
+ * @return सफल होने पर 0, file या format error होने पर -1
+ */
+int checkpoint_read_info(const char *filename, CheckpointInfo *info) {
+    if (!filename || !info) return -1;
+
+    FILE *file = fopen(filename, "rb");
+    if (file == NULL) return -1;
+
+    uint32_t encoding, checksum;
+    uint64_t payload_size;
+    int status = read_header(file, info, &encoding, &payload_size, &checksum);
+    fclose(file);
+    return status;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file checkpoint.h
+ * @brief बोर्ड के binary checkpoints (save/restore) का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Checkpoint file में एक fixed-size header (magic, dimensions, edge mode,
+ * generation counter, rule masks, Hensel exclusions और rule का नाम) और उसके बाद compressed
+ * cells होते हैं। Cells दो encodings में से जो छोटी हो उसमें लिखे जाते हैं:
+ *
+ * - Bits: हर row ceil(width / 8) bytes, byte का bit j = column k*8+j।
+ * - Runs: row-major cells के alternating मृत/जीवित runs (मृत से शुरू),
+ *   हर run की length LEB128 varint में। Sparse boards बहुत छोटे होते हैं।
+ *
+ * सभी numbers little-endian हैं, इसलिए file machines के बीच portable है।
+ * Payload का checksum load पर verify होता है, और save पहले temporary file
+ * में लिखकर rename करता है, ताकि बीच में kill हुए process से पुराना
+ * checkpoint खराब न हो।
+ */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "board.h"
+#include "rules.h"
+
+/**
+ * @brief Checkpoint file की पहली 8 bytes
+ */
+#define CHECKPOINT_MAGIC "GOLCKPT1"
+
+/**
+ * @brief Checkpoint format का version
+ *
+ * Version 2 के header में Hensel exclusions भी हैं। Version 1 files अब भी
+ * load होती हैं (उनके rules हमेशा outer-totalistic थे)।
+ */
+#define CHECKPOINT_VERSION 2
+
+/**
+ * @brief Checkpoint header से पढ़ी गई जानकारी
+ */
+typedef struct CheckpointInfo {
+    size_t height;              /**< बोर्ड की ऊंचाई */
+    size_t width;               /**< बोर्ड की चौड़ाई */
+    BoardEdge edge;             /**< बोर्ड के किनारे */
+    uint64_t generation;        /**< Save के समय generation counter */
+    uint16_t birth_rules;       /**< Rules का birth mask */
+    uint16_t survival_rules;    /**< Rules का survival mask */
+    uint16_t birth_excluded[MAX_NEIGHBORS + 1];    /**< Rules के birth Hensel exclusions */
+    uint16_t survival_excluded[MAX_NEIGHBORS + 1]; /**< Rules के survival Hensel exclusions */
+    char rule_name[64];         /**< Rules का नाम */
+} CheckpointInfo;
+
+/**
+ * @brief बोर्ड, generation counter और rules को checkpoint file में लिखता है
+ *
+ * File पहले "<filename>.tmp" में लिखी और sync होती है, फिर rename से
+ * filename की जगह लेती है।
+ *
+ * @param filename checkpoint file का नाम
+ * @param board save करने वाला बोर्ड
+ * @param generation बोर्ड की current generation
+ * @param rules current rules (masks, Hensel exclusions और नाम save होते हैं)
+ * @return सफल होने पर 0, error या Generations rules (cells 1 bit में) होने पर -1
+ */
+int board_save(const char *filename, const Board *board, uint64_t generation, const Rules *rules);
+
+/**
+ * @brief checkpoint file से बोर्ड restore करता है
+ *
+ * बोर्ड की dimensions checkpoint जैसी होनी चाहिए (पहले checkpoint_read_info
+ * से size पता करें)। Load के बाद सभी tiles dirty mark होती हैं।
+ *
+ * @param filename checkpoint file का नाम
+ * @param board target बोर्ड
+ * @param generation saved generation store करने के लिए pointer (NULL हो सकता है)
+ * @param rules saved masks, Hensel exclusions और नाम यहाँ लिखे जाते हैं और tables फिर से
+ *              compile होती हैं (NULL हो सकता है)
+ * @return सफल होने पर 0, file/format/checksum error या size mismatch पर -1
+ */
+int board_load(const char *filename, Board *board, uint64_t *generation, Rules *rules);
+
+/**
+ * @brief checkpoint का सिर्फ header पढ़ता है
+ * @param filename checkpoint file का नाम
+ * @param info header जानकारी store करने के लिए pointer
+ * @return सफल होने पर 0, file या format error होने पर -1
+ */
+int checkpoint_read_info(const char *filename, CheckpointInfo *info);
+
+#endif // CHECKPOINT_H
@@ -0,0 +1,119 @@
+/**
+ * @file cycle.c
+ * @brief Generation hashes से still lifes और oscillators पहचानने का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Window छोटी है (default 64), इसलिए हर push में ring का linear scan
+ * होता है; यह एक generation step के मुकाबले negligible है।
+ */
+
+#include <stdlib.h>
+
+#include "cycle.h"
+
+/**
+ * @brief नया cycle detector बनाता है
+ * @param capacity कितनी आखिरी generations रखनी हैं (0 = CYCLE_DEFAULT_WINDOW)
+ * @return सफल होने पर CycleDetector pointer, memory allocation fail होने पर NULL
+ */
+CycleDetector *cycle_detector_init(size_t capacity) {
+    if (capacity == 0) capacity = CYCLE_DEFAULT_WINDOW;
+
+    CycleDetector *detector = calloc(1, sizeof(CycleDetector));
+    if (detector == NULL) return NULL;
+
+    detector->hashes = calloc(capacity, sizeof(uint64_t));
+    detector->generations = calloc(capacity, sizeof(uint64_t));
+    if (detector->hashes == NULL || detector->generations == NULL) {
+        cycle_detector_free(detector);
+        return NULL;
+    }
+    detector->capacity = capacity;
+    return detector;
+}
+
+/**
+ * @brief cycle_detector_init_arena के एक detector को arena में चाहिए bytes
+ * @param capacity कितनी आखिरी generations (0 = CYCLE_DEFAULT_WINDOW)
+ * @return arena capacity में जोड़ने वाले bytes
+ */
+size_t cycle_detector_arena_size(size_t capacity) {
+    if (capacity == 0) capacity = CYCLE_DEFAULT_WINDOW;
+    return ARENA_SIZE(sizeof(CycleDetector)) + 2 * ARENA_SIZE(capacity * sizeof(uint64_t));
+}
+
+/**
+ * @brief arena में नया cycle detector बनाता है (cycle_detector_free इस पर कुछ नहीं करता)
+ * @param arena source arena (कम से कम cycle_detector_arena_size bytes खाली)
+ * @param capacity कितनी आखिरी generations रखनी हैं (0 = CYCLE_DEFAULT_WINDOW)
+ * @return सफल होने पर CycleDetector pointer, NULL arena या arena भर जाने पर NULL
+ */
+CycleDetector *cycle_detector_init_arena(Arena *arena, size_t capacity) {
+    if (capacity == 0) capacity = CYCLE_DEFAULT_WINDOW;
+
+    CycleDetector *detector = arena_alloc(arena, sizeof(CycleDetector));
+    if (detector == NULL) return NULL;
+
+    detector->hashes = arena_alloc(arena, capacity * sizeof(uint64_t));
+    detector->generations = arena_alloc(arena, capacity * sizeof(uint64_t));
+    if (detector->hashes == NULL || detector->generations == NULL) return NULL;
+    detector->capacity = capacity;
+    detector->arena = arena;
+    return detector;
+}
+
+/**
+ * @brief detector की memory free करता है
+ * @param detector free करने वाला detector (NULL हो सकता है)
+ */
+void cycle_detector_free(CycleDetector *detector) {
+    if (detector == NULL || detector->arena != NULL) return;
+    free(detector->hashes);
+    free(detector->generations);
+    free(detector);
+}
+
+/**
+ * @brief सभी stored hashes हटाता है (बोर्ड बाहर से बदलने के बाद)
+ * @param detector detector
+ */
+void cycle_detector_reset(CycleDetector *detector) {
+    if (detector == NULL) return;
+    detector->count = 0;
+    detector->next = 0;
+}
+
+/**
+ * @brief एक generation का hash जोड़ता है और cycle check करता है
+ *
+ * Scan सबसे नई entry से पीछे की तरफ होता है, इसलिए पहला match सबसे
+ * छोटा period देता है। Match न हो तभी hash ring में जाता है (सबसे पुरानी
+ * entry की जगह)।
+ *
+ * @param detector detector
+ * @param hash इस generation का board hash
+ * @param generation generation number (हर call में बढ़ता हुआ)
+ * @param start cycle की पहली generation store करने के लिए pointer (NULL हो सकता है)
+ * @param period period store करने के लिए pointer (NULL हो सकता है)
+ * @return cycle मिला तो 1, नहीं तो 0, NULL detector पर -1
+ */
+int cycle_detector_push(CycleDetector *detector, uint64_t hash, uint64_t generation,
+                        uint64_t *start, uint64_t *period) {
+    if (detector == NULL) return -1;
+
+    for (size_t i = 1; i <= detector->count; i++) {
+        size_t slot = (detector->next + detector->capacity - i) % detector->capacity;
+        if (detector->hashes[slot] == hash) {
+            if (start) *start = detector->generations[slot];
+            if (period) *period = generation - detector->generations[slot];
+            return 1;
+        }
+    }
+
+    detector->hashes[detector->next] = hash;
+    detector->generations[detector->next] = generation;
+    detector->next = (detector->next + 1) % detector->capacity;
+    if (detector->count < detector->capacity) detector->count++;
+    return 0;
+}
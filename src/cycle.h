@@ -0,0 +1,92 @@
+/**
+ * @file cycle.h
+ * @brief Generation hashes से still lifes और oscillators पहचानने का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * हर generation का board hash (board_hash) एक ring buffer में जाता है।
+ * नया hash ring में पहले से हो तो बोर्ड उसी generation वाली state में
+ * लौट आया है: वहाँ से पूरी simulation period P से दोहराती है (P = 1
+ * still life, P = 2 blinker जैसे oscillators)। Ring में सिर्फ आखिरी
+ * capacity generations रहती हैं, इसलिए इससे लंबे periods नहीं पकड़े जाते।
+ *
+ * Hashes 64-bit हैं; अलग states का same hash होना (false positive) बहुत
+ * ही unlikely है, पर cells की तुलना नहीं होती।
+ */
+
+#ifndef CYCLE_H
+#define CYCLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arena.h"
+
+/**
+ * @brief Ring buffer में default generations (सबसे लंबा पकड़ा जाने वाला period)
+ */
+#define CYCLE_DEFAULT_WINDOW 64
+
+/**
+ * @brief Recent generation hashes का ring buffer
+ */
+typedef struct CycleDetector {
+    uint64_t *hashes;           /**< capacity hashes */
+    uint64_t *generations;      /**< हर hash की generation */
+    size_t capacity;            /**< Ring buffer का size */
+    size_t count;               /**< Stored hashes (capacity तक) */
+    size_t next;                /**< अगला hash किस slot में जाएगा */
+    Arena *arena;               /**< जिस arena में detector की memory है (NULL = heap) */
+} CycleDetector;
+
+/**
+ * @brief नया cycle detector बनाता है
+ * @param capacity कितनी आखिरी generations रखनी हैं (0 = CYCLE_DEFAULT_WINDOW)
+ * @return सफल होने पर CycleDetector pointer, memory allocation fail होने पर NULL
+ */
+CycleDetector *cycle_detector_init(size_t capacity);
+
+/**
+ * @brief cycle_detector_init_arena के एक detector को arena में चाहिए bytes
+ * @param capacity कितनी आखिरी generations (0 = CYCLE_DEFAULT_WINDOW)
+ * @return arena capacity में जोड़ने वाले bytes
+ */
+size_t cycle_detector_arena_size(size_t capacity);
+
+/**
+ * @brief arena में नया cycle detector बनाता है (cycle_detector_free इस पर कुछ नहीं करता)
+ * @param arena source arena
+ * @param capacity कितनी आखिरी generations रखनी हैं (0 = CYCLE_DEFAULT_WINDOW)
+ * @return सफल होने पर CycleDetector pointer, असफल होने पर NULL
+ */
+CycleDetector *cycle_detector_init_arena(Arena *arena, size_t capacity);
+
+/**
+ * @brief detector की memory free करता है
+ * @param detector free करने वाला detector (NULL हो सकता है)
+ */
+void cycle_detector_free(CycleDetector *detector);
+
+/**
+ * @brief सभी stored hashes हटाता है (बोर्ड बाहर से बदलने के बाद)
+ * @param detector detector
+ */
+void cycle_detector_reset(CycleDetector *detector);
+
+/**
+ * @brief एक generation का hash जोड़ता है और cycle check करता है
+ *
+ * Hash ring में हो तो सबसे नई matching entry से period निकलता है, यानी
+ * सबसे छोटा period मिलता है।
+ *
+ * @param detector detector
+ * @param hash इस generation का board hash
+ * @param generation generation number (हर call में बढ़ता हुआ)
+ * @param start cycle की पहली generation store करने के लिए pointer (NULL हो सकता है)
+ * @param period period store करने के लिए pointer (NULL हो सकता है)
+ * @return cycle मिला तो 1, नहीं तो 0, NULL detector पर -1
+ */
+int cycle_detector_push(CycleDetector *detector, uint64_t hash, uint64_t generation,
+                        uint64_t *start, uint64_t *period);
+
+#endif // CYCLE_H
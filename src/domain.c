@@ -0,0 +1,578 @@
+/**
+ * @file domain.c
+ * @brief कई processes (nodes) में बंटे distributed simulation का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Local बोर्ड की layout: ऊपर halo rows (rank 0 पर नहीं), फिर own rows,
+ * फिर नीचे halo rows (आखिरी rank पर नहीं)। d generations वाले round की
+ * generation s सिर्फ own rows से d - s दूरी तक की rows compute करती है, और
+ * उसके लिए d - s + 1 दूरी तक की rows पढ़ती है, जो पिछली generation में
+ * valid थीं (s = 1 पर receive हुए halos)। बाकी halo rows stale रहती हैं पर
+ * कभी पढ़ी नहीं जातीं। Universe के असली किनारे पर local बोर्ड भी खत्म
+ * होता है, जहाँ packed_board_next_rows बाहर की cells मृत मानता है।
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "domain.h"
+#include "rng.h"
+
+/**
+ * @brief Handshake की पहली 8 bytes
+ */
+#define DOMAIN_MAGIC "GOLDOMN1"
+
+/**
+ * @brief Handshake का byte order marker (native order में भेजा जाता है)
+ */
+#define DOMAIN_BYTE_ORDER 0x0102030405060708ULL
+
+/**
+ * @brief Rank r - 1 के listen करने तक connect retries (100 ms प्रति retry)
+ */
+#define DOMAIN_CONNECT_RETRIES 600
+
+/**
+ * @brief Overlap में हर chunk की rows (chunks के बीच communication आगे बढ़ता है)
+ */
+#define DOMAIN_CHUNK_ROWS 32
+
+/**
+ * @brief Handshake message
+ */
+typedef struct DomainHello {
+    char magic[8];          /**< DOMAIN_MAGIC */
+    uint64_t byte_order;    /**< DOMAIN_BYTE_ORDER */
+    uint64_t rank;          /**< भेजने वाले का rank */
+    uint64_t num_ranks;     /**< कुल ranks */
+    uint64_t height;        /**< Universe की ऊंचाई */
+    uint64_t width;         /**< Universe की चौड़ाई */
+    uint64_t halo;          /**< Halo depth */
+} DomainHello;
+
+/**
+ * @brief peers list से index वाली entry के host और port निकालता है
+ * @param peers comma-separated "host:port" list
+ * @param index entry का index
+ * @param host host store करने के लिए buffer
+ * @param host_size buffer का size
+ * @param port port store करने के लिए buffer
+ * @param port_size buffer का size
+ * @return सफल होने पर 0, entry न हो या गलत format पर -1
+ */
+static int domain_peer(const char *peers, int index, char *host, size_t host_size,
+                       char *port, size_t port_size) {
+    const char *entry = peers;
+    for (int i = 0; i < index; i++) {
+        entry = strchr(entry, ',');
+        if (entry == NULL) return -1;
+        entry++;
+    }
+
+    const char *end = strchr(entry, ',');
+    size_t length = end ? (size_t)(end - entry) : strlen(entry);
+    const char *colon = NULL;
+    for (size_t i = 0; i < length; i++) {
+        if (entry[i] == ':') colon = &entry[i];
+    }
+    if (colon == NULL) return -1;
+
+    size_t host_length = (size_t)(colon - entry);
+    size_t port_length = length - host_length - 1;
+    if (host_length >= host_size || port_length == 0 || port_length >= port_size) return -1;
+    memcpy(host, entry, host_length);
+    host[host_length] = '\0';
+    memcpy(port, colon + 1, port_length);
+    port[port_length] = '\0';
+    return 0;
+}
+
+/**
+ * @brief peers list में entries गिनता है
+ * @param peers comma-separated list
+ * @return entries की संख्या
+ */
+static int domain_peer_count(const char *peers) {
+    int count = 1;
+    for (const char *p = peers; *p; p++) {
+        if (*p == ',') count++;
+    }
+    return count;
+}
+
+/**
+ * @brief port पर listening socket खोलता है
+ * @param port port number (string)
+ * @return सफल होने पर socket, error पर -1
+ */
+static int domain_listen(const char *port) {
+    struct addrinfo hints, *list = NULL;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    if (getaddrinfo(NULL, port, &hints, &list) != 0) return -1;
+
+    int fd = -1;
+    for (struct addrinfo *ai = list; ai != NULL && fd < 0; ai = ai->ai_next) {
+        fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd < 0) continue;
+        int on = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+        if (bind(fd, ai->ai_addr, ai->ai_addrlen) != 0 || listen(fd, 1) != 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(list);
+    return fd;
+}
+
+/**
+ * @brief host:port से connect करता है, server शुरू होने तक retry करते हुए
+ * @param host host name या address
+ * @param port port number (string)
+ * @return सफल होने पर socket, retries खत्म होने पर -1
+ */
+static int domain_connect(const char *host, const char *port) {
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    for (int attempt = 0; attempt < DOMAIN_CONNECT_RETRIES; attempt++) {
+        struct addrinfo *list = NULL;
+        if (getaddrinfo(host, port, &hints, &list) == 0) {
+            for (struct addrinfo *ai = list; ai != NULL; ai = ai->ai_next) {
+                int fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+                if (fd < 0) continue;
+                if (connect(fd, ai->ai_addr, ai->ai_addrlen) == 0) {
+                    freeaddrinfo(list);
+                    return fd;
+                }
+                close(fd);
+            }
+            freeaddrinfo(list);
+        }
+        struct timespec delay = {0, 100 * 1000 * 1000};
+        nanosleep(&delay, NULL);
+    }
+    return -1;
+}
+
+/**
+ * @brief blocking socket पर पूरा buffer लिखता है
+ * @param fd socket
+ * @param data buffer
+ * @param size bytes
+ * @return सफल होने पर 0, error पर -1
+ */
+static int domain_write_all(int fd, const void *data, size_t size) {
+    const uint8_t *p = data;
+    while (size > 0) {
+        ssize_t n = send(fd, p, size, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return -1;
+        p += n;
+        size -= (size_t)n;
+    }
+    return 0;
+}
+
+/**
+ * @brief blocking socket से पूरा buffer पढ़ता है
+ * @param fd socket
+ * @param data buffer
+ * @param size bytes
+ * @return सफल होने पर 0, error या connection बंद होने पर -1
+ */
+static int domain_read_all(int fd, void *data, size_t size) {
+    uint8_t *p = data;
+    while (size > 0) {
+        ssize_t n = recv(fd, p, size, 0);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return -1;
+        p += n;
+        size -= (size_t)n;
+    }
+    return 0;
+}
+
+/**
+ * @brief neighbor से handshake करता है और socket को non-blocking बनाता है
+ * @param domain यह domain
+ * @param fd neighbor का socket
+ * @param neighbor neighbor का expected rank
+ * @return सफल होने पर 0, network error या settings mismatch पर -1
+ */
+static int domain_handshake(const Domain *domain, int fd, int neighbor) {
+    DomainHello mine, theirs;
+    memset(&mine, 0, sizeof(mine));
+    memcpy(mine.magic, DOMAIN_MAGIC, sizeof(mine.magic));
+    mine.byte_order = DOMAIN_BYTE_ORDER;
+    mine.rank = (uint64_t)domain->rank;
+    mine.num_ranks = (uint64_t)domain->num_ranks;
+    mine.height = domain->height;
+    mine.width = domain->width;
+    mine.halo = domain->halo;
+
+    if (domain_write_all(fd, &mine, sizeof(mine)) != 0) return -1;
+    if (domain_read_all(fd, &theirs, sizeof(theirs)) != 0) return -1;
+
+    if (memcmp(theirs.magic, DOMAIN_MAGIC, sizeof(theirs.magic)) != 0 ||
+        theirs.byte_order != DOMAIN_BYTE_ORDER || theirs.rank != (uint64_t)neighbor ||
+        theirs.num_ranks != mine.num_ranks || theirs.height != mine.height ||
+        theirs.width != mine.width || theirs.halo != mine.halo) {
+        printf("Domain %d: rank %d has different settings\n", domain->rank, neighbor);
+        return -1;
+    }
+
+    int on = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0) return -1;
+    return 0;
+}
+
+/**
+ * @brief इस rank की strip बनाता है और neighbor ranks से connect करता है
+ *
+ * Rank r peers की r-th entry के port पर listen करता है, rank r - 1 से
+ * connect करता है (उसके listen करने तक retry होता है) और rank r + 1 का
+ * connection accept करता है। हर rank connect से पहले listen करता है,
+ * इसलिए ranks किसी भी क्रम में शुरू हो सकते हैं।
+ *
+ * @param config इस process की settings
+ * @return सफल होने पर Domain pointer, invalid config, memory या network error पर NULL
+ */
+Domain *domain_init(const DomainConfig *config) {
+    if (config == NULL || config->peers == NULL) return NULL;
+    if (config->num_ranks < 1 || config->rank < 0 || config->rank >= config->num_ranks) return NULL;
+    if (config->halo < 1 || config->halo > DOMAIN_MAX_HALO || config->width == 0) return NULL;
+    if (domain_peer_count(config->peers) != config->num_ranks) {
+        printf("Domain: --peers needs %d host:port entries\n", config->num_ranks);
+        return NULL;
+    }
+
+    // हर strip में कम से कम halo rows, ताकि halo सिर्फ neighbor से आए
+    size_t n = (size_t)config->num_ranks, r = (size_t)config->rank;
+    if (config->height / n < config->halo) {
+        printf("Domain: %zu rows are too few for %d ranks with halo %zu\n",
+               config->height, config->num_ranks, config->halo);
+        return NULL;
+    }
+
+    // Domain struct और दोनों strips एक arena में (teardown एक free)
+    size_t local = (r > 0 ? config->halo : 0) + (config->height * (r + 1) / n - config->height * r / n) +
+                   (r + 1 < n ? config->halo : 0);
+    Arena *arena = arena_init(ARENA_SIZE(sizeof(Domain)) + 2 * packed_board_arena_size(local, config->width));
+    Domain *domain = arena_alloc(arena, sizeof(Domain));
+    if (domain == NULL) {
+        arena_free(arena);
+        return NULL;
+    }
+    domain->arena = arena;
+    domain->up.fd = -1;
+    domain->down.fd = -1;
+    domain->rank = config->rank;
+    domain->num_ranks = config->num_ranks;
+    domain->height = config->height;
+    domain->width = config->width;
+    domain->halo = config->halo;
+    domain->row_begin = config->height * r / n;
+    domain->row_end = config->height * (r + 1) / n;
+    domain->top = r > 0 ? config->halo : 0;
+
+    domain->front = packed_board_init_arena(arena, local, config->width);
+    domain->back = packed_board_init_arena(arena, local, config->width);
+    if (domain->front == NULL || domain->back == NULL) goto fail;
+
+    char host[256], port[32];
+    int listener = -1;
+    if (r + 1 < n) {
+        if (domain_peer(config->peers, config->rank, host, sizeof(host), port, sizeof(port)) != 0) goto fail;
+        listener = domain_listen(port);
+        if (listener < 0) {
+            printf("Domain %d: cannot listen on port %s\n", config->rank, port);
+            goto fail;
+        }
+    }
+
+    if (r > 0) {
+        if (domain_peer(config->peers, config->rank - 1, host, sizeof(host), port, sizeof(port)) != 0 ||
+            (domain->up.fd = domain_connect(host, port)) < 0) {
+            printf("Domain %d: cannot connect to rank %d\n", config->rank, config->rank - 1);
+            if (listener >= 0) close(listener);
+            goto fail;
+        }
+        if (domain_handshake(domain, domain->up.fd, config->rank - 1) != 0) {
+            if (listener >= 0) close(listener);
+            goto fail;
+        }
+    }
+
+    if (listener >= 0) {
+        do {
+            domain->down.fd = accept(listener, NULL, NULL);
+        } while (domain->down.fd < 0 && errno == EINTR);
+        close(listener);
+        if (domain->down.fd < 0 || domain_handshake(domain, domain->down.fd, config->rank + 1) != 0) goto fail;
+    }
+
+    return domain;
+
+fail:
+    domain_free(domain);
+    return NULL;
+}
+
+/**
+ * @brief connections बंद करता है और memory free करता है
+ * @param domain free करने वाला domain
+ * @return सफल होने पर 0, NULL pointer पर -1
+ */
+int domain_free(Domain *domain) {
+    if (domain == NULL) return -1;
+    if (domain->up.fd >= 0) close(domain->up.fd);
+    if (domain->down.fd >= 0) close(domain->down.fd);
+    arena_free(domain->arena);
+    return 0;
+}
+
+/**
+ * @brief pattern की own rows strip में copy करता है
+ * @param domain target domain
+ * @param pattern pattern का बोर्ड (universe से छोटा हो सकता है)
+ * @return सफल होने पर 0, NULL pointer पर -1
+ */
+int domain_load(Domain *domain, const Board *pattern) {
+    if (domain == NULL || pattern == NULL) return -1;
+
+    PackedBoard *board = domain->front;
+    packed_board_clear(board);
+    size_t width = pattern->width < domain->width ? pattern->width : domain->width;
+    for (size_t x = domain->row_begin; x < domain->row_end && x < pattern->height; x++) {
+        const char *row = &pattern->cells[BOARD_INDEX(pattern, x, 0)];
+        uint64_t *dst = &board->words[(domain->top + x - domain->row_begin) * board->words_per_row];
+        for (size_t y = 0; y < width; y++) {
+            if (row[y] == 1) dst[y / 64] |= (uint64_t)1 << (y % 64);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief strip को seed से दी गई density पर random भरता है
+ *
+ * Rows global row numbers से rng_fill_rows में भरती हैं, इसलिए universe
+ * ranks की संख्या पर depend नहीं करता और same seed वाले single board
+ * (board_random_fill) जैसा ही होता है।
+ *
+ * @param domain target domain
+ * @param seed universe का seed
+ * @param density जीवित cells का fraction (0 से 1)
+ * @return सफल होने पर 0, NULL pointer या density range के बाहर होने पर -1
+ */
+int domain_random_fill(Domain *domain, uint64_t seed, double density) {
+    if (domain == NULL) return -1;
+
+    RngFill fill;
+    if (rng_fill_init(&fill, seed, density) != 0) return -1;
+
+    PackedBoard *board = domain->front;
+    packed_board_clear(board);
+    rng_fill_rows(&fill, &board->words[domain->top * board->words_per_row], board->words_per_row,
+                  domain->width, domain->row_begin, domain->row_end - domain->row_begin);
+    return 0;
+}
+
+/**
+ * @brief एक link के इस round के send और receive buffers set करता है
+ * @param link neighbor link
+ * @param send भेजने वाली rows
+ * @param recv halo rows
+ * @param size दोनों का size (bytes)
+ */
+static void domain_post(DomainLink *link, const uint64_t *send, uint64_t *recv, size_t size) {
+    link->send = (const uint8_t *)send;
+    link->recv = (uint8_t *)recv;
+    link->send_size = link->fd >= 0 ? size : 0;
+    link->recv_size = link->fd >= 0 ? size : 0;
+    link->sent = 0;
+    link->received = 0;
+}
+
+/**
+ * @brief pending sends और receives को आगे बढ़ाता है
+ * @param domain domain
+ * @param wait 1 = सब पूरा होने तक block करें, 0 = जितना अभी हो सके
+ * @return सफल होने पर 0, network error या connection बंद होने पर -1
+ */
+static int domain_progress(Domain *domain, int wait) {
+    DomainLink *links[2] = {&domain->up, &domain->down};
+
+    for (;;) {
+        struct pollfd fds[2];
+        DomainLink *polled[2];
+        int count = 0;
+        for (int i = 0; i < 2; i++) {
+            short events = (short)((links[i]->sent < links[i]->send_size ? POLLOUT : 0) |
+                                   (links[i]->received < links[i]->recv_size ? POLLIN : 0));
+            if (events == 0) continue;
+            fds[count].fd = links[i]->fd;
+            fds[count].events = events;
+            fds[count].revents = 0;
+            polled[count++] = links[i];
+        }
+        if (count == 0) return 0;
+
+        int ready = poll(fds, (nfds_t)count, wait ? -1 : 0);
+        if (ready < 0 && errno == EINTR) continue;
+        if (ready < 0) return -1;
+        if (ready == 0) return 0;
+
+        for (int i = 0; i < count; i++) {
+            DomainLink *link = polled[i];
+            if (fds[i].revents & (POLLERR | POLLNVAL)) return -1;
+            if (fds[i].revents & POLLOUT) {
+                ssize_t n = send(link->fd, link->send + link->sent, link->send_size - link->sent, MSG_NOSIGNAL);
+                if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) return -1;
+                if (n > 0) link->sent += (size_t)n;
+            }
+            if (fds[i].revents & (POLLIN | POLLHUP)) {
+                ssize_t n = recv(link->fd, link->recv + link->received, link->recv_size - link->received, 0);
+                if (n == 0) return -1;
+                if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) return -1;
+                if (n > 0) link->received += (size_t)n;
+            }
+        }
+    }
+}
+
+/**
+ * @brief एक exchange और उसके बाद की depth generations चलाता है
+ *
+ * पहली generation में interior rows (जो सिर्फ own rows पढ़ती हैं) halos
+ * के रास्ते में रहते compute होती हैं; border और halo rows halos आने के बाद।
+ *
+ * @param domain domain
+ * @param rules apply करने वाले rules
+ * @param depth इस round की generations (1..halo)
+ * @return सफल होने पर 0, error पर -1
+ */
+static int domain_round(Domain *domain, Rules *rules, size_t depth) {
+    PackedBoard *board = domain->front;
+    const size_t wpr = board->words_per_row;
+    const size_t top = domain->top;
+    const size_t bottom = top + (domain->row_end - domain->row_begin);
+    const size_t bytes = depth * wpr * sizeof(uint64_t);
+
+    domain_post(&domain->up, &board->words[top * wpr], &board->words[(top - (top ? depth : 0)) * wpr], bytes);
+    domain_post(&domain->down, &board->words[(bottom - depth) * wpr], &board->words[bottom * wpr], bytes);
+
+    for (size_t x = top + 1; x + 1 < bottom; x += DOMAIN_CHUNK_ROWS) {
+        size_t end = x + DOMAIN_CHUNK_ROWS < bottom - 1 ? x + DOMAIN_CHUNK_ROWS : bottom - 1;
+        if (packed_board_next_rows(domain->front, domain->back, rules, x, end) != 0) return -1;
+        if (domain_progress(domain, 0) != 0) return -1;
+    }
+    if (domain_progress(domain, 1) != 0) return -1;
+
+    for (size_t s = 1; s <= depth; s++) {
+        // इस generation में own rows से depth - s दूरी तक की rows valid चाहिए
+        size_t reach = depth - s;
+        size_t lo = domain->up.fd >= 0 ? top - reach : 0;
+        size_t hi = domain->down.fd >= 0 ? bottom + reach : bottom;
+
+        if (s == 1) {
+            if (packed_board_next_rows(domain->front, domain->back, rules, lo, top + 1) != 0) return -1;
+            if (packed_board_next_rows(domain->front, domain->back, rules, bottom - 1, hi) != 0) return -1;
+        } else if (packed_board_next_rows(domain->front, domain->back, rules, lo, hi) != 0) {
+            return -1;
+        }
+
+        PackedBoard *temp = domain->front;
+        domain->front = domain->back;
+        domain->back = temp;
+    }
+    return 0;
+}
+
+/**
+ * @brief सभी ranks के साथ lockstep में generations चलाता है
+ *
+ * Generations halo depth के rounds में चलती हैं; आखिरी round छोटा हो
+ * सकता है (सभी ranks same generations चलाते हैं, इसलिए rounds match होते हैं)।
+ *
+ * @param domain domain
+ * @param rules apply करने वाले rules (सिर्फ outer-totalistic)
+ * @param generations कितनी generations
+ * @return सफल होने पर 0, unsupported rules या network error पर -1
+ */
+int domain_step(Domain *domain, Rules *rules, long generations) {
+    if (domain == NULL || rules == NULL || generations < 0) return -1;
+    if (rules->kernel != RULES_KERNEL_TOTALISTIC) return -1;
+
+    for (long done = 0; done < generations;) {
+        size_t depth = (size_t)(generations - done) < domain->halo ? (size_t)(generations - done) : domain->halo;
+        if (domain_round(domain, rules, depth) != 0) {
+            printf("Domain %d: halo exchange failed\n", domain->rank);
+            return -1;
+        }
+        done += (long)depth;
+    }
+    return 0;
+}
+
+/**
+ * @brief strip की own rows के जीवित cells
+ * @param domain source domain
+ * @return population (NULL होने पर 0)
+ */
+uint64_t domain_population(const Domain *domain) {
+    if (domain == NULL) return 0;
+
+    const PackedBoard *board = domain->front;
+    const uint64_t *words = &board->words[domain->top * board->words_per_row];
+    size_t count = (domain->row_end - domain->row_begin) * board->words_per_row;
+    uint64_t population = 0;
+    for (size_t i = 0; i < count; i++) {
+        population += (uint64_t)__builtin_popcountll(words[i]);
+    }
+    return population;
+}
+
+/**
+ * @brief strip की own rows बोर्ड में copy करता है (checkpoint या file output के लिए)
+ * @param domain source domain
+ * @param board target बोर्ड (row_end - row_begin rows, universe जितनी width)
+ * @return सफल होने पर 0, size mismatch पर -1
+ */
+int domain_to_board(const Domain *domain, Board *board) {
+    if (domain == NULL || board == NULL) return -1;
+    if (board->height != domain->row_end - domain->row_begin || board->width != domain->width) return -1;
+
+    const PackedBoard *src = domain->front;
+    for (size_t x = 0; x < board->height; x++) {
+        const uint64_t *row = &src->words[(domain->top + x) * src->words_per_row];
+        char *dst = &board->cells[BOARD_INDEX(board, x, 0)];
+        for (size_t y = 0; y < board->width; y++) {
+            dst[y] = (char)((row[y / 64] >> (y % 64)) & 1);
+        }
+    }
+    board_mark_all_dirty(board);
+    return 0;
+}
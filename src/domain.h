@@ -0,0 +1,163 @@
+/**
+ * @file domain.h
+ * @brief कई processes (nodes) में बंटे distributed simulation का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * पूरा universe rows की horizontal strips (rectangular domains) में बंटता
+ * है, हर process (rank) के पास एक strip PackedBoard के रूप में। Strip के
+ * ऊपर और नीचे k rows की halo रहती है, जो neighbor ranks की border rows की
+ * copy है। हर k generations में एक बार halos plain TCP पर exchange होते
+ * हैं और फिर बिना communication के k generations चलती हैं: हर generation
+ * के बाद halo का एक row कम valid रहता है, और k generations बाद सिर्फ own
+ * rows बचती हैं (k बड़ा = कम round trips, पर थोड़ा redundant compute)।
+ *
+ * Strips पूरी width की हैं, इसलिए हर halo memory में contiguous words हैं
+ * और सीधे बोर्ड से भेजे और उसी में receive होते हैं (कोई copy नहीं)।
+ * Sockets non-blocking हैं: round के पहले generation में interior rows
+ * (जिन्हें halo नहीं चाहिए) chunks में compute होती हैं और हर chunk के
+ * बीच pending sends/receives आगे बढ़ते हैं, यानी communication compute के
+ * साथ overlap होता है। Universe के किनारे मृत हैं।
+ *
+ * Words native byte order में भेजे जाते हैं; connect पर handshake byte
+ * order, rank और universe की settings check करता है।
+ */
+
+#ifndef DOMAIN_H
+#define DOMAIN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "board.h"
+#include "packed_board.h"
+#include "rules.h"
+
+/**
+ * @brief Halo exchange की default depth (generations प्रति exchange)
+ */
+#define DOMAIN_DEFAULT_HALO 1
+
+/**
+ * @brief Halo की maximum depth
+ */
+#define DOMAIN_MAX_HALO 64
+
+/**
+ * @brief Distributed run के एक process की settings
+ */
+typedef struct DomainConfig {
+    int rank;               /**< इस process का rank (0 = सबसे ऊपर की strip) */
+    int num_ranks;          /**< कुल processes */
+    const char *peers;      /**< हर rank का "host:port", comma-separated, rank के क्रम में */
+    size_t height;          /**< पूरे universe की ऊंचाई */
+    size_t width;           /**< पूरे universe की चौड़ाई */
+    size_t halo;            /**< Halo depth k: हर k generations में एक exchange */
+} DomainConfig;
+
+/**
+ * @brief एक neighbor rank से connection और इस round का pending exchange
+ */
+typedef struct DomainLink {
+    int fd;                 /**< Neighbor का socket (-1 = neighbor नहीं) */
+    const uint8_t *send;    /**< इस round में भेजने वाली rows */
+    size_t send_size;       /**< भेजने वाले bytes */
+    size_t sent;            /**< अभी तक भेजे गए bytes */
+    uint8_t *recv;          /**< Halo rows जहाँ receive होना है */
+    size_t recv_size;       /**< Receive होने वाले bytes */
+    size_t received;        /**< अभी तक receive हुए bytes */
+} DomainLink;
+
+/**
+ * @brief एक process की strip और उसके neighbors
+ */
+typedef struct Domain {
+    int rank;               /**< इस process का rank */
+    int num_ranks;          /**< कुल processes */
+    size_t height;          /**< पूरे universe की ऊंचाई */
+    size_t width;           /**< पूरे universe की चौड़ाई */
+    size_t halo;            /**< Halo depth */
+    size_t row_begin;       /**< Strip की पहली global row */
+    size_t row_end;         /**< Strip की आखिरी global row के बाद */
+    size_t top;             /**< Local बोर्ड में row_begin की row (ऊपर halo हो तो halo, वरना 0) */
+    PackedBoard *front;     /**< Current generation (halos सहित) */
+    PackedBoard *back;      /**< Next generation का buffer */
+    DomainLink up;          /**< rank - 1 (ऊपर की strip) */
+    DomainLink down;        /**< rank + 1 (नीचे की strip) */
+    Arena *arena;           /**< Domain struct और दोनों strips की memory */
+} Domain;
+
+/**
+ * @brief इस rank की strip बनाता है और neighbor ranks से connect करता है
+ *
+ * Rank r peers की r-th entry के port पर listen करता है, rank r - 1 से
+ * connect करता है (उसके listen करने तक retry होता है) और rank r + 1 का
+ * connection accept करता है। सभी ranks को same config (rank छोड़कर) देना
+ * जरूरी है; हर strip में कम से कम halo rows होनी चाहिए।
+ *
+ * @param config इस process की settings
+ * @return सफल होने पर Domain pointer, invalid config, memory या network error पर NULL
+ */
+Domain *domain_init(const DomainConfig *config);
+
+/**
+ * @brief connections बंद करता है और memory free करता है
+ * @param domain free करने वाला domain
+ * @return सफल होने पर 0, NULL pointer पर -1
+ */
+int domain_free(Domain *domain);
+
+/**
+ * @brief pattern की own rows strip में copy करता है
+ *
+ * Pattern universe के (0, 0) पर रखा जाता है; बाकी cells मृत होती हैं।
+ * हर rank पूरा pattern पढ़ता है, पर सिर्फ अपनी rows रखता है।
+ *
+ * @param domain target domain
+ * @param pattern pattern का बोर्ड (universe से छोटा हो सकता है)
+ * @return सफल होने पर 0, NULL pointer पर -1
+ */
+int domain_load(Domain *domain, const Board *pattern);
+
+/**
+ * @brief strip को seed से दी गई density पर random भरता है
+ *
+ * Cells global row और column से बनते हैं (देखें rng.h), इसलिए same seed
+ * से ranks की संख्या कुछ भी हो, universe same बनता है, और वो same seed
+ * वाले single board (board_random_fill) जैसा है।
+ *
+ * @param domain target domain
+ * @param seed universe का seed
+ * @param density जीवित cells का fraction (0 से 1)
+ * @return सफल होने पर 0, NULL pointer या density range के बाहर होने पर -1
+ */
+int domain_random_fill(Domain *domain, uint64_t seed, double density);
+
+/**
+ * @brief सभी ranks के साथ lockstep में generations चलाता है
+ *
+ * सभी ranks को same generations और same rules देने होते हैं।
+ *
+ * @param domain domain
+ * @param rules apply करने वाले rules (सिर्फ outer-totalistic)
+ * @param generations कितनी generations
+ * @return सफल होने पर 0, unsupported rules या network error पर -1
+ */
+int domain_step(Domain *domain, Rules *rules, long generations);
+
+/**
+ * @brief strip की own rows के जीवित cells
+ * @param domain source domain
+ * @return population (NULL होने पर 0)
+ */
+uint64_t domain_population(const Domain *domain);
+
+/**
+ * @brief strip की own rows बोर्ड में copy करता है (checkpoint या file output के लिए)
+ * @param domain source domain
+ * @param board target बोर्ड (row_end - row_begin rows, universe जितनी width)
+ * @return सफल होने पर 0, size mismatch पर -1
+ */
+int domain_to_board(const Domain *domain, Board *board);
+
+#endif // DOMAIN_H
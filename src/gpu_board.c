@@ -0,0 +1,647 @@
+/**
+ * @file gpu_board.c
+ * @brief GPU पर OpenGL compute shaders से stepping करने वाले backend का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Device पर row x का word w, buffer में x * words_per_row + w पर है, और
+ * word का bit j column w * 32 + j है। GLSL में 64-bit integers core नहीं
+ * हैं, इसलिए words 32-bit हैं; adder tree packed_next_word वाला ही है।
+ * Shader हर invocation में एक word compute करता है (16x16 words के work
+ * groups); बोर्ड के बाहर के words 0 पढ़े जाते हैं।
+ *
+ * GL functions eglGetProcAddress से load होते हैं, इसलिए सिर्फ -lEGL link
+ * होता है (libGL नहीं)।
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gpu_board.h"
+
+#ifdef GOL_GPU
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GL/glcorearb.h>
+
+/**
+ * @brief Step shader के work group की side (words x rows)
+ */
+#define GPU_GROUP_SIZE 16
+
+/**
+ * @brief Count shader के work group में rows
+ */
+#define GPU_COUNT_GROUP_SIZE 64
+
+/**
+ * @brief Next generation का compute shader (एक invocation = एक word)
+ */
+static const char *const gpu_step_source =
+    "#version 430\n"
+    "layout(local_size_x = 16, local_size_y = 16) in;\n"
+    "layout(std430, binding = 0) readonly buffer Current { uint current[]; };\n"
+    "layout(std430, binding = 1) writeonly buffer Next { uint next_words[]; };\n"
+    "uniform uint height;\n"
+    "uniform uint words_per_row;\n"
+    "uniform uint last_mask;\n"
+    "uniform uint birth_rules;\n"
+    "uniform uint survival_rules;\n"
+    "\n"
+    "uint word_at(int x, int w) {\n"
+    "    if (x < 0 || x >= int(height) || w < 0 || w >= int(words_per_row)) return 0u;\n"
+    "    return current[uint(x) * words_per_row + uint(w)];\n"
+    "}\n"
+    "\n"
+    "void full_add(uint a, uint b, uint c, out uint s, out uint k) {\n"
+    "    uint t = a ^ b;\n"
+    "    s = t ^ c;\n"
+    "    k = (a & b) | (t & c);\n"
+    "}\n"
+    "\n"
+    "void main() {\n"
+    "    int w = int(gl_GlobalInvocationID.x), x = int(gl_GlobalInvocationID.y);\n"
+    "    if (w >= int(words_per_row) || x >= int(height)) return;\n"
+    "\n"
+    "    uint l[3], c[3], r[3];\n"
+    "    for (int i = 0; i < 3; i++) {\n"
+    "        uint prev = word_at(x + i - 1, w - 1), cur = word_at(x + i - 1, w), next = word_at(x + i - 1, w + 1);\n"
+    "        l[i] = (cur << 1) | (prev >> 31);\n"
+    "        c[i] = cur;\n"
+    "        r[i] = (cur >> 1) | (next << 31);\n"
+    "    }\n"
+    "\n"
+    "    uint s_u, c_u, s_d, c_d;\n"
+    "    full_add(l[0], c[0], r[0], s_u, c_u);\n"
+    "    full_add(l[2], c[2], r[2], s_d, c_d);\n"
+    "    uint s_m = l[1] ^ r[1], c_m = l[1] & r[1];\n"
+    "    uint b0, k1, t0, t1;\n"
+    "    full_add(s_u, s_d, s_m, b0, k1);\n"
+    "    full_add(c_u, c_d, c_m, t0, t1);\n"
+    "    uint b1 = t0 ^ k1, t2 = t0 & k1;\n"
+    "    uint b2 = t1 ^ t2, b3 = t1 & t2;\n"
+    "\n"
+    "    uint alive = c[1], born = 0u, keep = 0u;\n"
+    "    for (uint k = 0u; k <= 8u; k++) {\n"
+    "        if ((((birth_rules | survival_rules) >> k) & 1u) == 0u) continue;\n"
+    "        uint eq = ((k & 1u) != 0u ? b0 : ~b0) & ((k & 2u) != 0u ? b1 : ~b1)\n"
+    "                & ((k & 4u) != 0u ? b2 : ~b2) & ((k & 8u) != 0u ? b3 : ~b3);\n"
+    "        if (((birth_rules >> k) & 1u) != 0u) born |= eq;\n"
+    "        if (((survival_rules >> k) & 1u) != 0u) keep |= eq;\n"
+    "    }\n"
+    "\n"
+    "    uint result = (~alive & born) | (alive & keep);\n"
+    "    if (uint(w) + 1u == words_per_row) result &= last_mask;\n"
+    "    next_words[uint(x) * words_per_row + uint(w)] = result;\n"
+    "}\n";
+
+/**
+ * @brief हर row के जीवित cells गिनने वाला compute shader
+ */
+static const char *const gpu_count_source =
+    "#version 430\n"
+    "layout(local_size_x = 64) in;\n"
+    "layout(std430, binding = 0) readonly buffer Current { uint current[]; };\n"
+    "layout(std430, binding = 2) writeonly buffer Counts { uint counts[]; };\n"
+    "uniform uint height;\n"
+    "uniform uint words_per_row;\n"
+    "\n"
+    "void main() {\n"
+    "    uint x = gl_GlobalInvocationID.x;\n"
+    "    if (x >= height) return;\n"
+    "    uint total = 0u;\n"
+    "    for (uint w = 0u; w < words_per_row; w++) total += uint(bitCount(current[x * words_per_row + w]));\n"
+    "    counts[x] = total;\n"
+    "}\n";
+
+/**
+ * @brief Backend के इस्तेमाल होने वाले GL functions (type, नाम बिना "gl" prefix)
+ */
+#define GPU_GL_FUNCTIONS(X) \
+    X(PFNGLGETSTRINGPROC, GetString) \
+    X(PFNGLGETERRORPROC, GetError) \
+    X(PFNGLGETINTEGERVPROC, GetIntegerv) \
+    X(PFNGLGETINTEGERI_VPROC, GetIntegeri_v) \
+    X(PFNGLCREATESHADERPROC, CreateShader) \
+    X(PFNGLSHADERSOURCEPROC, ShaderSource) \
+    X(PFNGLCOMPILESHADERPROC, CompileShader) \
+    X(PFNGLGETSHADERIVPROC, GetShaderiv) \
+    X(PFNGLGETSHADERINFOLOGPROC, GetShaderInfoLog) \
+    X(PFNGLDELETESHADERPROC, DeleteShader) \
+    X(PFNGLCREATEPROGRAMPROC, CreateProgram) \
+    X(PFNGLATTACHSHADERPROC, AttachShader) \
+    X(PFNGLLINKPROGRAMPROC, LinkProgram) \
+    X(PFNGLGETPROGRAMIVPROC, GetProgramiv) \
+    X(PFNGLGETPROGRAMINFOLOGPROC, GetProgramInfoLog) \
+    X(PFNGLDELETEPROGRAMPROC, DeleteProgram) \
+    X(PFNGLUSEPROGRAMPROC, UseProgram) \
+    X(PFNGLGETUNIFORMLOCATIONPROC, GetUniformLocation) \
+    X(PFNGLUNIFORM1UIPROC, Uniform1ui) \
+    X(PFNGLGENBUFFERSPROC, GenBuffers) \
+    X(PFNGLDELETEBUFFERSPROC, DeleteBuffers) \
+    X(PFNGLBINDBUFFERPROC, BindBuffer) \
+    X(PFNGLBINDBUFFERBASEPROC, BindBufferBase) \
+    X(PFNGLBUFFERDATAPROC, BufferData) \
+    X(PFNGLBUFFERSUBDATAPROC, BufferSubData) \
+    X(PFNGLGETBUFFERSUBDATAPROC, GetBufferSubData) \
+    X(PFNGLDISPATCHCOMPUTEPROC, DispatchCompute) \
+    X(PFNGLMEMORYBARRIERPROC, MemoryBarrier) \
+    X(PFNGLFINISHPROC, Finish)
+
+/**
+ * @brief Loaded GL function pointers
+ */
+typedef struct GpuGL {
+#define GPU_GL_FIELD(type, name) type name;
+    GPU_GL_FUNCTIONS(GPU_GL_FIELD)
+#undef GPU_GL_FIELD
+} GpuGL;
+
+/**
+ * @brief GPU बोर्ड: device buffers, shaders और उनका context
+ */
+struct GpuBoard {
+    size_t height;              /**< बोर्ड की ऊंचाई */
+    size_t width;               /**< बोर्ड की चौड़ाई */
+    size_t words_per_row;       /**< प्रति row 32-bit words */
+    EGLDisplay display;         /**< EGL display */
+    EGLContext context;         /**< OpenGL 4.3 core context (बिना surface) */
+    GpuGL gl;                   /**< GL functions */
+    GLuint buffers[2];          /**< Front/back cell buffers */
+    GLuint counts;              /**< हर row की population (gpu_board_population) */
+    int front;                  /**< buffers में current generation का index */
+    GLuint step_program;        /**< gpu_step_source */
+    GLuint count_program;       /**< gpu_count_source */
+    char renderer[128];         /**< GL_RENDERER */
+};
+
+/**
+ * @brief space-separated extension list में name है या नहीं
+ * @param list extensions string (NULL हो सकता है)
+ * @param name extension
+ * @return है तो 1, वरना 0
+ */
+static int gpu_has_extension(const char *list, const char *name) {
+    size_t length = strlen(name);
+    for (const char *p = list; p != NULL && (p = strstr(p, name)) != NULL; p += length) {
+        if ((p == list || p[-1] == ' ') && (p[length] == ' ' || p[length] == '\0')) return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief बोर्ड का context इस thread पर current करता है
+ * @param board GPU बोर्ड
+ * @return सफल होने पर 0, EGL error पर -1
+ */
+static int gpu_make_current(const GpuBoard *board) {
+    return eglMakeCurrent(board->display, EGL_NO_SURFACE, EGL_NO_SURFACE, board->context) ? 0 : -1;
+}
+
+/**
+ * @brief एक compute shader compile और link करता है
+ * @param gl GL functions
+ * @param source GLSL source
+ * @return सफल होने पर program, compile/link error पर 0 (log print होता है)
+ */
+static GLuint gpu_compile(const GpuGL *gl, const char *source) {
+    char log[1024];
+    GLint ok = 0;
+
+    GLuint shader = gl->CreateShader(GL_COMPUTE_SHADER);
+    if (shader == 0) return 0;
+    gl->ShaderSource(shader, 1, &source, NULL);
+    gl->CompileShader(shader);
+    gl->GetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+    if (!ok) {
+        gl->GetShaderInfoLog(shader, sizeof(log), NULL, log);
+        printf("GPU shader compile error: %s\n", log);
+        gl->DeleteShader(shader);
+        return 0;
+    }
+
+    GLuint program = gl->CreateProgram();
+    gl->AttachShader(program, shader);
+    gl->LinkProgram(program);
+    gl->DeleteShader(shader);
+    gl->GetProgramiv(program, GL_LINK_STATUS, &ok);
+    if (!ok) {
+        gl->GetProgramInfoLog(program, sizeof(log), NULL, log);
+        printf("GPU shader link error: %s\n", log);
+        gl->DeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+/**
+ * @brief program का uint uniform set करता है (program use में होना चाहिए)
+ * @param board GPU बोर्ड
+ * @param program program
+ * @param name uniform का नाम
+ * @param value value
+ */
+static void gpu_uniform(const GpuBoard *board, GLuint program, const char *name, GLuint value) {
+    board->gl.Uniform1ui(board->gl.GetUniformLocation(program, name), value);
+}
+
+/**
+ * @brief surfaceless EGL display और OpenGL 4.3 core context बनाता है
+ * @param board target बोर्ड (display और context भरते हैं)
+ * @return सफल होने पर 0, error पर -1 (कारण print होता है)
+ */
+static int gpu_create_context(GpuBoard *board) {
+    // Window system के बिना: Mesa का surfaceless platform, वरना default display
+    const char *client = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    PFNEGLGETPLATFORMDISPLAYEXTPROC get_platform_display =
+        (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    board->display = EGL_NO_DISPLAY;
+    if (get_platform_display != NULL && gpu_has_extension(client, "EGL_MESA_platform_surfaceless")) {
+        board->display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    }
+    if (board->display == EGL_NO_DISPLAY) board->display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (board->display == EGL_NO_DISPLAY || !eglInitialize(board->display, NULL, NULL)) {
+        printf("GPU: no EGL display available\n");
+        return -1;
+    }
+
+    const char *extensions = eglQueryString(board->display, EGL_EXTENSIONS);
+    if (!gpu_has_extension(extensions, "EGL_KHR_surfaceless_context") || !eglBindAPI(EGL_OPENGL_API)) {
+        printf("GPU: EGL display cannot create OpenGL contexts without a window\n");
+        return -1;
+    }
+
+    EGLConfig config = EGL_NO_CONFIG_KHR;
+    if (!gpu_has_extension(extensions, "EGL_KHR_no_config_context")) {
+        const EGLint config_attributes[] = {EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE};
+        EGLint count = 0;
+        if (!eglChooseConfig(board->display, config_attributes, &config, 1, &count) || count < 1) {
+            printf("GPU: no OpenGL capable EGL config\n");
+            return -1;
+        }
+    }
+
+    const EGLint context_attributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 4,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    board->context = eglCreateContext(board->display, config, EGL_NO_CONTEXT, context_attributes);
+    if (board->context == EGL_NO_CONTEXT || gpu_make_current(board) != 0) {
+        printf("GPU: OpenGL 4.3 (compute shaders) is not available\n");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief यह build GPU backend के साथ है या नहीं
+ * @return 1
+ */
+int gpu_board_supported(void) {
+    return 1;
+}
+
+/**
+ * @brief GL context और दो device buffers बनाता है (सभी cells मृत)
+ *
+ * Buffer का size और dispatch grid device की limits (GL_MAX_SHADER_STORAGE_BLOCK_SIZE,
+ * GL_MAX_COMPUTE_WORK_GROUP_COUNT) के अंदर होने चाहिए।
+ *
+ * @param height बोर्ड की ऊंचाई
+ * @param width बोर्ड की चौड़ाई
+ * @return सफल होने पर GpuBoard pointer, error होने पर NULL
+ */
+GpuBoard *gpu_board_init(size_t height, size_t width) {
+    if (height == 0 || width == 0) return NULL;
+
+    GpuBoard *board = calloc(1, sizeof(GpuBoard));
+    uint32_t *zeros = NULL;
+    if (board == NULL) return NULL;
+    board->height = height;
+    board->width = width;
+    board->words_per_row = (width + 31) / 32;
+    board->context = EGL_NO_CONTEXT;
+    if (gpu_create_context(board) != 0) goto fail;
+
+    GpuGL *gl = &board->gl;
+#define GPU_GL_LOAD(type, name) \
+    if ((gl->name = (type)eglGetProcAddress("gl" #name)) == NULL) { \
+        printf("GPU: missing GL function gl%s\n", #name); \
+        goto fail; \
+    }
+    GPU_GL_FUNCTIONS(GPU_GL_LOAD)
+#undef GPU_GL_LOAD
+
+    const char *renderer = (const char *)gl->GetString(GL_RENDERER);
+    snprintf(board->renderer, sizeof(board->renderer), "%s", renderer ? renderer : "unknown");
+
+    // Device limits: एक buffer और dispatch grid
+    GLint max_block = 0, max_groups_x = 0, max_groups_y = 0;
+    gl->GetIntegerv(GL_MAX_SHADER_STORAGE_BLOCK_SIZE, &max_block);
+    gl->GetIntegeri_v(GL_MAX_COMPUTE_WORK_GROUP_COUNT, 0, &max_groups_x);
+    gl->GetIntegeri_v(GL_MAX_COMPUTE_WORK_GROUP_COUNT, 1, &max_groups_y);
+    size_t bytes = board->words_per_row * height * sizeof(uint32_t);
+    if (bytes > (size_t)max_block || (board->words_per_row + GPU_GROUP_SIZE - 1) / GPU_GROUP_SIZE > (size_t)max_groups_x ||
+        (height + GPU_GROUP_SIZE - 1) / GPU_GROUP_SIZE > (size_t)max_groups_y ||
+        (height + GPU_COUNT_GROUP_SIZE - 1) / GPU_COUNT_GROUP_SIZE > (size_t)max_groups_x) {
+        printf("GPU: %zux%zu board exceeds the limits of %s\n", height, width, board->renderer);
+        goto fail;
+    }
+
+    board->step_program = gpu_compile(gl, gpu_step_source);
+    board->count_program = gpu_compile(gl, gpu_count_source);
+    if (board->step_program == 0 || board->count_program == 0) goto fail;
+
+    zeros = calloc(board->words_per_row * height, sizeof(uint32_t));
+    if (zeros == NULL) goto fail;
+    gl->GenBuffers(2, board->buffers);
+    gl->GenBuffers(1, &board->counts);
+    for (int i = 0; i < 2; i++) {
+        gl->BindBuffer(GL_SHADER_STORAGE_BUFFER, board->buffers[i]);
+        gl->BufferData(GL_SHADER_STORAGE_BUFFER, (GLsizeiptr)bytes, zeros, GL_DYNAMIC_COPY);
+    }
+    gl->BindBuffer(GL_SHADER_STORAGE_BUFFER, board->counts);
+    gl->BufferData(GL_SHADER_STORAGE_BUFFER, (GLsizeiptr)(height * sizeof(uint32_t)), NULL, GL_DYNAMIC_READ);
+    free(zeros);
+    zeros = NULL;
+    if (gl->GetError() != GL_NO_ERROR) {
+        printf("GPU: cannot allocate %zu bytes of device memory\n", 2 * bytes);
+        goto fail;
+    }
+
+    return board;
+
+fail:
+    free(zeros);
+    gpu_board_free(board);
+    return NULL;
+}
+
+/**
+ * @brief device buffers और context free करता है
+ *
+ * EGL display terminate नहीं होता, क्योंकि process के दूसरे GPU boards
+ * उसी display को share करते हैं।
+ *
+ * @param board free करने वाला बोर्ड
+ * @return सफल होने पर 0, NULL pointer पर -1
+ */
+int gpu_board_free(GpuBoard *board) {
+    if (board == NULL) return -1;
+
+    if (board->context != EGL_NO_CONTEXT) {
+        if (gpu_make_current(board) == 0 && board->gl.DeleteBuffers != NULL) {
+            if (board->buffers[0] != 0) board->gl.DeleteBuffers(2, board->buffers);
+            if (board->counts != 0) board->gl.DeleteBuffers(1, &board->counts);
+            if (board->step_program != 0) board->gl.DeleteProgram(board->step_program);
+            if (board->count_program != 0) board->gl.DeleteProgram(board->count_program);
+        }
+        eglMakeCurrent(board->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(board->display, board->context);
+    }
+    free(board);
+    return 0;
+}
+
+/**
+ * @brief GL driver का नाम
+ * @param board GPU बोर्ड
+ * @return renderer string (NULL होने पर "none")
+ */
+const char *gpu_board_renderer(const GpuBoard *board) {
+    return board ? board->renderer : "none";
+}
+
+/**
+ * @brief Board के cells device पर upload करता है
+ *
+ * Cells पहले host पर 32-bit words में pack होते हैं, फिर एक
+ * glBufferSubData से front buffer में जाते हैं।
+ *
+ * @param dst GPU बोर्ड
+ * @param src source बोर्ड (same size)
+ * @return सफल होने पर 0, size mismatch, memory या GL error पर -1
+ */
+int gpu_board_from_board(GpuBoard *dst, const Board *src) {
+    if (dst == NULL || src == NULL) return -1;
+    if (dst->height != src->height || dst->width != src->width) return -1;
+    if (gpu_make_current(dst) != 0) return -1;
+
+    size_t count = dst->words_per_row * dst->height;
+    uint32_t *words = calloc(count, sizeof(uint32_t));
+    if (words == NULL) return -1;
+    for (size_t x = 0; x < src->height; x++) {
+        const char *row = &src->cells[BOARD_INDEX(src, x, 0)];
+        uint32_t *out = &words[x * dst->words_per_row];
+        for (size_t y = 0; y < src->width; y++) {
+            out[y / 32] |= (uint32_t)(row[y] == 1) << (y % 32);
+        }
+    }
+
+    dst->gl.BindBuffer(GL_SHADER_STORAGE_BUFFER, dst->buffers[dst->front]);
+    dst->gl.BufferSubData(GL_SHADER_STORAGE_BUFFER, 0, (GLsizeiptr)(count * sizeof(uint32_t)), words);
+    free(words);
+    return dst->gl.GetError() == GL_NO_ERROR ? 0 : -1;
+}
+
+/**
+ * @brief device से cells readback करके Board में लिखता है
+ * @param src GPU बोर्ड
+ * @param dst target बोर्ड (same size)
+ * @return सफल होने पर 0, size mismatch, memory या GL error पर -1
+ */
+int gpu_board_to_board(GpuBoard *src, Board *dst) {
+    if (src == NULL || dst == NULL) return -1;
+    if (dst->height != src->height || dst->width != src->width) return -1;
+    if (gpu_make_current(src) != 0) return -1;
+
+    size_t count = src->words_per_row * src->height;
+    uint32_t *words = malloc(count * sizeof(uint32_t));
+    if (words == NULL) return -1;
+
+    src->gl.MemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+    src->gl.BindBuffer(GL_SHADER_STORAGE_BUFFER, src->buffers[src->front]);
+    src->gl.GetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, (GLsizeiptr)(count * sizeof(uint32_t)), words);
+    if (src->gl.GetError() != GL_NO_ERROR) {
+        free(words);
+        return -1;
+    }
+
+    for (size_t x = 0; x < dst->height; x++) {
+        char *row = &dst->cells[BOARD_INDEX(dst, x, 0)];
+        const uint32_t *in = &words[x * src->words_per_row];
+        for (size_t y = 0; y < dst->width; y++) {
+            row[y] = (char)((in[y / 32] >> (y % 32)) & 1);
+        }
+    }
+    free(words);
+    board_mark_all_dirty(dst);
+    return 0;
+}
+
+/**
+ * @brief device पर generations चलाता है (बीच में कोई readback नहीं)
+ *
+ * हर generation के बाद सिर्फ एक memory barrier है ताकि अगला dispatch
+ * पिछले के writes देखे; आखिर में एक glFinish।
+ *
+ * @param board GPU बोर्ड
+ * @param rules apply करने वाले rules (सिर्फ outer-totalistic)
+ * @param generations कितनी generations
+ * @return सफल होने पर 0, unsupported rules या GL error पर -1
+ */
+int gpu_board_next(GpuBoard *board, const Rules *rules, long generations) {
+    if (board == NULL || rules == NULL || generations < 0) return -1;
+    if (rules->kernel != RULES_KERNEL_TOTALISTIC) return -1;
+    if (gpu_make_current(board) != 0) return -1;
+
+    const GpuGL *gl = &board->gl;
+    GLuint program = board->step_program;
+    uint32_t tail = (uint32_t)(board->width % 32);
+    gl->UseProgram(program);
+    gpu_uniform(board, program, "height", (GLuint)board->height);
+    gpu_uniform(board, program, "words_per_row", (GLuint)board->words_per_row);
+    gpu_uniform(board, program, "last_mask", tail ? ((uint32_t)1 << tail) - 1 : ~(uint32_t)0);
+    gpu_uniform(board, program, "birth_rules", rules->birth_rules);
+    gpu_uniform(board, program, "survival_rules", rules->survival_rules);
+
+    GLuint groups_x = (GLuint)((board->words_per_row + GPU_GROUP_SIZE - 1) / GPU_GROUP_SIZE);
+    GLuint groups_y = (GLuint)((board->height + GPU_GROUP_SIZE - 1) / GPU_GROUP_SIZE);
+    for (long g = 0; g < generations; g++) {
+        gl->BindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, board->buffers[board->front]);
+        gl->BindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, board->buffers[1 - board->front]);
+        gl->DispatchCompute(groups_x, groups_y, 1);
+        gl->MemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+        board->front = 1 - board->front;
+    }
+    gl->Finish();
+    return gl->GetError() == GL_NO_ERROR ? 0 : -1;
+}
+
+/**
+ * @brief जीवित cells गिनता है (device पर हर row की count, readback सिर्फ counts का)
+ * @param board GPU बोर्ड
+ * @return population (NULL या error पर 0)
+ */
+uint64_t gpu_board_population(GpuBoard *board) {
+    if (board == NULL || gpu_make_current(board) != 0) return 0;
+
+    const GpuGL *gl = &board->gl;
+    uint32_t *counts = malloc(board->height * sizeof(uint32_t));
+    if (counts == NULL) return 0;
+
+    gl->UseProgram(board->count_program);
+    gpu_uniform(board, board->count_program, "height", (GLuint)board->height);
+    gpu_uniform(board, board->count_program, "words_per_row", (GLuint)board->words_per_row);
+    gl->BindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, board->buffers[board->front]);
+    gl->BindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, board->counts);
+    gl->DispatchCompute((GLuint)((board->height + GPU_COUNT_GROUP_SIZE - 1) / GPU_COUNT_GROUP_SIZE), 1, 1);
+    gl->MemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+    gl->BindBuffer(GL_SHADER_STORAGE_BUFFER, board->counts);
+    gl->GetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, (GLsizeiptr)(board->height * sizeof(uint32_t)), counts);
+
+    uint64_t population = 0;
+    if (gl->GetError() == GL_NO_ERROR) {
+        for (size_t x = 0; x < board->height; x++) population += counts[x];
+    }
+    free(counts);
+    return population;
+}
+
+#else // GOL_GPU
+
+/**
+ * @brief यह build GPU backend के साथ है या नहीं
+ * @return 0 (GOL_GPU के बिना build)
+ */
+int gpu_board_supported(void) {
+    return 0;
+}
+
+/**
+ * @brief GPU backend के बिना build में हमेशा fail होता है
+ * @param height बोर्ड की ऊंचाई
+ * @param width बोर्ड की चौड़ाई
+ * @return NULL
+ */
+GpuBoard *gpu_board_init(size_t height, size_t width) {
+    (void)height;
+    (void)width;
+    return NULL;
+}
+
+/**
+ * @brief GPU backend के बिना build में कुछ free करने को नहीं है
+ * @param board बोर्ड (हमेशा NULL)
+ * @return -1
+ */
+int gpu_board_free(GpuBoard *board) {
+    (void)board;
+    return -1;
+}
+
+/**
+ * @brief GPU backend के बिना build में कोई renderer नहीं
+ * @param board बोर्ड (हमेशा NULL)
+ * @return "none"
+ */
+const char *gpu_board_renderer(const GpuBoard *board) {
+    (void)board;
+    return "none";
+}
+
+/**
+ * @brief GPU backend के बिना build में हमेशा fail होता है
+ * @param dst GPU बोर्ड
+ * @param src source बोर्ड
+ * @return -1
+ */
+int gpu_board_from_board(GpuBoard *dst, const Board *src) {
+    (void)dst;
+    (void)src;
+    return -1;
+}
+
+/**
+ * @brief GPU backend के बिना build में हमेशा fail होता है
+ * @param src GPU बोर्ड
+ * @param dst target बोर्ड
+ * @return -1
+ */
+int gpu_board_to_board(GpuBoard *src, Board *dst) {
+    (void)src;
+    (void)dst;
+    return -1;
+}
+
+/**
+ * @brief GPU backend के बिना build में हमेशा fail होता है
+ * @param board GPU बोर्ड
+ * @param rules rules
+ * @param generations generations
+ * @return -1
+ */
+int gpu_board_next(GpuBoard *board, const Rules *rules, long generations) {
+    (void)board;
+    (void)rules;
+    (void)generations;
+    return -1;
+}
+
+/**
+ * @brief GPU backend के बिना build में population हमेशा 0
+ * @param board GPU बोर्ड
+ * @return 0
+ */
+uint64_t gpu_board_population(GpuBoard *board) {
+    (void)board;
+    return 0;
+}
+
+#endif // GOL_GPU
@@ -0,0 +1,106 @@
+/**
+ * @file gpu_board.h
+ * @brief GPU पर OpenGL compute shaders से stepping करने वाले backend का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Cells GPU memory में दो shader storage buffers (front/back) में रहते
+ * हैं, PackedBoard जैसे bit-packed (32 cells प्रति word)। हर generation
+ * एक compute dispatch है जो हर word के लिए वही bit-sliced adder tree
+ * चलाता है; generations के बीच कुछ भी CPU पर नहीं आता। Readback सिर्फ
+ * gpu_board_to_board (save, output) और gpu_board_population पर होता है।
+ *
+ * Context EGL से बिना window के बनता है (OpenGL 4.3 core), इसलिए
+ * headless compute nodes पर भी चलता है। Backend optional है:
+ * "make headless GPU=1" से build हो (GOL_GPU define, -lEGL link), वरना
+ * सभी functions fail होते हैं और gpu_board_supported 0 देता है।
+ *
+ * Context उसी thread पर current होता है जिसने gpu_board_init call किया;
+ * एक GpuBoard के सभी calls उसी thread से होने चाहिए।
+ */
+
+#ifndef GPU_BOARD_H
+#define GPU_BOARD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "board.h"
+#include "rules.h"
+
+/**
+ * @brief Opaque GPU बोर्ड (device buffers और उनका GL context)
+ */
+typedef struct GpuBoard GpuBoard;
+
+/**
+ * @brief यह build GPU backend के साथ है या नहीं
+ * @return GOL_GPU के साथ build हो तो 1, वरना 0
+ */
+int gpu_board_supported(void);
+
+/**
+ * @brief GL context और दो device buffers बनाता है (सभी cells मृत)
+ *
+ * Failure का कारण (कोई GPU/driver नहीं, बोर्ड device limits से बड़ा) print होता है।
+ *
+ * @param height बोर्ड की ऊंचाई
+ * @param width बोर्ड की चौड़ाई
+ * @return सफल होने पर GpuBoard pointer, error या GPU support न होने पर NULL
+ */
+GpuBoard *gpu_board_init(size_t height, size_t width);
+
+/**
+ * @brief device buffers और context free करता है
+ * @param board free करने वाला बोर्ड
+ * @return सफल होने पर 0, NULL pointer पर -1
+ */
+int gpu_board_free(GpuBoard *board);
+
+/**
+ * @brief GL driver का नाम (जैसे "llvmpipe" या GPU model)
+ * @param board GPU बोर्ड
+ * @return renderer string (NULL होने पर "none")
+ */
+const char *gpu_board_renderer(const GpuBoard *board);
+
+/**
+ * @brief Board के cells device पर upload करता है
+ * @param dst GPU बोर्ड
+ * @param src source बोर्ड (same size)
+ * @return सफल होने पर 0, size mismatch या GL error पर -1
+ */
+int gpu_board_from_board(GpuBoard *dst, const Board *src);
+
+/**
+ * @brief device से cells readback करके Board में लिखता है
+ *
+ * Target बोर्ड की सभी tiles dirty mark होती हैं।
+ *
+ * @param src GPU बोर्ड
+ * @param dst target बोर्ड (same size)
+ * @return सफल होने पर 0, size mismatch या GL error पर -1
+ */
+int gpu_board_to_board(GpuBoard *src, Board *dst);
+
+/**
+ * @brief device पर generations चलाता है (बीच में कोई readback नहीं)
+ *
+ * हर generation एक dispatch है; call GPU के पूरा करने तक return नहीं
+ * होता, ताकि timing सही रहे। बोर्ड के बाहर की cells मृत हैं।
+ *
+ * @param board GPU बोर्ड
+ * @param rules apply करने वाले rules (सिर्फ outer-totalistic)
+ * @param generations कितनी generations
+ * @return सफल होने पर 0, unsupported rules या GL error पर -1
+ */
+int gpu_board_next(GpuBoard *board, const Rules *rules, long generations);
+
+/**
+ * @brief जीवित cells गिनता है (device पर हर row की count, readback सिर्फ counts का)
+ * @param board GPU बोर्ड
+ * @return population (NULL या error पर 0)
+ */
+uint64_t gpu_board_population(GpuBoard *board);
+
+#endif // GPU_BOARD_H
@@ -0,0 +1,642 @@
+/**
+ * @file hashlife.c
+ * @brief Hashlife stepping backend का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Nodes बड़े slabs में allocate होते हैं और एक open hash table (chaining)
+ * में उनके चार children से canonicalize होते हैं। Level 0 nodes दो fixed
+ * leaves (मृत/जीवित) हैं। Level 2 (4x4) का result rules की compiled
+ * neighborhood table से directly निकलता है, ऊपर के levels recursive हैं।
+ *
+ * Quadrants की naming row/column convention पर है: nw = (कम row, कम
+ * column), ne = (कम row, ज्यादा column), sw = (ज्यादा row, कम column),
+ * se = (ज्यादा row, ज्यादा column)। Level k का root plane के
+ * [-2^(k-1), 2^(k-1)) square को cover करता है।
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "hashlife.h"
+
+/**
+ * @brief एक slab में nodes की संख्या
+ */
+#define HASHLIFE_SLAB_NODES 4096
+
+/**
+ * @brief Hash table के buckets की शुरुआती संख्या (power of two)
+ */
+#define HASHLIFE_INITIAL_BUCKETS ((size_t)1 << 16)
+
+/**
+ * @brief step_result खाली होने का marker
+ */
+#define HASHLIFE_NO_STEP 0xFF
+
+/**
+ * @brief Quadtree node (canonical, immutable content)
+ */
+typedef struct HashNode {
+    struct HashNode *nw, *ne, *sw, *se;   /**< चार quadrants (level 0 पर NULL) */
+    struct HashNode *result;              /**< Memo: center, 2^(level-2) generations बाद */
+    struct HashNode *step_result;         /**< Memo: center, 2^step_exp generations बाद */
+    struct HashNode *next;                /**< Hash chain या free list */
+    uint64_t population;                  /**< जीवित cells की संख्या */
+    uint8_t level;                        /**< Square का size 2^level (0 = free slot, leaves को छोड़कर) */
+    uint8_t step_exp;                     /**< step_result किस exponent के लिए है */
+    uint8_t mark;                         /**< Garbage collection mark */
+} HashNode;
+
+/**
+ * @brief Nodes का एक allocation block
+ */
+typedef struct NodeSlab {
+    struct NodeSlab *next;
+    HashNode nodes[HASHLIFE_SLAB_NODES];
+} NodeSlab;
+
+struct HashLife {
+    uint8_t table[RULES_NEIGHBORHOOD_SIZE];     /**< Rules की neighborhood table की copy */
+    HashNode leaf[2];                           /**< Level 0: मृत और जीवित cell */
+    HashNode **buckets;                         /**< Hash table */
+    size_t bucket_count;                        /**< Buckets की संख्या (power of two) */
+    size_t node_count;                          /**< Table में nodes */
+    HashNode *free_list;                        /**< Collect हुए slots */
+    NodeSlab *slabs;                            /**< सभी allocated slabs */
+    HashNode *empty[HASHLIFE_MAX_LEVEL + 1];    /**< हर level का खाली node (lazy) */
+    HashNode *root;                             /**< Current universe */
+    int64_t origin_x, origin_y;                 /**< Board की cell (0, 0) की plane position */
+    size_t height, width;                       /**< Load किए गए बोर्ड का size */
+    uint64_t generation;                        /**< Load के बाद की generations */
+    size_t cache_bytes;                         /**< Memory limit */
+};
+
+/**
+ * @brief चार children के pointers से hash value निकालता है
+ * @param nw उत्तर-पश्चिम child
+ * @param ne उत्तर-पूर्व child
+ * @param sw दक्षिण-पश्चिम child
+ * @param se दक्षिण-पूर्व child
+ * @return hash (bucket के लिए mask करें)
+ */
+static size_t node_hash(const HashNode *nw, const HashNode *ne, const HashNode *sw, const HashNode *se) {
+    uint64_t h = (uint64_t)(uintptr_t)nw;
+    h = h * 0x9E3779B97F4A7C15ull + (uint64_t)(uintptr_t)ne;
+    h = h * 0x9E3779B97F4A7C15ull + (uint64_t)(uintptr_t)sw;
+    h = h * 0x9E3779B97F4A7C15ull + (uint64_t)(uintptr_t)se;
+    return (size_t)(h ^ (h >> 29));
+}
+
+/**
+ * @brief hash table का size दोगुना करता है
+ *
+ * Allocation fail होने पर पुरानी table ही रहती है (chains लंबी होंगी)।
+ *
+ * @param life target universe
+ */
+static void table_grow(HashLife *life) {
+    size_t count = life->bucket_count * 2;
+    HashNode **buckets = calloc(count, sizeof(HashNode *));
+    if (!buckets) return;
+
+    for (size_t i = 0; i < life->bucket_count; i++) {
+        HashNode *node = life->buckets[i];
+        while (node) {
+            HashNode *next = node->next;
+            size_t b = node_hash(node->nw, node->ne, node->sw, node->se) & (count - 1);
+            node->next = buckets[b];
+            buckets[b] = node;
+            node = next;
+        }
+    }
+
+    free(life->buckets);
+    life->buckets = buckets;
+    life->bucket_count = count;
+}
+
+/**
+ * @brief चार children वाला canonical node return करता है (जरूरत हो तो बनाता है)
+ *
+ * @param life target universe
+ * @param nw उत्तर-पश्चिम child
+ * @param ne उत्तर-पूर्व child
+ * @param sw दक्षिण-पश्चिम child
+ * @param se दक्षिण-पूर्व child
+ * @return node, या memory allocation fail होने पर NULL
+ */
+static HashNode *find_node(HashLife *life, HashNode *nw, HashNode *ne, HashNode *sw, HashNode *se) {
+    if (!nw || !ne || !sw || !se) return NULL;
+
+    size_t b = node_hash(nw, ne, sw, se) & (life->bucket_count - 1);
+    for (HashNode *node = life->buckets[b]; node; node = node->next) {
+        if (node->nw == nw && node->ne == ne && node->sw == sw && node->se == se) return node;
+    }
+
+    if (!life->free_list) {
+        NodeSlab *slab = malloc(sizeof(NodeSlab));
+        if (!slab) return NULL;
+        slab->next = life->slabs;
+        life->slabs = slab;
+        for (size_t i = 0; i < HASHLIFE_SLAB_NODES; i++) {
+            slab->nodes[i].level = 0;
+            slab->nodes[i].next = life->free_list;
+            life->free_list = &slab->nodes[i];
+        }
+    }
+
+    HashNode *node = life->free_list;
+    life->free_list = node->next;
+
+    node->nw = nw;
+    node->ne = ne;
+    node->sw = sw;
+    node->se = se;
+    node->result = NULL;
+    node->step_result = NULL;
+    node->population = nw->population + ne->population + sw->population + se->population;
+    node->level = (uint8_t)(nw->level + 1);
+    node->step_exp = HASHLIFE_NO_STEP;
+    node->mark = 0;
+
+    node->next = life->buckets[b];
+    life->buckets[b] = node;
+    life->node_count++;
+    if (life->node_count > life->bucket_count) table_grow(life);
+
+    return node;
+}
+
+/**
+ * @brief दिए गए level का खाली node
+ * @param life target universe
+ * @param level node का level
+ * @return node, या memory allocation fail होने पर NULL
+ */
+static HashNode *empty_node(HashLife *life, unsigned level) {
+    if (level == 0) return &life->leaf[0];
+    if (!life->empty[level]) {
+        HashNode *e = empty_node(life, level - 1);
+        life->empty[level] = find_node(life, e, e, e, e);
+    }
+    return life->empty[level];
+}
+
+/**
+ * @brief node का बीच वाला आधे size का square (बिना time advance)
+ * @param life target universe
+ * @param node level >= 2 वाला node
+ * @return level - 1 का node, या memory allocation fail होने पर NULL
+ */
+static HashNode *node_center(HashLife *life, HashNode *node) {
+    return find_node(life, node->nw->se, node->ne->sw, node->sw->ne, node->se->nw);
+}
+
+/**
+ * @brief 4x4 node का center 2x2 एक generation बाद (rules table से)
+ * @param life target universe
+ * @param node level 2 का node
+ * @return level 1 का node, या memory allocation fail होने पर NULL
+ */
+static HashNode *node_base_result(HashLife *life, HashNode *node) {
+    // 4x4 grid: [row][column]
+    unsigned grid[4][4];
+    HashNode *quad[2][2] = { { node->nw, node->ne }, { node->sw, node->se } };
+    for (int x = 0; x < 4; x++) {
+        for (int y = 0; y < 4; y++) {
+            HashNode *q = quad[x >> 1][y >> 1];
+            HashNode *cell = (x & 1) ? ((y & 1) ? q->se : q->sw) : ((y & 1) ? q->ne : q->nw);
+            grid[x][y] = (unsigned)cell->population;
+        }
+    }
+
+    HashNode *out[2][2];
+    for (int x = 1; x <= 2; x++) {
+        for (int y = 1; y <= 2; y++) {
+            // बायां column bits 6-8, current 3-5, दायां 0-2 (ऊपर = bit 2)
+            unsigned index = 0;
+            for (int dy = -1; dy <= 1; dy++) {
+                unsigned column = (grid[x - 1][y + dy] << 2) | (grid[x][y + dy] << 1) | grid[x + 1][y + dy];
+                index |= column << ((1 - dy) * 3);
+            }
+            out[x - 1][y - 1] = &life->leaf[life->table[index] & 1];
+        }
+    }
+
+    return find_node(life, out[0][0], out[0][1], out[1][0], out[1][1]);
+}
+
+/**
+ * @brief node का center 2^step_exp generations बाद
+ *
+ * step_exp == level - 2 पर यह पूरा Hashlife step है (node->result में
+ * memoized); छोटे step_exp पर पहले stage में time advance नहीं होता,
+ * सिर्फ दूसरे stage में (node->step_result में memoized)।
+ *
+ * @param life target universe
+ * @param node level >= 2 वाला node
+ * @param step_exp 2 की power (level - 2 से ज्यादा नहीं)
+ * @return level - 1 का node, या memory allocation fail होने पर NULL
+ */
+static HashNode *node_successor(HashLife *life, HashNode *node, unsigned step_exp) {
+    if (node->population == 0) return empty_node(life, node->level - 1u);
+
+    int full = step_exp + 2 == node->level;
+    if (full && node->result) return node->result;
+    if (!full && node->step_exp == step_exp && node->step_result) return node->step_result;
+
+    HashNode *result;
+    if (node->level == 2) {
+        result = node_base_result(life, node);
+    } else {
+        HashNode *nw = node->nw, *ne = node->ne, *sw = node->sw, *se = node->se;
+
+        // नौ overlapping sub-squares (level - 1)
+        HashNode *s[9] = {
+            nw,
+            find_node(life, nw->ne, ne->nw, nw->se, ne->sw),
+            ne,
+            find_node(life, nw->sw, nw->se, sw->nw, sw->ne),
+            node_center(life, node),
+            find_node(life, ne->sw, ne->se, se->nw, se->ne),
+            sw,
+            find_node(life, sw->ne, se->nw, sw->se, se->sw),
+            se
+        };
+
+        // पहला stage: full step में आधा time advance, वरना सिर्फ center
+        for (int i = 0; i < 9; i++) {
+            if (!s[i]) return NULL;
+            s[i] = full ? node_successor(life, s[i], step_exp - 1) : node_center(life, s[i]);
+            if (!s[i]) return NULL;
+        }
+
+        // दूसरा stage: चार level - 1 squares का successor
+        unsigned next_exp = full ? step_exp - 1 : step_exp;
+        HashNode *a = find_node(life, s[0], s[1], s[3], s[4]);
+        HashNode *b = find_node(life, s[1], s[2], s[4], s[5]);
+        HashNode *c = find_node(life, s[3], s[4], s[6], s[7]);
+        HashNode *d = find_node(life, s[4], s[5], s[7], s[8]);
+        if (!a || !b || !c || !d) return NULL;
+
+        result = find_node(life,
+                           node_successor(life, a, next_exp),
+                           node_successor(life, b, next_exp),
+                           node_successor(life, c, next_exp),
+                           node_successor(life, d, next_exp));
+    }
+    if (!result) return NULL;
+
+    if (full) {
+        node->result = result;
+    } else {
+        node->step_result = result;
+        node->step_exp = (uint8_t)step_exp;
+    }
+    return result;
+}
+
+/**
+ * @brief node और उसके सभी descendants को mark करता है
+ * @param node mark करने वाला node (NULL हो सकता है)
+ */
+static void node_mark(HashNode *node) {
+    if (node == NULL || node->level == 0 || node->mark) return;
+    node->mark = 1;
+    node_mark(node->nw);
+    node_mark(node->ne);
+    node_mark(node->sw);
+    node_mark(node->se);
+}
+
+/**
+ * @brief root और खाली nodes से unreachable सभी nodes free करता है
+ *
+ * Reachable nodes के memoized results तभी रहते हैं जब result node भी
+ * reachable हो।
+ *
+ * @param life target universe
+ */
+static void collect_garbage(HashLife *life) {
+    node_mark(life->root);
+    for (int level = 1; level <= HASHLIFE_MAX_LEVEL; level++) {
+        node_mark(life->empty[level]);
+    }
+
+    // पहला pass: marked nodes के dangling memos हटाएं
+    for (NodeSlab *slab = life->slabs; slab; slab = slab->next) {
+        for (size_t i = 0; i < HASHLIFE_SLAB_NODES; i++) {
+            HashNode *node = &slab->nodes[i];
+            if (node->level == 0 || !node->mark) continue;
+            if (node->result && !node->result->mark) node->result = NULL;
+            if (node->step_result && !node->step_result->mark) {
+                node->step_result = NULL;
+                node->step_exp = HASHLIFE_NO_STEP;
+            }
+        }
+    }
+
+    // दूसरा pass: table फिर से बनाएं और बाकी slots free list में डालें
+    memset(life->buckets, 0, life->bucket_count * sizeof(HashNode *));
+    life->node_count = 0;
+    for (NodeSlab *slab = life->slabs; slab; slab = slab->next) {
+        for (size_t i = 0; i < HASHLIFE_SLAB_NODES; i++) {
+            HashNode *node = &slab->nodes[i];
+            if (node->level == 0) continue;
+            if (!node->mark) {
+                node->level = 0;
+                node->next = life->free_list;
+                life->free_list = node;
+                continue;
+            }
+            node->mark = 0;
+            size_t b = node_hash(node->nw, node->ne, node->sw, node->se) & (life->bucket_count - 1);
+            node->next = life->buckets[b];
+            life->buckets[b] = node;
+            life->node_count++;
+        }
+    }
+}
+
+/**
+ * @brief cache limit पार होने पर garbage collect करता है
+ * @param life target universe
+ */
+static void enforce_cache_limit(HashLife *life) {
+    size_t bytes = life->node_count * sizeof(HashNode) + life->bucket_count * sizeof(HashNode *);
+    if (bytes > life->cache_bytes) collect_garbage(life);
+}
+
+/**
+ * @brief नया खाली Hashlife universe create करता है
+ *
+ * @param rules apply करने वाले rules (neighborhood table copy होती है)
+ * @param cache_bytes node cache की memory limit (0 = default)
+ * @return सफल होने पर HashLife pointer, असफल, B0 या Generations rules होने पर NULL
+ */
+HashLife *hashlife_init(const Rules *rules, size_t cache_bytes) {
+    HashLife *life = calloc(1, sizeof(HashLife));
+    if (!life) return NULL;
+
+    life->leaf[1].population = 1;
+    life->cache_bytes = cache_bytes ? cache_bytes : HASHLIFE_DEFAULT_CACHE_BYTES;
+    life->bucket_count = HASHLIFE_INITIAL_BUCKETS;
+    life->buckets = calloc(life->bucket_count, sizeof(HashNode *));
+
+    if (!life->buckets || hashlife_set_rules(life, rules) != 0) {
+        free(life->buckets);
+        free(life);
+        return NULL;
+    }
+
+    life->root = empty_node(life, 3);
+    if (!life->root) {
+        hashlife_free(life);
+        return NULL;
+    }
+    return life;
+}
+
+/**
+ * @brief universe और उसके सभी slabs की memory free करता है
+ * @param life free करने वाला universe
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int hashlife_free(HashLife *life) {
+    if (life == NULL) return -1;
+
+    while (life->slabs) {
+        NodeSlab *next = life->slabs->next;
+        free(life->slabs);
+        life->slabs = next;
+    }
+    free(life->buckets);
+    free(life);
+    return 0;
+}
+
+/**
+ * @brief rules बदलता है और सभी memoized results discard करता है
+ *
+ * Nodes खुद rules पर depend नहीं करते, इसलिए वो रहते हैं।
+ *
+ * @param life target universe
+ * @param rules नए rules
+ * @return सफल होने पर 0, NULL pointer, B0 या Generations rules होने पर -1
+ */
+int hashlife_set_rules(HashLife *life, const Rules *rules) {
+    if (life == NULL || rules == NULL) return -1;
+    // B0: खाली neighborhood में birth, खाली plane खाली नहीं रहता
+    if (rules->neighborhood[0] & 1) return -1;
+    // Leaves में सिर्फ दो states हैं
+    if (rules->kernel == RULES_KERNEL_GENERATIONS) return -1;
+
+    memcpy(life->table, rules->neighborhood, sizeof(life->table));
+    for (NodeSlab *slab = life->slabs; slab; slab = slab->next) {
+        for (size_t i = 0; i < HASHLIFE_SLAB_NODES; i++) {
+            slab->nodes[i].result = NULL;
+            slab->nodes[i].step_result = NULL;
+            slab->nodes[i].step_exp = HASHLIFE_NO_STEP;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief board के एक square region का node बनाता है
+ * @param life target universe (origin set होना चाहिए)
+ * @param board source बोर्ड
+ * @param level square का level
+ * @param x0 square की पहली row (plane coordinates)
+ * @param y0 square का पहला column (plane coordinates)
+ * @return node, या memory allocation fail होने पर NULL
+ */
+static HashNode *build_node(HashLife *life, const Board *board, unsigned level, int64_t x0, int64_t y0) {
+    int64_t size = (int64_t)1 << level;
+    int64_t bx = x0 - life->origin_x, by = y0 - life->origin_y;
+    if (bx >= (int64_t)board->height || by >= (int64_t)board->width || bx + size <= 0 || by + size <= 0) {
+        return empty_node(life, level);
+    }
+    if (level == 0) return &life->leaf[board->cells[BOARD_INDEX(board, (size_t)bx, (size_t)by)] & 1];
+
+    int64_t half = size / 2;
+    return find_node(life,
+                     build_node(life, board, level - 1, x0, y0),
+                     build_node(life, board, level - 1, x0, y0 + half),
+                     build_node(life, board, level - 1, x0 + half, y0),
+                     build_node(life, board, level - 1, x0 + half, y0 + half));
+}
+
+/**
+ * @brief Board के content से universe load करता है (generation 0 से)
+ *
+ * @param life target universe
+ * @param board source बोर्ड
+ * @return सफल होने पर 0, error होने पर -1
+ */
+int hashlife_from_board(HashLife *life, const Board *board) {
+    if (life == NULL || board == NULL) return -1;
+
+    life->height = board->height;
+    life->width = board->width;
+    life->origin_x = -(int64_t)(board->height / 2);
+    life->origin_y = -(int64_t)(board->width / 2);
+    life->generation = 0;
+
+    // Root इतना बड़ा हो कि बोर्ड [-2^(k-1), 2^(k-1)) में आ जाए
+    size_t extent = board->height > board->width ? board->height : board->width;
+    unsigned level = 3;
+    while (level < HASHLIFE_MAX_LEVEL && ((size_t)1 << (level - 1)) < extent) level++;
+
+    int64_t corner = -((int64_t)1 << (level - 1));
+    HashNode *root = build_node(life, board, level, corner, corner);
+    if (!root) return -1;
+
+    life->root = root;
+    enforce_cache_limit(life);
+    return 0;
+}
+
+/**
+ * @brief node की जीवित cells board में लिखता है (board के बाहर वाली skip)
+ * @param life source universe
+ * @param node लिखने वाला node
+ * @param board output बोर्ड
+ * @param x0 node की पहली row (plane coordinates)
+ * @param y0 node का पहला column (plane coordinates)
+ */
+static void write_node(const HashLife *life, const HashNode *node, Board *board, int64_t x0, int64_t y0) {
+    if (node->population == 0) return;
+
+    int64_t size = (int64_t)1 << node->level;
+    int64_t bx = x0 - life->origin_x, by = y0 - life->origin_y;
+    if (bx >= (int64_t)board->height || by >= (int64_t)board->width || bx + size <= 0 || by + size <= 0) return;
+
+    if (node->level == 0) {
+        board->cells[BOARD_INDEX(board, (size_t)bx, (size_t)by)] = 1;
+        return;
+    }
+
+    int64_t half = size / 2;
+    write_node(life, node->nw, board, x0, y0);
+    write_node(life, node->ne, board, x0, y0 + half);
+    write_node(life, node->sw, board, x0 + half, y0);
+    write_node(life, node->se, board, x0 + half, y0 + half);
+}
+
+/**
+ * @brief universe का बोर्ड वाला हिस्सा Board में लिखता है
+ *
+ * @param life source universe
+ * @param board output बोर्ड
+ * @return सफल होने पर 0, size mismatch या NULL pointer होने पर -1
+ */
+int hashlife_to_board(const HashLife *life, Board *board) {
+    if (life == NULL || board == NULL) return -1;
+    if (board->height != life->height || board->width != life->width) return -1;
+
+    board_clear(board);
+    int64_t corner = -((int64_t)1 << (life->root->level - 1));
+    write_node(life, life->root, board, corner, corner);
+
+    board_mark_all_dirty(board);
+    return 0;
+}
+
+/**
+ * @brief root को खाली border से एक level बड़ा करता है (center same रहता है)
+ * @param life target universe
+ * @return सफल होने पर 0, memory allocation fail होने पर -1
+ */
+static int root_expand(HashLife *life) {
+    HashNode *root = life->root;
+    HashNode *e = empty_node(life, root->level - 1u);
+    if (!e) return -1;
+
+    HashNode *expanded = find_node(life,
+                                   find_node(life, e, e, e, root->nw),
+                                   find_node(life, e, e, root->ne, e),
+                                   find_node(life, e, root->sw, e, e),
+                                   find_node(life, root->se, e, e, e));
+    if (!expanded) return -1;
+
+    life->root = expanded;
+    return 0;
+}
+
+/**
+ * @brief pattern root के बीच वाले चौथाई square में है?
+ *
+ * तब 2^(level-3) generations में भी pattern successor के area (बीच का
+ * आधा square) से बाहर नहीं जा सकता।
+ *
+ * @param root level >= 3 वाला root
+ * @return centered होने पर non-zero, वरना 0
+ */
+static int root_is_centered(const HashNode *root) {
+    uint64_t inner = root->nw->se->se->population + root->ne->sw->sw->population +
+                     root->sw->ne->ne->population + root->se->nw->nw->population;
+    return inner == root->population;
+}
+
+/**
+ * @brief universe को कितनी भी generations आगे बढ़ाता है
+ *
+ * generations का हर set bit (2^step_exp) एक successor call है। हर call
+ * से पहले root को तब तक बड़ा किया जाता है जब तक उसका level step के
+ * लिए काफी न हो और pattern उसके बीच वाले चौथाई में न हो।
+ *
+ * @param life target universe
+ * @param generations कितनी generations
+ * @return सफल होने पर 0, memory या level limit होने पर -1
+ */
+int hashlife_step(HashLife *life, uint64_t generations) {
+    if (life == NULL) return -1;
+
+    for (unsigned step_exp = 0; step_exp < 64 && (generations >> step_exp) != 0; step_exp++) {
+        if (((generations >> step_exp) & 1) == 0) continue;
+        if (step_exp + 3 > HASHLIFE_MAX_LEVEL) return -1;
+
+        while (life->root->level < step_exp + 3 || !root_is_centered(life->root)) {
+            if (life->root->level >= HASHLIFE_MAX_LEVEL || root_expand(life) != 0) return -1;
+        }
+
+        HashNode *next = node_successor(life, life->root, step_exp);
+        if (!next) return -1;
+
+        life->root = next;
+        life->generation += (uint64_t)1 << step_exp;
+        enforce_cache_limit(life);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief hashlife_from_board के बाद कितनी generations हो चुकी हैं
+ * @param life universe
+ * @return generation count
+ */
+uint64_t hashlife_generation(const HashLife *life) {
+    return life ? life->generation : 0;
+}
+
+/**
+ * @brief universe में जीवित cells की संख्या
+ * @param life universe
+ * @return population
+ */
+uint64_t hashlife_population(const HashLife *life) {
+    return life ? life->root->population : 0;
+}
+
+/**
+ * @brief cache में अभी कितने nodes हैं
+ * @param life universe
+ * @return nodes की संख्या
+ */
+size_t hashlife_node_count(const HashLife *life) {
+    return life ? life->node_count : 0;
+}
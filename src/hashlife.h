@@ -0,0 +1,130 @@
+/**
+ * @file hashlife.h
+ * @brief Hashlife stepping backend का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Hashlife universe को quadtree में store करता है। हर node canonical है
+ * (hash-consed): एक जैसे content वाले सभी squares एक ही node share करते
+ * हैं। Level k का node 2^k x 2^k cells का square है और उसका memoized
+ * result बीच वाले 2^(k-1) square को 2^(k-2) generations आगे दिखाता है।
+ * इसलिए periodic या repetitive patterns लाखों generations एक साथ jump
+ * कर सकते हैं।
+ *
+ * Board के विपरीत Hashlife unbounded plane पर चलता है: बोर्ड के किनारे के
+ * बाहर जाने वाले patterns (जैसे gliders) मरते नहीं, सिर्फ hashlife_to_board
+ * में clip होते हैं।
+ */
+
+#ifndef HASHLIFE_H
+#define HASHLIFE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "board.h"
+#include "rules.h"
+
+/**
+ * @brief Quadtree का maximum level (coordinates int64_t में fit रहने चाहिए)
+ */
+#define HASHLIFE_MAX_LEVEL 60
+
+/**
+ * @brief Node cache की default memory limit (bytes)
+ */
+#define HASHLIFE_DEFAULT_CACHE_BYTES ((size_t)256 * 1024 * 1024)
+
+/**
+ * @brief Opaque Hashlife universe
+ */
+typedef struct HashLife HashLife;
+
+/**
+ * @brief नया खाली Hashlife universe create करता है
+ *
+ * Rules की compiled neighborhood table copy होती है, इसलिए rules को बाद
+ * में free किया जा सकता है, और Hensel (non-totalistic) rules भी चलते हैं।
+ * B0 वाले rules support नहीं हैं (खाली plane खाली नहीं रहता), न ही
+ * Generations rules (nodes में सिर्फ दो states हैं)।
+ *
+ * @param rules apply करने वाले rules
+ * @param cache_bytes node cache की memory limit (0 = HASHLIFE_DEFAULT_CACHE_BYTES)
+ * @return सफल होने पर HashLife pointer, असफल, B0 या Generations rules होने पर NULL
+ */
+HashLife *hashlife_init(const Rules *rules, size_t cache_bytes);
+
+/**
+ * @brief universe और उसके सभी nodes की memory free करता है
+ * @param life free करने वाला universe
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int hashlife_free(HashLife *life);
+
+/**
+ * @brief rules बदलता है और सभी memoized results discard करता है
+ * @param life target universe
+ * @param rules नए rules
+ * @return सफल होने पर 0, NULL pointer, B0 या Generations rules होने पर -1
+ */
+int hashlife_set_rules(HashLife *life, const Rules *rules);
+
+/**
+ * @brief Board के content से universe load करता है (generation 0 से)
+ *
+ * बोर्ड plane के center में रखा जाता है; hashlife_to_board उसी position
+ * से वापस पढ़ता है। Memoized results rules पर depend करते हैं, pattern
+ * पर नहीं, इसलिए वो reload के बाद भी काम आते हैं।
+ *
+ * @param life target universe
+ * @param board source बोर्ड
+ * @return सफल होने पर 0, error होने पर -1
+ */
+int hashlife_from_board(HashLife *life, const Board *board);
+
+/**
+ * @brief universe का बोर्ड वाला हिस्सा Board में लिखता है
+ *
+ * बोर्ड के बाहर की cells ignore होती हैं। बोर्ड का size वही होना चाहिए
+ * जो hashlife_from_board में था।
+ *
+ * @param life source universe
+ * @param board output बोर्ड (सभी tiles dirty mark होती हैं)
+ * @return सफल होने पर 0, size mismatch या NULL pointer होने पर -1
+ */
+int hashlife_to_board(const HashLife *life, Board *board);
+
+/**
+ * @brief universe को कितनी भी generations आगे बढ़ाता है
+ *
+ * generations को powers of two में तोड़कर हर हिस्सा एक successor call से
+ * होता है। Cache memory limit हर हिस्से के बाद check होती है; limit पार
+ * होने पर current pattern से unreachable nodes collect हो जाते हैं।
+ *
+ * @param life target universe
+ * @param generations कितनी generations
+ * @return सफल होने पर 0, memory या level limit होने पर -1
+ */
+int hashlife_step(HashLife *life, uint64_t generations);
+
+/**
+ * @brief hashlife_from_board के बाद कितनी generations हो चुकी हैं
+ * @param life universe
+ * @return generation count
+ */
+uint64_t hashlife_generation(const HashLife *life);
+
+/**
+ * @brief universe में जीवित cells की संख्या (बोर्ड के बाहर वाली भी)
+ * @param life universe
+ * @return population
+ */
+uint64_t hashlife_population(const HashLife *life);
+
+/**
+ * @brief cache में अभी कितने nodes हैं
+ * @param life universe
+ * @return nodes की संख्या
+ */
+size_t hashlife_node_count(const HashLife *life);
+
+#endif // HASHLIFE_H
@@ -0,0 +1,783 @@
+/**
+ * @file headless.c
+ * @brief SDL के बिना batch simulation mode का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * यह फाइल सिर्फ board, rules और pool modules पर depend करती है, ताकि
+ * headless binary बिना -lSDL2 के link हो सके।
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "batch.h"
+#include "board.h"
+#include "checkpoint.h"
+#include "cycle.h"
+#include "domain.h"
+#include "gpu_board.h"
+#include "hashlife.h"
+#include "headless.h"
+#include "packed_board.h"
+#include "pool.h"
+#include "profile.h"
+#include "record.h"
+#include "rules.h"
+#include "simd.h"
+#include "sparse_board.h"
+#include "term.h"
+
+/**
+ * @brief Headless run के periodic checkpoints
+ */
+typedef struct CheckpointPlan {
+    const char *filename;   /**< Checkpoint file (NULL = checkpoint नहीं) */
+    long every;             /**< कितनी generations के बाद checkpoint */
+    uint64_t start;         /**< Run शुरू होते समय बोर्ड की generation */
+    const Rules *rules;     /**< Checkpoint में save होने वाले rules */
+} CheckpointPlan;
+
+/**
+ * @brief check करता है कि इस generation के बाद checkpoint लिखना है या नहीं
+ *
+ * हर plan->every generations के बाद और run के अंत में checkpoint होता है।
+ *
+ * @param plan checkpoint plan
+ * @param done इस run में अभी तक की generations
+ * @param generations इस run की कुल generations
+ * @return checkpoint लिखना है तो 1, वरना 0
+ */
+static int checkpoint_due(const CheckpointPlan *plan, long done, long generations) {
+    return plan->filename != NULL && (done % plan->every == 0 || done == generations);
+}
+
+/**
+ * @brief बोर्ड का checkpoint लिखता है
+ * @param plan checkpoint plan
+ * @param board save करने वाला बोर्ड
+ * @param done इस run में अभी तक की generations
+ * @return सफल होने पर 0, error होने पर -1
+ */
+static int checkpoint_write(const CheckpointPlan *plan, const Board *board, long done) {
+    if (board_save(plan->filename, board, plan->start + (uint64_t)done, plan->rules) != 0) {
+        printf("Error writing checkpoint: %s\n", plan->filename);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief एक generation के statistics की CSV line लिखता है
+ * @param file CSV file
+ * @param generation generation number
+ * @param stats उस generation के statistics
+ */
+static void stats_write(FILE *file, uint64_t generation, const BoardStats *stats) {
+    fprintf(file, "%llu,%llu,%llu,%llu,%zu,%zu,%zu,%zu\n", (unsigned long long)generation,
+            (unsigned long long)stats->population, (unsigned long long)stats->births,
+            (unsigned long long)stats->deaths, stats->min_x, stats->min_y, stats->max_x, stats->max_y);
+}
+
+/**
+ * @brief Board engine से generations चलाता है
+ *
+ * stats file दी हो तो हर generation के statistics stepping के साथ ही
+ * (board_next_stats) बनते हैं, बोर्ड दोबारा scan नहीं होता। cycles दिया
+ * हो तो हर generation का board_hash ring में जाता है, और बोर्ड किसी
+ * पिछली state में लौटते ही run रुक जाता है (*generations उतनी ही होती
+ * हैं जितनी चलीं, और checkpoint उसी generation का लिखा जाता है)। view
+ * दिया हो तो शुरू में, हर watch_every generations पर और अंत में terminal
+ * view stdout पर redraw होता है। recorder दिया हो तो शुरू का बोर्ड और हर
+ * due generation उसमें push होती है।
+ *
+ * @param front current generation (result भी इसी में आता है)
+ * @param back scratch बोर्ड
+ * @param rules apply करने वाले rules
+ * @param pool worker pool
+ * @param generations कितनी generations (early stop पर चली हुई generations store होती हैं)
+ * @param plan periodic checkpoints
+ * @param stats statistics की CSV file (NULL = नहीं)
+ * @param cycles still life / oscillator detector (NULL = पूरी generations चलाएं)
+ * @param view terminal view (NULL = view नहीं)
+ * @param watch_every कितनी generations पर view redraw हो
+ * @param recorder frame recorder (NULL = recording नहीं)
+ * @return सफल होने पर 0, error होने पर -1
+ */
+static int run_board_engine(Board **front, Board **back, Rules *rules, ThreadPool *pool, long *generations,
+                            const CheckpointPlan *plan, FILE *stats, CycleDetector *cycles,
+                            TermView *view, long watch_every, Recorder *recorder) {
+    BoardStats step;
+    uint64_t cycle_start, period;
+
+    if (stats != NULL) {
+        fprintf(stats, "generation,population,births,deaths,min_x,min_y,max_x,max_y\n");
+        if (board_stats(*front, &step) != 0) return -1;
+        stats_write(stats, plan->start, &step);
+    }
+    if (cycles != NULL && cycle_detector_push(cycles, board_hash(*front), plan->start, NULL, NULL) != 0) return -1;
+    if (view != NULL && term_view_draw(view, *front, STDOUT_FILENO) != 0) return -1;
+    if (recorder != NULL && recorder_push(recorder, *front, plan->start) < 0) return -1;
+
+    for (long g = 0; g < *generations; g++) {
+        if (board_next_stats(*front, *back, rules, pool, stats != NULL ? &step : NULL) != 0) return -1;
+
+        Board *temp = *front;
+        *front = *back;
+        *back = temp;
+
+        if (stats != NULL) stats_write(stats, plan->start + (uint64_t)g + 1, &step);
+        if (recorder_due(recorder, plan->start + (uint64_t)g, plan->start + (uint64_t)g + 1) &&
+            recorder_push(recorder, *front, plan->start + (uint64_t)g + 1) < 0) return -1;
+
+        if (cycles != NULL && cycle_detector_push(cycles, board_hash(*front), plan->start + (uint64_t)g + 1,
+                                                  &cycle_start, &period) == 1) {
+            printf("Stable at generation %llu (period %llu)\n", (unsigned long long)cycle_start,
+                   (unsigned long long)period);
+            *generations = g + 1;
+        }
+
+        if (checkpoint_due(plan, g + 1, *generations) && checkpoint_write(plan, *front, g + 1) != 0) return -1;
+        if (view != NULL && ((g + 1) % watch_every == 0 || g + 1 == *generations) &&
+            term_view_draw(view, *front, STDOUT_FILENO) != 0) return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Blocked engine से generations चलाता है (board_step_n_parallel)
+ *
+ * Generations checkpoint boundaries तक के chunks में चलती हैं; हर chunk
+ * में बोर्ड memory से हर BOARD_STEP_DEPTH generations पर एक बार गुजरता है।
+ *
+ * @param board current generation (result भी इसी में आता है)
+ * @param rules apply करने वाले rules
+ * @param pool worker pool
+ * @param generations कितनी generations
+ * @param plan periodic checkpoints
+ * @return सफल होने पर 0, error होने पर -1
+ */
+static int run_blocked_engine(Board *board, Rules *rules, ThreadPool *pool, long generations,
+                              const CheckpointPlan *plan) {
+    for (long done = 0; done < generations;) {
+        long chunk = generations - done;
+        if (plan->filename != NULL && chunk > plan->every) chunk = plan->every;
+        if (board_step_n_parallel(board, rules, chunk, pool) != 0) return -1;
+        done += chunk;
+
+        if (checkpoint_due(plan, done, generations) && checkpoint_write(plan, board, done) != 0) return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief PackedBoard engine से generations चलाता है
+ *
+ * शुरुआत में एक बार pack और अंत में एक बार unpack होता है, बीच की सभी
+ * generations packed form में चलती हैं (checkpoint के लिए ही बीच में unpack
+ * होता है)।
+ *
+ * @param board current generation (result भी इसी में आता है)
+ * @param rules apply करने वाले rules
+ * @param pool worker pool
+ * @param generations कितनी generations
+ * @param plan periodic checkpoints
+ * @return सफल होने पर 0, error होने पर -1
+ */
+static int run_packed_engine(Board *board, Rules *rules, ThreadPool *pool, long generations,
+                             const CheckpointPlan *plan) {
+    PackedBoard *front = packed_board_init(board->height, board->width);
+    PackedBoard *back = packed_board_init(board->height, board->width);
+    int status = -1;
+
+    if (front == NULL || back == NULL) goto cleanup;
+    if (packed_board_from_board(front, board) != 0) goto cleanup;
+
+    for (long g = 0; g < generations; g++) {
+        if (packed_board_next_parallel(front, back, rules, pool) != 0) goto cleanup;
+
+        PackedBoard *temp = front;
+        front = back;
+        back = temp;
+
+        if (checkpoint_due(plan, g + 1, generations)) {
+            if (packed_board_to_board(front, board) != 0) goto cleanup;
+            if (checkpoint_write(plan, board, g + 1) != 0) goto cleanup;
+        }
+    }
+
+    status = packed_board_to_board(front, board);
+
+cleanup:
+    if (front != NULL) packed_board_free(front);
+    if (back != NULL) packed_board_free(back);
+    return status;
+}
+
+/**
+ * @brief Hashlife engine से generations चलाता है
+ *
+ * सभी generations एक hashlife_step call में होती हैं, इसलिए periodic
+ * patterns लाखों generations तेजी से jump कर सकते हैं। Universe बोर्ड से
+ * बड़ा हो सकता है और बोर्ड में सिर्फ उसकी window आती है, इसलिए इस engine
+ * के checkpoints नहीं होते (options_parse --checkpoint reject करता है)।
+ *
+ * @param board current generation (result भी इसी में आता है)
+ * @param rules apply करने वाले rules
+ * @param cache_mb node cache की memory limit (MB)
+ * @param generations कितनी generations
+ * @return सफल होने पर 0, error होने पर -1
+ */
+static int run_hashlife_engine(Board *board, Rules *rules, long cache_mb, long generations) {
+    HashLife *life = hashlife_init(rules, (size_t)cache_mb * 1024 * 1024);
+    int status = -1;
+
+    if (life == NULL) goto cleanup;
+    if (hashlife_from_board(life, board) != 0) goto cleanup;
+    if (generations > 0 && hashlife_step(life, (uint64_t)generations) != 0) goto cleanup;
+
+    printf("Hashlife nodes: %zu\n", hashlife_node_count(life));
+    printf("Population: %llu\n", (unsigned long long)hashlife_population(life));
+    status = hashlife_to_board(life, board);
+
+cleanup:
+    if (life != NULL) hashlife_free(life);
+    return status;
+}
+
+/**
+ * @brief SparseBoard engine से generations चलाता है
+ *
+ * Board plane की (0, 0) वाली window है। Window से बाहर गए cells plane में
+ * चलते रहते हैं लेकिन result में सिर्फ window आती है, इसलिए इस engine के
+ * checkpoints नहीं होते (options_parse --checkpoint reject करता है)।
+ *
+ * @param board current generation (result भी इसी में आता है)
+ * @param rules apply करने वाले rules
+ * @param generations कितनी generations
+ * @return सफल होने पर 0, error होने पर -1
+ */
+static int run_sparse_engine(Board *board, Rules *rules, long generations) {
+    SparseBoard *plane = sparse_board_init();
+    int status = -1;
+
+    if (plane == NULL) goto cleanup;
+    if (sparse_board_from_board(plane, board, 0, 0) != 0) goto cleanup;
+
+    for (long g = 0; g < generations; g++) {
+        if (sparse_board_next(plane, rules) != 0) goto cleanup;
+    }
+
+    printf("Sparse chunks: %zu\n", sparse_board_chunk_count(plane));
+    printf("Population: %llu\n", (unsigned long long)sparse_board_population(plane));
+    status = sparse_board_to_board(plane, board, 0, 0);
+
+cleanup:
+    if (plane != NULL) sparse_board_free(plane);
+    return status;
+}
+
+/**
+ * @brief GPU engine से generations चलाता है
+ *
+ * बोर्ड एक बार upload होता है और सभी generations device पर चलती हैं;
+ * readback सिर्फ checkpoints पर और अंत में होता है।
+ *
+ * @param board current generation (result भी इसी में आता है)
+ * @param rules apply करने वाले rules
+ * @param generations कितनी generations
+ * @param plan periodic checkpoints
+ * @return सफल होने पर 0, error होने पर -1
+ */
+static int run_gpu_engine(Board *board, Rules *rules, long generations, const CheckpointPlan *plan) {
+    GpuBoard *gpu = gpu_board_init(board->height, board->width);
+    int status = -1;
+
+    if (gpu == NULL) goto cleanup;
+    if (gpu_board_from_board(gpu, board) != 0) goto cleanup;
+
+    for (long done = 0; done < generations;) {
+        long chunk = generations - done;
+        if (plan->filename != NULL && chunk > plan->every) chunk = plan->every;
+        if (gpu_board_next(gpu, rules, chunk) != 0) goto cleanup;
+        done += chunk;
+
+        if (checkpoint_due(plan, done, generations)) {
+            if (gpu_board_to_board(gpu, board) != 0) goto cleanup;
+            if (checkpoint_write(plan, board, done) != 0) goto cleanup;
+        }
+    }
+
+    printf("GPU: %s\n", gpu_board_renderer(gpu));
+    printf("Population: %llu\n", (unsigned long long)gpu_board_population(gpu));
+    status = gpu_board_to_board(gpu, board);
+
+cleanup:
+    if (gpu != NULL) gpu_board_free(gpu);
+    return status;
+}
+
+/**
+ * @brief check करता है कि चुने गए engine और options rules का kernel support करते हैं
+ *
+ * Packed, sparse और GPU engines bit-sliced counts पर चलते हैं, Hashlife के
+ * nodes में दो ही states हैं, और statistics व checkpoints भी two-state
+ * cells मानते हैं। Error message यहीं print होता है।
+ *
+ * @param opts parsed command line options
+ * @param rules चलाने वाले rules
+ * @return supported हों तो 0, वरना -1
+ */
+static int check_rules(const Options *opts, const Rules *rules) {
+    if ((opts->engine == ENGINE_PACKED || opts->engine == ENGINE_SPARSE || opts->engine == ENGINE_GPU) &&
+        rules->kernel != RULES_KERNEL_TOTALISTIC) {
+        printf("The %s engine supports only outer-totalistic rules: %s\n",
+               opts->engine == ENGINE_PACKED ? "packed" : opts->engine == ENGINE_SPARSE ? "sparse" : "gpu",
+               rules->name);
+        return -1;
+    }
+    if (rules->kernel != RULES_KERNEL_GENERATIONS) return 0;
+
+    if (opts->engine == ENGINE_HASHLIFE) {
+        printf("The hashlife engine does not support Generations rules: %s\n", rules->name);
+        return -1;
+    }
+    if (opts->stats_filename || opts->checkpoint_filename || opts->batch > 0) {
+        printf("--stats, --checkpoint and --batch do not support Generations rules: %s\n", rules->name);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief --batch mode: हर rule के opts->batch random boards चलाकर results CSV में लिखता है
+ *
+ * opts->rule_name comma-separated list हो सकता है; हर rule के boards को
+ * seeds opts->seed, opts->seed + 1, ... मिलते हैं, इसलिए हर rule same
+ * initial boards से शुरू होता है।
+ *
+ * @param opts parsed command line options
+ * @param height हर board की ऊंचाई
+ * @param width हर board की चौड़ाई
+ * @return सफल होने पर 0, error होने पर 1
+ */
+static int run_batch(const Options *opts, size_t height, size_t width) {
+    Rules *rules[16];
+    int num_rules = 0;
+    int error_code = 1;
+    BatchJob *jobs = NULL;
+    BatchResult *results = NULL;
+    ThreadPool *pool = NULL;
+    char names[256];
+
+    const char *list = opts->rule_name ? opts->rule_name : "conway";
+    if (strlen(list) >= sizeof(names)) {
+        printf("Rule list too long: %s\n", list);
+        return 1;
+    }
+    strcpy(names, list);
+    for (char *name = strtok(names, ","); name != NULL; name = strtok(NULL, ",")) {
+        if (num_rules == (int)(sizeof(rules) / sizeof(rules[0]))) {
+            printf("Too many rules in --rule (at most %d)\n", num_rules);
+            goto cleanup;
+        }
+        rules[num_rules] = rules_from_name(name);
+        if (rules[num_rules] == NULL) {
+            printf("Unknown rule set: %s\n", name);
+            goto cleanup;
+        }
+        if (check_rules(opts, rules[num_rules++]) != 0) goto cleanup;
+    }
+    if (num_rules == 0) {
+        printf("Empty rule list: %s\n", list);
+        goto cleanup;
+    }
+
+    size_t count = (size_t)num_rules * (size_t)opts->batch;
+    jobs = calloc(count, sizeof(BatchJob));
+    results = calloc(count, sizeof(BatchResult));
+    if (jobs == NULL || results == NULL) {
+        printf("Error allocating batch jobs\n");
+        goto cleanup;
+    }
+    for (size_t i = 0; i < count; i++) {
+        jobs[i].rules = rules[i / (size_t)opts->batch];
+        jobs[i].seed = (uint64_t)opts->seed + i % (size_t)opts->batch;
+    }
+
+    pool = pool_init(opts->threads);
+    if (pool == NULL) {
+        printf("Error creating thread pool\n");
+        goto cleanup;
+    }
+
+    BatchConfig config = {height, width, opts->edge, opts->generations,
+                          opts->until_stable ? CYCLE_DEFAULT_WINDOW : 0, opts->density};
+    double start = now_seconds();
+    if (batch_run(&config, jobs, count, results, pool) != 0) {
+        printf("Error running batch\n");
+        goto cleanup;
+    }
+    double elapsed = now_seconds() - start;
+
+    size_t stable = 0;
+    for (size_t i = 0; i < count; i++) stable += results[i].stable ? 1 : 0;
+    printf("Boards: %zu (%d rules x %ld, %zux%zu)\n", count, num_rules, opts->batch, width, height);
+    if (opts->until_stable) printf("Stable: %zu\n", stable);
+    printf("Threads: %d\n", pool_size(pool));
+    printf("Elapsed: %.6f s\n", elapsed);
+    if (elapsed > 0) printf("Boards/s: %.1f\n", (double)count / elapsed);
+
+    if (batch_write_csv(opts->batch_filename, jobs, results, count) != 0) {
+        printf("Error writing batch results: %s\n", opts->batch_filename);
+        goto cleanup;
+    }
+    printf("Batch results written to: %s\n", opts->batch_filename);
+    error_code = 0;
+
+cleanup:
+    if (pool != NULL) pool_free(pool);
+    free(results);
+    free(jobs);
+    for (int i = 0; i < num_rules; i++) rules_free(rules[i]);
+    return error_code;
+}
+
+/**
+ * @brief rank की output file का नाम बनाता है ("<base>.<rank>")
+ * @param buffer नाम store करने के लिए buffer
+ * @param size buffer का size
+ * @param base --out या --checkpoint का नाम
+ * @param rank इस process का rank
+ * @return सफल होने पर 0, नाम buffer में fit न हो तो -1
+ */
+static int domain_filename(char *buffer, size_t size, const char *base, int rank) {
+    int length = snprintf(buffer, size, "%s.%d", base, rank);
+    return length < 0 || (size_t)length >= size ? -1 : 0;
+}
+
+/**
+ * @brief --domain mode: इस rank की strip को बाकी ranks के साथ चलाता है
+ *
+ * Pattern file हर rank पढ़ता है और अपनी rows रखता है; file न हो तो
+ * universe opts->seed से random बनता है। Checkpoints और --out हर rank अपनी
+ * strip के लिए "<FILE>.<rank>" में लिखता है: checkpoints normal checkpoint
+ * format में हैं (strip जितनी ऊंचाई), और text outputs rank के क्रम में
+ * जोड़ने पर पूरा universe देते हैं।
+ *
+ * @param opts parsed command line options
+ * @param height universe की ऊंचाई
+ * @param width universe की चौड़ाई
+ * @return सफल होने पर 0, error होने पर 1
+ */
+static int run_domain(const Options *opts, size_t height, size_t width) {
+    int error_code = 1;
+    Domain *domain = NULL;
+    Board *pattern = NULL;
+    Board *strip = NULL;
+    char filename[4096];
+
+    Rules *rules = opts->rule_name ? rules_from_name(opts->rule_name) : rules_conway();
+    if (rules == NULL) {
+        printf("Unknown rule set: %s\n", opts->rule_name);
+        return 1;
+    }
+    if (check_rules(opts, rules) != 0) goto cleanup;
+
+    DomainConfig config = {opts->domain_rank, opts->domain_count, opts->peers, height, width, (size_t)opts->halo};
+    domain = domain_init(&config);
+    if (domain == NULL) {
+        printf("Error starting domain %d/%d\n", opts->domain_rank, opts->domain_count);
+        goto cleanup;
+    }
+    printf("Domain: rank %d of %d, rows %zu-%zu of %zux%zu\n", domain->rank, domain->num_ranks,
+           domain->row_begin, domain->row_end - 1, height, width);
+
+    if (opts->filename) {
+        size_t file_height = 0, file_width = 0;
+        if (board_file_dimensions(opts->filename, &file_height, &file_width) != 0 ||
+            (pattern = board_init(file_height, file_width)) == NULL ||
+            board_from_file((char *)opts->filename, pattern) != 0) {
+            printf("Error loading file: %s\n", opts->filename);
+            goto cleanup;
+        }
+        domain_load(domain, pattern);
+    } else {
+        domain_random_fill(domain, (uint64_t)opts->seed, opts->density);
+    }
+
+    if (opts->checkpoint_filename || opts->out_filename) {
+        strip = board_init(domain->row_end - domain->row_begin, width);
+        if (strip == NULL) {
+            printf("Error allocating boards\n");
+            goto cleanup;
+        }
+    }
+
+    CheckpointPlan plan = {NULL, opts->checkpoint_every, 0, rules};
+    if (opts->checkpoint_filename) {
+        if (domain_filename(filename, sizeof(filename), opts->checkpoint_filename, domain->rank) != 0) goto cleanup;
+        plan.filename = filename;
+    }
+
+    double start = now_seconds();
+    for (long done = 0; done < opts->generations;) {
+        long chunk = opts->generations - done;
+        if (plan.filename != NULL && chunk > plan.every) chunk = plan.every;
+        if (domain_step(domain, rules, chunk) != 0) {
+            printf("Error computing next generation\n");
+            goto cleanup;
+        }
+        done += chunk;
+
+        if (checkpoint_due(&plan, done, opts->generations)) {
+            if (domain_to_board(domain, strip) != 0 || checkpoint_write(&plan, strip, done) != 0) goto cleanup;
+        }
+    }
+    double elapsed = now_seconds() - start;
+
+    double cells = (double)(domain->row_end - domain->row_begin) * (double)width * (double)opts->generations;
+    printf("Generations: %ld\n", opts->generations);
+    printf("Halo: %ld\n", opts->halo);
+    if (plan.filename && opts->generations > 0) printf("Checkpoint: %s (generation %ld)\n", plan.filename,
+                                                     opts->generations);
+    printf("Elapsed: %.6f s\n", elapsed);
+    if (elapsed > 0) {
+        printf("Generations/s: %.1f\n", (double)opts->generations / elapsed);
+        printf("Cells/s: %.3e\n", cells / elapsed);
+    }
+    printf("Population: %llu\n", (unsigned long long)domain_population(domain));
+
+    if (opts->out_filename) {
+        if (domain_filename(filename, sizeof(filename), opts->out_filename, domain->rank) != 0 ||
+            domain_to_board(domain, strip) != 0 || board_to_file(filename, strip) != 0) {
+            printf("Error writing file: %s.%d\n", opts->out_filename, domain->rank);
+            goto cleanup;
+        }
+        printf("Final strip written to: %s\n", filename);
+    }
+    error_code = 0;
+
+cleanup:
+    if (strip != NULL) board_free(strip);
+    if (pattern != NULL) board_free(pattern);
+    if (domain != NULL) domain_free(domain);
+    rules_free(rules);
+    return error_code;
+}
+
+/**
+ * @brief options के अनुसार headless simulation चलाता है
+ *
+ * @param opts parsed command line options
+ * @return सफल होने पर 0, error होने पर 1
+ */
+int headless_run(const Options *opts) {
+    if (opts == NULL) return 1;
+
+    int error_code = 0;
+    size_t height = 0, width = 0;
+    options_board_size(opts, &height, &width);
+    if (opts->batch > 0) return run_batch(opts, height, width);
+    if (opts->domain_count > 0) return run_domain(opts, height, width);
+
+    Rules *rules = opts->rule_name ? rules_from_name(opts->rule_name) : rules_conway();
+    if (rules == NULL) {
+        printf("Unknown rule set: %s\n", opts->rule_name);
+        return 1;
+    }
+    if (check_rules(opts, rules) != 0) {
+        rules_free(rules);
+        return 1;
+    }
+
+    // Resume होने पर edge mode checkpoint से आता है
+    BoardEdge edge = opts->edge;
+    if (opts->resume_filename) {
+        CheckpointInfo info;
+        if (checkpoint_read_info(opts->resume_filename, &info) != 0) {
+            printf("Error reading checkpoint: %s\n", opts->resume_filename);
+            rules_free(rules);
+            return 1;
+        }
+        edge = info.edge;
+        if (edge == BOARD_EDGE_TORUS && opts->engine != ENGINE_BOARD && opts->engine != ENGINE_BLOCKED) {
+            printf("--edge torus is only supported by the board and blocked engines\n");
+            rules_free(rules);
+            return 1;
+        }
+    }
+
+    Board *front = board_init_padded(height, width, edge);
+    Board *back = board_init_padded(height, width, edge);
+    ThreadPool *pool = NULL;
+    FILE *stats = NULL;
+    CycleDetector *cycles = NULL;
+    TermView *view = NULL;
+    Recorder *recorder = NULL;
+    uint64_t start_generation = 0;
+    long generations = opts->generations;
+
+    if (front == NULL || back == NULL) {
+        printf("Error allocating boards\n");
+        error_code = 1;
+        goto cleanup;
+    }
+
+    // Random fill भी workers पर चलता है
+    pool = pool_init(opts->threads);
+    if (pool == NULL) {
+        printf("Error creating thread pool\n");
+        error_code = 1;
+        goto cleanup;
+    }
+
+    if (opts->resume_filename) {
+        // Rules भी checkpoint से restore होते हैं
+        if (board_load(opts->resume_filename, front, &start_generation, rules) != 0) {
+            printf("Error loading checkpoint: %s\n", opts->resume_filename);
+            error_code = 1;
+            goto cleanup;
+        }
+        // --generations कुल target है, इसलिए बची generations ही चलती हैं
+        generations = start_generation >= (uint64_t)opts->generations ? 0 : opts->generations - (long)start_generation;
+        printf("Resumed from generation %llu (%s)\n", (unsigned long long)start_generation, rules->name);
+    } else if (opts->filename) {
+        if (board_from_file((char *)opts->filename, front) != 0) {
+            printf("Error loading file: %s\n", opts->filename);
+            error_code = 1;
+            goto cleanup;
+        }
+    } else {
+        uint64_t seed = opts->seed_given ? (uint64_t)opts->seed : (uint64_t)time(NULL);
+        board_random_fill(front, seed, opts->density, pool);
+    }
+
+    if (opts->stats_filename) {
+        stats = fopen(opts->stats_filename, "w");
+        if (stats == NULL) {
+            printf("Error opening stats file: %s\n", opts->stats_filename);
+            error_code = 1;
+            goto cleanup;
+        }
+    }
+
+    if (opts->until_stable) {
+        cycles = cycle_detector_init(CYCLE_DEFAULT_WINDOW);
+        if (cycles == NULL) {
+            printf("Error creating cycle detector\n");
+            error_code = 1;
+            goto cleanup;
+        }
+    }
+
+    if (opts->watch > 0) {
+        // एक line नीचे बचती है, ताकि cursor वहाँ रहे और screen scroll न हो
+        size_t rows, cols;
+        term_size(STDOUT_FILENO, &rows, &cols);
+        view = term_view_init(height, width, rows > 1 ? rows - 1 : 1, cols, opts->watch_glyph);
+        if (view == NULL) {
+            printf("Error creating terminal view\n");
+            error_code = 1;
+            goto cleanup;
+        }
+    }
+
+    if (opts->record_filename) {
+        RecorderConfig record = {
+            opts->record_filename, record_format_for(opts->record_filename), height, width,
+            opts->record_every, RECORD_DEFAULT_QUEUE, opts->record_drop ? RECORD_DROP : RECORD_BLOCK
+        };
+        recorder = recorder_start(&record);
+        if (recorder == NULL) {
+            printf("Error starting recording: %s\n", opts->record_filename);
+            error_code = 1;
+            goto cleanup;
+        }
+    }
+
+    CheckpointPlan plan = {opts->checkpoint_filename, opts->checkpoint_every, start_generation, rules};
+
+    double start = now_seconds();
+    int status;
+    switch (opts->engine) {
+        case ENGINE_PACKED:
+            status = run_packed_engine(front, rules, pool, generations, &plan);
+            break;
+        case ENGINE_HASHLIFE:
+            status = run_hashlife_engine(front, rules, opts->cache_mb, generations);
+            break;
+        case ENGINE_SPARSE:
+            status = run_sparse_engine(front, rules, generations);
+            break;
+        case ENGINE_GPU:
+            status = run_gpu_engine(front, rules, generations, &plan);
+            break;
+        case ENGINE_BLOCKED:
+            status = run_blocked_engine(front, rules, pool, generations, &plan);
+            break;
+        default:
+            status = run_board_engine(&front, &back, rules, pool, &generations, &plan, stats, cycles,
+                                      view, opts->watch, recorder);
+            break;
+    }
+    double elapsed = now_seconds() - start;
+
+    if (status != 0) {
+        printf("Error computing next generation\n");
+        error_code = 1;
+        goto cleanup;
+    }
+
+    double cells = (double)height * (double)width * (double)generations;
+    printf("Generations: %ld\n", generations);
+    printf("Threads: %d\n", opts->engine == ENGINE_HASHLIFE || opts->engine == ENGINE_SPARSE ||
+                            opts->engine == ENGINE_GPU ? 1 : pool_size(pool));
+    if (opts->engine == ENGINE_BOARD || opts->engine == ENGINE_BLOCKED) printf("Kernel: %s\n", simd_kernel_name());
+    if (plan.filename && generations > 0) printf("Checkpoint: %s (generation %llu)\n", plan.filename,
+                              (unsigned long long)(start_generation + (uint64_t)generations));
+    printf("Elapsed: %.6f s\n", elapsed);
+    if (elapsed > 0) {
+        printf("Generations/s: %.1f\n", (double)generations / elapsed);
+        printf("Cells/s: %.3e\n", cells / elapsed);
+    }
+
+    if (opts->out_filename) {
+        if (board_to_file(opts->out_filename, front) != 0) {
+            printf("Error writing file: %s\n", opts->out_filename);
+            error_code = 1;
+            goto cleanup;
+        }
+        printf("Final board written to: %s\n", opts->out_filename);
+    }
+
+cleanup:
+    if (recorder != NULL) {
+        RecorderStats recorded;
+        if (recorder_close(recorder, &recorded) != 0) {
+            printf("Error writing recording: %s\n", opts->record_filename);
+            error_code = 1;
+        } else {
+            printf("Recording: %s (%llu frames, %llu dropped, %llu bytes)\n", opts->record_filename,
+                   (unsigned long long)recorded.frames, (unsigned long long)recorded.dropped,
+                   (unsigned long long)recorded.bytes);
+        }
+    }
+    if (stats != NULL && fclose(stats) != 0) {
+        printf("Error writing stats file: %s\n", opts->stats_filename);
+        error_code = 1;
+    }
+    cycle_detector_free(cycles);
+    if (view != NULL) term_view_free(view);
+    if (pool != NULL) pool_free(pool);
+    if (front != NULL) board_free(front);
+    if (back != NULL) board_free(back);
+    rules_free(rules);
+
+    return error_code;
+}
@@ -0,0 +1,40 @@
+/**
+ * @file headless.h
+ * @brief SDL के बिना batch simulation mode का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Headless mode window या renderer नहीं बनाता और generations के बीच कोई
+ * delay नहीं होता, इसलिए simulation engine की पूरी speed से चलता है।
+ * यह render-less compute nodes पर parameter sweeps के लिए है।
+ */
+
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+#include "options.h"
+
+/**
+ * @brief options के अनुसार headless simulation चलाता है
+ *
+ * Pattern file (या random board) load करता है, opts->generations
+ * generations चलाता है, timing summary print करता है और अगर
+ * opts->out_filename दिया गया है तो final board उसमें लिखता है।
+ *
+ * opts->checkpoint_filename देने पर हर opts->checkpoint_every generations
+ * के बाद और अंत में checkpoint लिखा जाता है। opts->resume_filename से
+ * बोर्ड, rules और generation restore होते हैं, और सिर्फ generation
+ * opts->generations तक की बची generations चलती हैं।
+ *
+ * opts->batch देने पर single board की जगह हर rule के opts->batch random
+ * boards batch_run से चलते हैं और results opts->batch_filename में जाते हैं।
+ *
+ * opts->domain_count देने पर यह process distributed run का एक rank है
+ * (domain.h): सिर्फ अपनी strip चलाता है और outputs "<FILE>.<rank>" में लिखता है।
+ *
+ * @param opts parsed command line options
+ * @return सफल होने पर 0, error होने पर non-zero exit code
+ */
+int headless_run(const Options *opts);
+
+#endif // HEADLESS_H
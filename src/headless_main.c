@@ -0,0 +1,33 @@
+/**
+ * @file headless_main.c
+ * @brief Headless binary (gameoflife-headless) का entry point
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * यह binary SDL के बिना link होता है और हमेशा headless mode में चलता है,
+ * इसलिए इसे बिना display वाले compute nodes पर चलाया जा सकता है।
+ */
+
+#include "headless.h"
+#include "options.h"
+
+/**
+ * @brief Main function - options parse करके headless simulation चलाता है
+ * @param argc command line arguments की संख्या
+ * @param argv command line arguments का array
+ * @return program exit status (0=success, non-zero=error)
+ */
+int main(int argc, char **argv) {
+    Options opts;
+    if (options_parse(argc, argv, &opts) != 0) {
+        options_print_usage(argv[0]);
+        return 1;
+    }
+    if (opts.show_help) {
+        options_print_usage(argv[0]);
+        return 0;
+    }
+
+    opts.headless = true;
+    return headless_run(&opts);
+}
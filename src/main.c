@@ -16,25 +16,22 @@
 #include <time.h>
 
 #include "board.h"
+#include "checkpoint.h"
+#include "hashlife.h"
+#include "headless.h"
+#include "options.h"
+#include "profile.h"
+#include "render.h"
+#include "simulator.h"
+#include "sparse_board.h"
 #include "state.h"
 #include "rules.h"
 
 /**
- * @brief प्रत्येक cell का size pixels में
+ * @brief प्रत्येक cell का default size pixels में (initial zoom level)
  */
 #define PIXEL_SIZE 10
 
-/**
- * @brief दो variables को swap करने के लिए macro
- * @param type variables का data type
- * @param x पहला variable
- * @param y दूसरा variable
- */
-#define SWAP(type, x, y) \
-    type temp = x; \
-    x = y; \
-    y = temp;
-
 /**
  * @brief Available rule sets की कुल संख्या
  */
@@ -54,80 +51,125 @@ Rules* (*rule_creators[NUM_RULE_SETS])(void) = {
 };
 
 /**
- * @brief SDL renderer का color cell की value के अनुसार set करता है
- * 
- * यह function cell की state (जीवित/मृत) के अनुसार renderer का color
- * black (मृत) या white (जीवित) set करता है।
- * 
- * @param renderer SDL renderer pointer
- * @param cell cell की value (0=मृत, 1=जीवित)
- * @return सफल होने पर 0, error होने पर -1
+ * @brief rule_creators के rules, startup पर एक बार बनते हैं
+ *
+ * T key पर current rules में इनकी copy होती है, इसलिए switching में
+ * कोई allocation नहीं होता।
  */
-int set_pixel_color(SDL_Renderer *renderer, int cell) {
-    if (renderer == NULL) return -1;
-    if (cell != 0 && cell != 1) {
-        return -1;
+static Rules rule_presets[NUM_RULE_SETS];
+
+/**
+ * @brief rule_presets भरता है
+ * @return सफल होने पर 0, memory allocation fail होने पर -1
+ */
+static int load_rule_presets(void) {
+    for (int i = 0; i < NUM_RULE_SETS; i++) {
+        Rules *preset = rule_creators[i]();
+        if (preset == NULL) return -1;
+        rule_presets[i] = *preset;
+        rules_free(preset);
     }
-    return (SDL_SetRenderDrawColor(renderer, 255 * cell, 255 * cell, 255 * cell, 255) == 0) ? 0 : -1;
+    return 0;
 }
 
 /**
- * @brief एक specific cell को screen पर draw करता है
+ * @brief Window की maximum चौड़ाई pixels में
  * 
- * यह function board के specific coordinates पर स्थित cell को
- * SDL renderer का उपयोग करके screen पर rectangle के रूप में draw करता है।
+ * बड़े बोर्ड्स पर window इससे बड़ी नहीं होती; सिर्फ viewport वाला हिस्सा
+ * draw होता है और बाकी बोर्ड pan/zoom से देखा जाता है।
+ */
+#define MAX_WINDOW_WIDTH 1280
+
+/**
+ * @brief Window की maximum ऊंचाई pixels में
+ */
+#define MAX_WINDOW_HEIGHT 800
+
+/**
+ * @brief एक frame में जमा हुए paint edits
+ *
+ * Drag के दौरान हर mouse motion sample के cell तक पिछले sample से line
+ * खींची जाती है (तेज motion में बीच की cells भी paint हों), और सभी cells
+ * frame के अंत में एक simulator_paint_batch command में जाती हैं।
+ */
+typedef struct PaintBatch {
+    SimulatorCell *cells;   /**< इस frame की cells */
+    size_t count;           /**< cells की संख्या */
+    size_t capacity;        /**< cells की capacity */
+    int alive;              /**< Batch की cells जीवित (1) या मृत (0) होंगी */
+    int has_last;           /**< पिछला motion sample है (line उसी से शुरू होती है) */
+    long last_row;          /**< पिछले sample की row (बोर्ड के बाहर भी हो सकती है) */
+    long last_col;          /**< पिछले sample का column */
+} PaintBatch;
+
+/**
+ * @brief Viewport को बोर्ड की सीमाओं के अंदर रखता है
  * 
- * @param renderer SDL renderer pointer
- * @param board source board
- * @param x cell का x coordinate (row)
- * @param y cell का y coordinate (column)
- * @return सफल होने पर 0, error होने पर -1
+ * अगर बोर्ड window से छोटा है तो viewport top-left पर रहता है।
  * 
- * @note SDL coordinates board coordinates से inverted हैं
+ * @param state current game state (viewport fields)
+ * @param board current board
  */
-int board_pixel_draw(SDL_Renderer *renderer, Board *board, int x, int y) {
-    if (renderer == NULL || board == NULL) return -1;
-    if (x < 0 || y < 0 || x >= (int)board->height || y >= (int)board->width) return -1;
+void viewport_clamp(State *state, Board *board) {
+    if (!state || !board) return;
     
-    // 2D coordinates को 1D index में convert करें
-    size_t index = x * board->width + y;
+    long max_row = (long)board->height - state->window_height / state->zoom;
+    long max_col = (long)board->width - state->window_width / state->zoom;
+    if (max_row < 0) max_row = 0;
+    if (max_col < 0) max_col = 0;
     
-    if (set_pixel_color(renderer, board->cells[index]) != 0) return -1;
-
-    // Border के लिए 1 pixel offset add करें
-    // NOTE: SDL coordinates board coordinates से inverted हैं
-    struct SDL_Rect pixel = { 
-        (y + 1) * PIXEL_SIZE, 
-        (x + 1) * PIXEL_SIZE, 
-        PIXEL_SIZE, 
-        PIXEL_SIZE 
-    };
+    if (state->view_row > max_row) state->view_row = max_row;
+    if (state->view_col > max_col) state->view_col = max_col;
+    if (state->view_row < 0) state->view_row = 0;
+    if (state->view_col < 0) state->view_col = 0;
+}
+
+/**
+ * @brief Zoom level बदलता है, anchor pixel के नीचे वाली cell को fixed रखते हुए
+ * 
+ * @param state current game state
+ * @param board current board
+ * @param zoom नया zoom (1 से MAX_ZOOM तक clamp होता है)
+ * @param anchor_x anchor का screen x (pixels)
+ * @param anchor_y anchor का screen y (pixels)
+ */
+void viewport_zoom(State *state, Board *board, int zoom, int anchor_x, int anchor_y) {
+    if (!state || !board) return;
+    if (zoom < 1) zoom = 1;
+    if (zoom > MAX_ZOOM) zoom = MAX_ZOOM;
+    
+    // Anchor के नीचे वाली cell
+    long row = state->view_row + anchor_y / state->zoom;
+    long col = state->view_col + anchor_x / state->zoom;
     
-    return (SDL_RenderFillRect(renderer, &pixel) == 0) ? 0 : -1;
+    state->zoom = zoom;
+    state->view_row = row - anchor_y / zoom;
+    state->view_col = col - anchor_x / zoom;
+    viewport_clamp(state, board);
 }
 
 /**
- * @brief पूरे board को screen पर draw करता है
+ * @brief Screen coordinates को board coordinates में convert करता है
  * 
- * यह function board के सभी cells को iterate करके प्रत्येक को
- * screen पर draw करता है। यह main rendering function है।
+ * @param state current game state (viewport)
+ * @param board current board
+ * @param pixel_x screen x (pixels)
+ * @param pixel_y screen y (pixels)
+ * @param row board की row store करने के लिए pointer
+ * @param col board का column store करने के लिए pointer
+ * @return cell बोर्ड के अंदर है तो 0, बाहर है तो -1
  * 
- * @param renderer SDL renderer pointer
- * @param board draw करने वाला board
- * @return सफल होने पर 0, error होने पर -1
+ * @note SDL का x-axis board के columns और y-axis board की rows है
  */
-int board_draw(SDL_Renderer *renderer, Board *board) {
-    if (renderer == NULL || board == NULL) return -1;
+int screen_to_cell(State *state, Board *board, int pixel_x, int pixel_y, size_t *row, size_t *col) {
+    if (!state || !board || !row || !col || pixel_x < 0 || pixel_y < 0) return -1;
     
-    // 1D array में single loop - better performance
-    for (size_t i = 0; i < board->width * board->height; i++) {
-        // 1D index को 2D coordinates में convert करें drawing के लिए
-        size_t x = i / board->width;
-        size_t y = i % board->width;
-        
-        if (board_pixel_draw(renderer, board, x, y) != 0) return -1;
-    }
+    long r = state->view_row + pixel_y / state->zoom;
+    long c = state->view_col + pixel_x / state->zoom;
+    if (r < 0 || c < 0 || r >= (long)board->height || c >= (long)board->width) return -1;
     
+    *row = (size_t)r;
+    *col = (size_t)c;
     return 0;
 }
 
@@ -165,7 +207,8 @@ SDL_Window *create_window(char *title, unsigned int width, unsigned int height)
  * @brief SDL renderer create करता है
  * 
  * यह function दी गई window के लिए SDL renderer create करता है
- * जो graphics operations के लिए उपयोग किया जाता है।
+ * जो graphics operations के लिए उपयोग किया जाता है। Present display के
+ * vsync से sync होता है, इसलिए frame rate display refresh rate पर रहता है।
  * 
  * @param window target SDL window
  * @return सफल होने पर SDL_Renderer pointer, error होने पर NULL
@@ -179,7 +222,7 @@ SDL_Renderer *create_renderer(SDL_Window *window)
 	return SDL_CreateRenderer(
 		window,
 		FIRST_RENDERING_DRIVER,
-		0
+		SDL_RENDERER_PRESENTVSYNC
 	);
 }
 
@@ -206,39 +249,98 @@ int load_board_from_file(const char *filename, Board *board) {
 }
 
 /**
- * @brief Mouse coordinates को board coordinates में convert करके cell paint करता है
+ * @brief batch में एक cell जोड़ता है (बोर्ड के बाहर की cells skip होती हैं)
  * 
- * यह function mouse के current position को board coordinates में convert करता है
- * और state के अनुसार cell को paint करता है (जीवित या मृत)।
+ * @param batch paint batch
+ * @param board currently drawn snapshot (dimensions के लिए)
+ * @param row cell की row
+ * @param col cell का column
+ * @return सफल होने पर 0, memory allocation fail होने पर -1
+ */
+int paint_batch_add(PaintBatch *batch, Board *board, long row, long col) {
+    if (row < 0 || col < 0 || row >= (long)board->height || col >= (long)board->width) return 0;
+    
+    if (batch->count == batch->capacity) {
+        size_t capacity = batch->capacity ? batch->capacity * 2 : 256;
+        SimulatorCell *cells = realloc(batch->cells, capacity * sizeof(SimulatorCell));
+        if (!cells) return -1;
+        batch->cells = cells;
+        batch->capacity = capacity;
+    }
+    batch->cells[batch->count].x = (size_t)row;
+    batch->cells[batch->count].y = (size_t)col;
+    batch->count++;
+    return 0;
+}
+
+/**
+ * @brief Mouse position वाली cell को paint batch में जोड़ता है
+ * 
+ * यह function mouse के current position को viewport के अनुसार board coordinates
+ * में convert करता है। Drag के दौरान पिछले motion sample से इस cell तक
+ * की line (Bresenham) की सभी cells जुड़ती हैं, इसलिए तेज motion में बीच
+ * की cells नहीं छूटतीं; बोर्ड के बाहर जाती line clip होती है। Edits
+ * frame के अंत में paint_batch_flush से simulator को जाते हैं।
  * 
  * @param mouse_x mouse का x coordinate
  * @param mouse_y mouse का y coordinate  
- * @param board target board
- * @param state current game state (paint mode determine करने के लिए)
- * @return सफल होने पर 0, out of bounds या error होने पर -1
+ * @param board currently drawn snapshot (dimensions के लिए)
+ * @param state current game state (viewport)
+ * @param batch paint batch (alive पहले से set)
+ * @return सफल होने पर 0, memory allocation fail होने पर -1
  */
-int paint_cell_at_mouse(int mouse_x, int mouse_y, Board *board, State *state) {
-    if (!board || !state) return -1;
+int paint_at_mouse(int mouse_x, int mouse_y, Board *board, State *state, PaintBatch *batch) {
+    if (!board || !state || !batch) return -1;
     
-    // Mouse coordinates को board coordinates में convert करें
-    // 1-pixel border offset को account करें
-    int board_y = mouse_x / PIXEL_SIZE - 1;
-    int board_x = mouse_y / PIXEL_SIZE - 1;
+    // Mouse coordinates को viewport के अनुसार board coordinates में convert करें (clamp के बिना)
+    long row = state->view_row + mouse_y / state->zoom;
+    long col = state->view_col + mouse_x / state->zoom;
+    int had_last = batch->has_last;
+    long r = had_last ? batch->last_row : row;
+    long c = had_last ? batch->last_col : col;
+    if (had_last && r == row && c == col) return 0;
+    batch->has_last = 1;
+    batch->last_row = row;
+    batch->last_col = col;
     
-    // Bounds check करें
-    if (board_x < 0 || board_y < 0 || board_x >= (int)board->height || board_y >= (int)board->width) {
-        return -1;
+    // Line का पहला cell पिछले sample में जुड़ चुका है (नए drag पर line एक cell की है)
+    long dr = labs(row - r), dc = labs(col - c);
+    long step_r = r < row ? 1 : -1, step_c = c < col ? 1 : -1;
+    long error = dc - dr;
+    for (int skip = had_last;; skip = 0) {
+        if (!skip && paint_batch_add(batch, board, r, c) != 0) return -1;
+        if (r == row && c == col) break;
+        long twice = 2 * error;
+        if (twice > -dr) {
+            error -= dr;
+            c += step_c;
+        }
+        if (twice < dc) {
+            error += dc;
+            r += step_r;
+        }
     }
-    
-    // 2D coordinates को 1D index में convert करें
-    size_t index = board_x * board->width + board_y;
-    
-    // Paint mode के अनुसार cell set करें
-    board->cells[index] = state->drag_paint_mode;
-    
     return 0;
 }
 
+/**
+ * @brief जमा हुए paint edits एक command में simulator को भेजता है
+ * 
+ * Simulator अपने thread पर सभी cells अगली generation से पहले एक साथ
+ * apply करता है और एक ही snapshot publish करता है।
+ * 
+ * @param batch paint batch (count 0 हो जाता है)
+ * @param sim simulator
+ * @return सफल होने पर 0, error होने पर -1
+ */
+int paint_batch_flush(PaintBatch *batch, Simulator *sim) {
+    if (batch->count == 0) return 0;
+    
+    int status = simulator_paint_batch(sim, batch->cells, batch->count, batch->alive);
+    batch->count = 0;
+    return status;
+}
+
 /**
  * @brief Console में help text print करता है
  * 
@@ -259,6 +361,10 @@ void print_help(Rules *rules) {
     printf("Mouse Click - Toggle cell (when paused)\n");
     printf("Mouse Drag  - Paint alive cells (when paused)\n");
     printf("Ctrl+Drag   - Paint dead cells (when paused)\n");
+    printf("Arrow keys  - Pan the view\n");
+    printf("+ / -       - Zoom in / out (also mouse wheel)\n");
+    printf("HOME        - Reset view to top-left\n");
+    printf("[ / ]       - Slower / faster simulation (past max speed: unlimited)\n");
     printf("\nCurrent Rules: ");
     rules_print(rules);
     printf("=============================\n");
@@ -269,14 +375,19 @@ void print_help(Rules *rules) {
  * 
  * यह function सभी SDL events (keyboard, mouse) को handle करता है और
  * game state को accordingly update करता है। यह main input handling function है।
+ * बोर्ड बदलने वाले actions simulator को commands के रूप में भेजे जाते हैं;
+ * सभी events के paint edits एक batch में जमा होकर अंत में एक command
+ * बनते हैं।
  * 
  * @param state current game state
- * @param board current board
- * @param current_rules current active rules (switching के लिए modifiable)
+ * @param board currently drawn snapshot (viewport और painting के लिए)
+ * @param sim simulator
+ * @param current_rules current active rules (switching पर preset इसमें copy होता है)
+ * @param batch इस frame का paint batch
  * @return सफल होने पर 0, error होने पर -1
  */
-int process_events(State *state, Board *board, Rules **current_rules) {
-    if (state == NULL || board == NULL || current_rules == NULL) return -1;
+int process_events(State *state, Board *board, Simulator *sim, Rules *current_rules, PaintBatch *batch) {
+    if (state == NULL || board == NULL || sim == NULL || current_rules == NULL || batch == NULL) return -1;
     
     SDL_Event e;
     while (SDL_PollEvent(&e)) {
@@ -285,51 +396,106 @@ int process_events(State *state, Board *board, Rules **current_rules) {
                 state->keep_alive = 0;
                 break;
 
+            case SDL_WINDOWEVENT:
+                // Window का content फिर से दिखाना है (बोर्ड न बदला हो तब भी)
+                if (e.window.event == SDL_WINDOWEVENT_EXPOSED || e.window.event == SDL_WINDOWEVENT_SIZE_CHANGED ||
+                    e.window.event == SDL_WINDOWEVENT_RESTORED || e.window.event == SDL_WINDOWEVENT_SHOWN) {
+                    state->needs_redraw = true;
+                }
+                break;
+
             case SDL_KEYDOWN:
                 switch (e.key.keysym.sym) {
                     case SDLK_SPACE:
                         // Simulation को pause/unpause करें
                         state->pause = !state->pause;
+                        if (simulator_set_paused(sim, state->pause) != 0) return -1;
                         printf("Game %s\n", state->pause ? "PAUSED" : "RESUMED");
                         break;
                         
                     case SDLK_r:
-                        // File से reload करें अगर available है
+                        // File से reload करें अगर available है (simulator reload के बाद pause करता है)
                         if (state->loaded_filename) {
-                            if (load_board_from_file(state->loaded_filename, board) == 0) {
-                                state->pause = 1; // Reload के बाद pause करें
-                            }
+                            if (simulator_load(sim, state->loaded_filename) != 0) return -1;
+                            state->pause = 1;
                         } else {
                             printf("No file to reload from. Load a file first.\n");
                         }
                         break;
                         
                     case SDLK_c:
-                        // Board को clear करें
-                        board_clear(board);
-                        printf("Board cleared\n");
+                        // Board को clear करें (simulator pause भी करता है)
+                        if (simulator_clear(sim) != 0) return -1;
                         state->pause = 1;
                         break;
                         
                     case SDLK_g:
-                        // Random board generate करें
-                        board_random_fill(board);
-                        printf("Random board generated\n");
+                        // Random board generate करें (simulator pause भी करता है)
+                        if (simulator_random_fill(sim) != 0) return -1;
                         state->pause = 1;
                         break;
                         
                     case SDLK_t:
                         // Rule set को switch करें
-                        rules_free(*current_rules);
                         state->current_rule_index = (state->current_rule_index + 1) % NUM_RULE_SETS;
-                        *current_rules = rule_creators[state->current_rule_index]();
+                        *current_rules = rule_presets[state->current_rule_index];
+                        if (simulator_set_rules(sim, current_rules) != 0) return -1;
                         printf("Switched to rule set: ");
-                        rules_print(*current_rules);
+                        rules_print(current_rules);
                         break;
                         
                     case SDLK_h:
                         // Help show करें
-                        print_help(*current_rules);
+                        print_help(current_rules);
+                        break;
+                        
+                    case SDLK_UP:
+                    case SDLK_DOWN:
+                    case SDLK_LEFT:
+                    case SDLK_RIGHT: {
+                        // View को visible area के 1/8 से pan करें
+                        long rows = render_visible_cells(state->window_height, state->zoom) / 8 + 1;
+                        long cols = render_visible_cells(state->window_width, state->zoom) / 8 + 1;
+                        SDL_Keycode key = e.key.keysym.sym;
+                        if (key == SDLK_UP) state->view_row -= rows;
+                        if (key == SDLK_DOWN) state->view_row += rows;
+                        if (key == SDLK_LEFT) state->view_col -= cols;
+                        if (key == SDLK_RIGHT) state->view_col += cols;
+                        viewport_clamp(state, board);
+                        break;
+                    }
+                        
+                    case SDLK_EQUALS:
+                    case SDLK_PLUS:
+                    case SDLK_KP_PLUS:
+                        // Window के center के around zoom in करें
+                        viewport_zoom(state, board, state->zoom * 2, state->window_width / 2, state->window_height / 2);
+                        break;
+                        
+                    case SDLK_MINUS:
+                    case SDLK_KP_MINUS:
+                        viewport_zoom(state, board, state->zoom / 2, state->window_width / 2, state->window_height / 2);
+                        break;
+                        
+                    case SDLK_LEFTBRACKET:
+                    case SDLK_RIGHTBRACKET:
+                        // Speed आधी / दोगुनी करें; MAX_SPEED के बाद "max" (0)
+                        if (e.key.keysym.sym == SDLK_RIGHTBRACKET) {
+                            state->speed = (state->speed == 0 || state->speed >= MAX_SPEED) ? 0 : state->speed * 2;
+                        } else {
+                            state->speed = state->speed == 0 ? MAX_SPEED : (state->speed > 1 ? state->speed / 2 : 1);
+                        }
+                        if (simulator_set_speed(sim, state->speed) != 0) return -1;
+                        if (state->speed == 0) {
+                            printf("Speed: max (as many generations as fit in each frame)\n");
+                        } else {
+                            printf("Speed: %ld generations/s\n", state->speed);
+                        }
+                        break;
+                        
+                    case SDLK_HOME:
+                        state->view_row = 0;
+                        state->view_col = 0;
                         break;
                         
                     case SDLK_ESCAPE:
@@ -348,27 +514,86 @@ int process_events(State *state, Board *board, Rules **current_rules) {
                     
                     state->is_dragging = true;
                     
+                    // पिछले mode की cells अलग command में, फिर नई line यहीं से शुरू
+                    if (batch->alive != state->drag_paint_mode && paint_batch_flush(batch, sim) != 0) return -1;
+                    batch->alive = state->drag_paint_mode;
+                    batch->has_last = 0;
+                    
                     // Initial cell paint करें
-                    paint_cell_at_mouse(e.button.x, e.button.y, board, state);
+                    if (paint_at_mouse(e.button.x, e.button.y, board, state, batch) != 0) return -1;
                 }
                 break;
                 
             case SDL_MOUSEBUTTONUP:
                 if (e.button.button == SDL_BUTTON_LEFT) {
                     state->is_dragging = false;
+                    batch->has_last = 0;
+                }
+                break;
+                
+            case SDL_MOUSEWHEEL: {
+                // Mouse cursor के नीचे वाली cell को fixed रखते हुए zoom करें
+                int mouse_x, mouse_y;
+                SDL_GetMouseState(&mouse_x, &mouse_y);
+                if (e.wheel.y > 0) {
+                    viewport_zoom(state, board, state->zoom * 2, mouse_x, mouse_y);
+                } else if (e.wheel.y < 0) {
+                    viewport_zoom(state, board, state->zoom / 2, mouse_x, mouse_y);
                 }
                 break;
+            }
                 
             case SDL_MOUSEMOTION:
                 if (state->pause && state->is_dragging) {
                     // Dragging के दौरान painting continue करें
-                    paint_cell_at_mouse(e.motion.x, e.motion.y, board, state);
+                    if (paint_at_mouse(e.motion.x, e.motion.y, board, state, batch) != 0) return -1;
                 }
                 break;
         }
     }
     
-    return 0;
+    return paint_batch_flush(batch, sim);
+}
+
+/**
+ * @brief Profiler का summary window title में दिखाता है
+ * 
+ * Title हर second में एक बार ही update होता है, ताकि title बदलने का
+ * cost खुद measurements में न दिखे।
+ * 
+ * @param window SDL window
+ * @param profiler profiler (NULL = कुछ नहीं)
+ * @param last_update पिछले update का SDL_GetTicks
+ */
+void update_profile_title(SDL_Window *window, const Profiler *profiler, Uint32 *last_update) {
+    if (!window || !profiler || !last_update) return;
+    
+    Uint32 now = SDL_GetTicks();
+    if (now - *last_update < 1000) return;
+    *last_update = now;
+    
+    char title[256];
+    int used = snprintf(title, sizeof(title), "Game Of Life - Enhanced | ");
+    if (profiler_format_summary(profiler, title + used, sizeof(title) - (size_t)used) == 0) {
+        SDL_SetWindowTitle(window, title);
+    }
+}
+
+/**
+ * @brief Frame period पूरा होने तक wait करता है
+ * 
+ * Vsync मिलने पर SDL_RenderPresent खुद frame period तक block करता है और
+ * यहाँ wait नहीं होता; vsync न हो (software renderer आदि) तो यही frame
+ * rate को display refresh rate पर रखता है।
+ * 
+ * @param frame_start frame शुरू होने का time (seconds)
+ * @param frame_period एक frame का time (seconds)
+ */
+void limit_frame_rate(double frame_start, double frame_period) {
+    double remaining = frame_period - (now_seconds() - frame_start);
+    if (remaining > 0.001) {
+        SDL_Delay((Uint32)(remaining * 1000));
+    }
 }
 
 /**
@@ -376,7 +601,8 @@ int process_events(State *state, Board *board, Rules **current_rules) {
  * 
  * यह function game को initialize करता है, main loop run करता है,
  * और cleanup operations perform करता है। Command line arguments को
- * handle करके file loading भी support करता है।
+ * handle करके file loading भी support करता है। --headless देने पर
+ * SDL initialize किए बिना headless_run चलता है।
  * 
  * @param argc command line arguments की संख्या
  * @param argv command line arguments का array
@@ -385,25 +611,79 @@ int process_events(State *state, Board *board, Rules **current_rules) {
 int main(int argc, char **argv) {
     int error_code = 0;
 
-    // Board dimensions set करें
-    const size_t height = 64;
-    const size_t width = height;
-    
-    // SDL window का size define करें
-    // Border के लिए 2 extra pixels add करें
-    const int window_width = PIXEL_SIZE * (height + 2);
-    const int window_height = PIXEL_SIZE * (width + 2);
+    // Command line options parse करें
+    Options opts;
+    if (options_parse(argc, argv, &opts) != 0) {
+        options_print_usage(argv[0]);
+        return 1;
+    }
+    if (opts.show_help) {
+        options_print_usage(argv[0]);
+        return 0;
+    }
+
+    // Headless mode में SDL initialize ही नहीं होता
+    if (opts.headless) {
+        return headless_run(&opts);
+    }
+
+    // Board dimensions command line या pattern file से लें
+    size_t height = 0, width = 0;
+    options_board_size(&opts, &height, &width);
+    printf("Board size: %zu x %zu\n", height, width);
 
     // Rules initialize करें (default Conway's Life)
-    Rules *current_rules = rules_conway();
+    Rules *current_rules = opts.rule_name ? rules_from_name(opts.rule_name) : rules_conway();
     if (!current_rules) {
-        printf("Error initializing rules\n");
+        printf("Error initializing rules: %s\n", opts.rule_name ? opts.rule_name : "conway");
+        return 1;
+    }
+    if (load_rule_presets() != 0) {
+        printf("Error initializing rule sets\n");
+        rules_free(current_rules);
         return 1;
     }
 
-    // Boards create करें (double buffering के लिए)
-    Board *front = board_init(height, width);
-    Board *back = board_init(height, width);
+    // Resume होने पर edge mode checkpoint से आता है
+    BoardEdge edge = opts.edge;
+    if (opts.resume_filename) {
+        CheckpointInfo info;
+        if (checkpoint_read_info(opts.resume_filename, &info) != 0) {
+            printf("Error reading checkpoint: %s\n", opts.resume_filename);
+            rules_free(current_rules);
+            return 1;
+        }
+        edge = info.edge;
+        if (edge == BOARD_EDGE_TORUS && opts.engine != ENGINE_BOARD) {
+            printf("--edge torus is only supported by the board engine\n");
+            rules_free(current_rules);
+            return 1;
+        }
+    }
+
+    // Boards create करें (double buffering के लिए, simulator thread इन्हें step करता है)
+    Board *front = board_init_padded(height, width, edge);
+    Board *back = board_init_padded(height, width, edge);
+    
+    // Simulation की generation (checkpoints में save होती है)
+    uint64_t generation = 0;
+    
+    // Stepping के लिए persistent worker pool (सभी CPU cores)
+    ThreadPool *pool = NULL;
+    
+    // --engine hashlife होने पर stepping Hashlife universe में होती है
+    HashLife *life = NULL;
+    
+    // --engine sparse होने पर stepping unbounded sparse plane पर होती है
+    SparseBoard *sparse = NULL;
+    
+    // Stepping अलग thread पर; main loop सिर्फ events और published snapshot draw करता है
+    Simulator *sim = NULL;
+    Recorder *recorder = NULL;
+    
+    // --profile होने पर main loop के phases time होते हैं (NULL = profiling बंद)
+    Profiler *profiler = NULL;
+    Uint32 title_ticks = 0;
     
     if (front == NULL || back == NULL) {
         printf("Erreur lors de l'allocation des boards\n");
@@ -411,6 +691,46 @@ int main(int argc, char **argv) {
         goto cleanup;
     }
 
+    pool = pool_init(opts.threads);
+    if (pool == NULL) {
+        printf("Error creating thread pool\n");
+        error_code = 1;
+        goto cleanup;
+    }
+
+    // --seed न हो तो हर launch पर नया random बोर्ड
+    uint64_t seed = opts.seed_given ? (uint64_t)opts.seed : (uint64_t)time(NULL);
+
+    if (opts.profile) {
+        profiler = profiler_init(PROFILE_DEFAULT_FRAMES);
+        if (profiler == NULL) {
+            printf("Error creating profiler\n");
+            error_code = 1;
+            goto cleanup;
+        }
+    }
+
+    if (opts.engine == ENGINE_HASHLIFE) {
+        life = hashlife_init(current_rules, (size_t)opts.cache_mb * 1024 * 1024);
+        if (life == NULL) {
+            printf("Error creating Hashlife universe (B0 and Generations rules are not supported)\n");
+            error_code = 1;
+            goto cleanup;
+        }
+    } else if (opts.engine == ENGINE_SPARSE) {
+        if ((current_rules->birth_rules & 1) || current_rules->kernel != RULES_KERNEL_TOTALISTIC) {
+            printf("Sparse engine supports only outer-totalistic rules without B0\n");
+            error_code = 1;
+            goto cleanup;
+        }
+        sparse = sparse_board_init();
+        if (sparse == NULL) {
+            printf("Error creating sparse board\n");
+            error_code = 1;
+            goto cleanup;
+        }
+    }
+
     // Game state create करें
     struct State *state = NULL;
     if (state_init(&state) != 0)
@@ -420,14 +740,27 @@ int main(int argc, char **argv) {
         goto cleanup;
     }
 
-    // Command line arguments के अनुसार file load करें या random generate करें
-    if (argc > 1) {
-        char *filename = argv[1];
+    // Command line arguments के अनुसार checkpoint या file load करें, या random generate करें
+    if (opts.resume_filename) {
+        if (board_load(opts.resume_filename, front, &generation, current_rules) != 0) {
+            printf("Error loading checkpoint: %s\n", opts.resume_filename);
+            error_code = 1;
+            goto cleanup;
+        }
+        printf("Resumed from generation %llu\n", (unsigned long long)generation);
+        
+        // T key वाली rule list में checkpoint का rule set ढूंढें
+        for (int i = 0; i < NUM_RULE_SETS; i++) {
+            if (rules_equal(&rule_presets[i], current_rules)) {
+                state->current_rule_index = i;
+            }
+        }
+    } else if (opts.filename) {
+        char *filename = (char *)opts.filename;
         
         if (load_board_from_file(filename, front) != 0) {
             printf("Erreur lors de la lecture du fichier. Générant une grille aléatoire à la place.\n");
-            srand(time(NULL));
-            board_random_fill(front);
+            board_random_fill(front, seed, opts.density, pool);
         } else {
             // Reloading के लिए filename store करें
             state_set_filename(state, filename);
@@ -435,16 +768,23 @@ int main(int argc, char **argv) {
     } else {
         printf("Chargement d'une grille aléatoire\n");
 
-        srand(time(NULL));
-        if (board_random_fill(front) != 0) {
+        if (board_random_fill(front, seed, opts.density, pool) != 0) {
             printf("Erreur lors du remplissage aléatoire. Arrêt du programme.\n");
             error_code = 1;
             goto cleanup;
         }
     }
 
+    // Window size बोर्ड size से decoupled है: बोर्ड PIXEL_SIZE पर fit हो तो
+    // पूरा दिखे, वरना window max size की रहे और viewport pan/zoom हो
+    int fit_zoom = (int)((MAX_WINDOW_WIDTH / width < MAX_WINDOW_HEIGHT / height)
+                         ? MAX_WINDOW_WIDTH / width : MAX_WINDOW_HEIGHT / height);
+    state->zoom = fit_zoom >= PIXEL_SIZE ? PIXEL_SIZE : (fit_zoom > 0 ? fit_zoom : 1);
+    state->window_width = width * state->zoom < MAX_WINDOW_WIDTH ? (int)width * state->zoom : MAX_WINDOW_WIDTH;
+    state->window_height = height * state->zoom < MAX_WINDOW_HEIGHT ? (int)height * state->zoom : MAX_WINDOW_HEIGHT;
+
     // SDL initialize करें
-    SDL_Window *window = create_window("Game Of Life - Enhanced", window_height, window_width);
+    SDL_Window *window = create_window("Game Of Life - Enhanced", state->window_width, state->window_height);
     if (window == NULL) {
         printf("Erreur lors de la création de la fenêtre SDL: %s\n", SDL_GetError());
         error_code = 1;
@@ -458,54 +798,154 @@ int main(int argc, char **argv) {
         goto cleanup_window;
     }
 
+    // Board को streaming texture से draw करने वाला renderer
+    BoardRenderer *view = board_renderer_init(renderer, state->window_width, state->window_height);
+    if (view == NULL) {
+        printf("Error creating board texture: %s\n", SDL_GetError());
+        error_code = 1;
+        goto cleanup_renderer;
+    }
+
+    // Frame rate display refresh rate पर; max speed पर simulator हर frame period में publish करता है
+    SDL_DisplayMode display_mode;
+    int refresh_rate = 60;
+    if (SDL_GetCurrentDisplayMode(SDL_GetWindowDisplayIndex(window), &display_mode) == 0
+        && display_mode.refresh_rate > 0) {
+        refresh_rate = display_mode.refresh_rate;
+    }
+    double frame_period = 1.0 / refresh_rate;
+    
+    // Simulator thread हर due generation recorder को देता है; encoding उसके अपने thread पर
+    if (opts.record_filename) {
+        RecorderConfig record = {
+            opts.record_filename, record_format_for(opts.record_filename), height, width,
+            opts.record_every, RECORD_DEFAULT_QUEUE, opts.record_drop ? RECORD_DROP : RECORD_BLOCK
+        };
+        recorder = recorder_start(&record);
+        if (recorder == NULL) {
+            printf("Error starting recording: %s\n", opts.record_filename);
+            error_code = 1;
+            board_renderer_free(view);
+            goto cleanup_renderer;
+        }
+    }
+
+    state->speed = opts.speed;
+    SimulatorConfig config = {
+        front, back, current_rules, pool, life, sparse, generation, state->speed, frame_period,
+        opts.checkpoint_filename, opts.checkpoint_every, recorder, seed + 1, opts.density
+    };
+    sim = simulator_start(&config);
+    if (sim == NULL) {
+        printf("Error starting simulation thread\n");
+        error_code = 1;
+        board_renderer_free(view);
+        goto cleanup_renderer;
+    }
+
     // Initial help print करें
     print_help(current_rules);
     
-    // Paused state में start करें
+    // Paused state में start करें (simulator भी paused start होता है)
     state->pause = 1;
     printf("Starting paused. Press SPACE to begin simulation.\n");
 
-    // Main game loop
+    // Main game loop; हर frame के paint edits एक batch में simulator को जाते हैं
+    PaintBatch paint = { NULL, 0, 0, 1, 0, 0, 0 };
+    Board *board = simulator_acquire(sim, NULL);
+    SimulatorStepStats steps, last_steps;
+    simulator_step_stats(sim, &last_steps);
     while (state->keep_alive) {
-        if (process_events(state, front, &current_rules) != 0) {
+        update_profile_title(window, profiler, &title_ticks);
+        profiler_begin_frame(profiler);
+        double frame_start = now_seconds();
+        
+        if (process_events(state, board, sim, current_rules, &paint) != 0) {
             printf("Erreur lors du traitement des événements\n");
             error_code = 1;
             break;
         }
+        profiler_lap(profiler, PROFILE_EVENTS);
 
-        // Screen को black color से clear करें
-        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-        SDL_RenderClear(renderer);
-
-        if (board_draw(renderer, front) != 0) {
-            printf("Erreur lors du dessin de la board\n");
+        // Simulator की latest completed generation (block नहीं होता)
+        board = simulator_acquire(sim, NULL);
+        if (simulator_failed(sim)) {
             error_code = 1;
             break;
         }
-        
-        SDL_RenderPresent(renderer);
 
-        // अगर pause है तो next generation calculate न करें
-        if (state->pause) {
-            SDL_Delay(50); // Paused state में CPU usage reduce करें
-            continue;
+        // Stepping simulator thread पर होती है: नए snapshots तक का उसका time
+        simulator_step_stats(sim, &steps);
+        profiler_record_step(profiler, steps.generations - last_steps.generations, steps.seconds - last_steps.seconds);
+        last_steps = steps;
+        profiler_lap(profiler, PROFILE_ACQUIRE);
+
+        // नया snapshot, edit या viewport change न हो (जैसे paused और idle) तो frame draw ही नहीं होता
+        int redraw = state->needs_redraw || board_draw_pending(view, board, state);
+        if (redraw) {
+            // Screen को black color से clear करें
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+            SDL_RenderClear(renderer);
         }
-        
-        // Current rules के साथ next generation calculate करें
-        if (board_next(front, back, current_rules) != 0) {
-            printf("Erreur lors du calcul de la prochaine génération\n");
+        profiler_lap(profiler, PROFILE_CLEAR);
+
+        if (redraw && board_draw(view, board, state) != 0) {
+            printf("Erreur lors du dessin de la board\n");
             error_code = 1;
             break;
         }
+        profiler_lap(profiler, PROFILE_DRAW);
         
-        SWAP(Board *, front, back);
+        if (redraw) {
+            SDL_RenderPresent(renderer);
+            state->needs_redraw = false;
+        }
+        profiler_lap(profiler, PROFILE_PRESENT);
+    
+        // Display refresh rate से तेज frames न बनें
+        limit_frame_rate(frame_start, frame_period);
+        profiler_lap(profiler, PROFILE_DELAY);
+        profiler_end_frame(profiler);
+    }
     
-        // Next generation display करने से पहले wait करें
-        SDL_Delay(50);
+    free(paint.cells);
+
+    // Profiling summary और per-frame CSV
+    profiler_print_summary(profiler);
+    if (opts.profile_csv) {
+        if (profiler_write_csv(profiler, opts.profile_csv) == 0) {
+            printf("Frame timings written to: %s\n", opts.profile_csv);
+        } else {
+            printf("Error writing frame timings: %s\n", opts.profile_csv);
+        }
+    }
+
+    // Exit पर आखिरी checkpoint ताकि --resume वहीं से शुरू हो (thread रुकने के बाद)
+    simulator_stop(sim);
+    if (opts.checkpoint_filename) {
+        generation = simulator_generation(sim);
+        if (board_save(opts.checkpoint_filename, simulator_board(sim), generation, simulator_rules(sim)) == 0) {
+            printf("Checkpoint saved to %s (generation %llu)\n", opts.checkpoint_filename,
+                   (unsigned long long)generation);
+        } else {
+            printf("Error writing checkpoint: %s\n", opts.checkpoint_filename);
+        }
+    }
+    if (recorder != NULL) {
+        RecorderStats recorded;
+        if (recorder_close(recorder, &recorded) == 0) {
+            printf("Recording: %s (%llu frames, %llu dropped)\n", opts.record_filename,
+                   (unsigned long long)recorded.frames, (unsigned long long)recorded.dropped);
+        } else {
+            printf("Error writing recording: %s\n", opts.record_filename);
+        }
+        recorder = NULL;
     }
 
     printf("Game ended. Goodbye!\n");
 
+    board_renderer_free(view);
+
 cleanup_renderer:
     state_free(state);
     rules_free(current_rules);
@@ -516,6 +956,12 @@ cleanup_window:
     SDL_Quit();
 
 cleanup:
+    simulator_free(sim);
+    recorder_close(recorder, NULL);
+    profiler_free(profiler);
+    if (life != NULL) hashlife_free(life);
+    if (sparse != NULL) sparse_board_free(sparse);
+    if (pool != NULL) pool_free(pool);
     if (front != NULL) board_free(front);
     if (back != NULL) board_free(back);
 
@@ -0,0 +1,497 @@
+/**
+ * @file options.c
+ * @brief Command line options parsing का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Options "--name value" form में लिए जाते हैं। पहला non-option argument
+ * pattern file माना जाता है (पुराने "./gameoflife file.txt" usage की तरह)।
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "board.h"
+#include "checkpoint.h"
+#include "cycle.h"
+#include "domain.h"
+#include "gpu_board.h"
+#include "options.h"
+#include "rng.h"
+
+/**
+ * @brief string को non-negative long में convert करता है
+ * @param text convert करने वाली string
+ * @param value result store करने के लिए pointer
+ * @return सफल होने पर 0, invalid number होने पर -1
+ */
+static int parse_count(const char *text, long *value) {
+    if (!text || !value) return -1;
+
+    char *end = NULL;
+    long parsed = strtol(text, &end, 10);
+    if (end == text || *end != '\0' || parsed < 0) return -1;
+
+    *value = parsed;
+    return 0;
+}
+
+/**
+ * @brief option की value लेता है और index आगे बढ़ाता है
+ * @param argc arguments की संख्या
+ * @param argv arguments का array
+ * @param i current argument का index (value के बाद वाले पर move होता है)
+ * @return value string, अगर value missing है तो NULL
+ */
+static const char *option_value(int argc, char **argv, int *i) {
+    if (*i + 1 >= argc) {
+        printf("Missing value for option %s\n", argv[*i]);
+        return NULL;
+    }
+    (*i)++;
+    return argv[*i];
+}
+
+/**
+ * @brief command line arguments को parse करता है
+ *
+ * @param argc arguments की संख्या
+ * @param argv arguments का array
+ * @param opts parsed options store करने के लिए pointer
+ * @return सफल होने पर 0, invalid arguments होने पर -1
+ */
+int options_parse(int argc, char **argv, Options *opts) {
+    if (!argv || !opts) return -1;
+
+    // Default values
+    opts->filename = NULL;
+    opts->width = 0;
+    opts->height = 0;
+    opts->headless = false;
+    opts->generations = 1000;
+    opts->out_filename = NULL;
+    opts->threads = 0;
+    opts->engine = ENGINE_BOARD;
+    opts->rule_name = NULL;
+    opts->cache_mb = DEFAULT_CACHE_MB;
+    opts->edge = BOARD_EDGE_DEAD;
+    opts->checkpoint_filename = NULL;
+    opts->checkpoint_every = DEFAULT_CHECKPOINT_EVERY;
+    opts->resume_filename = NULL;
+    opts->speed = DEFAULT_SPEED;
+    opts->profile = false;
+    opts->profile_csv = NULL;
+    opts->stats_filename = NULL;
+    opts->until_stable = false;
+    opts->watch = 0;
+    opts->watch_glyph = TERM_GLYPH_BRAILLE;
+    opts->record_filename = NULL;
+    opts->record_every = 1;
+    opts->record_drop = false;
+    opts->batch = 0;
+    opts->batch_filename = NULL;
+    opts->seed = 1;
+    opts->seed_given = false;
+    opts->density = RNG_DEFAULT_DENSITY;
+    opts->domain_rank = 0;
+    opts->domain_count = 0;
+    opts->peers = NULL;
+    opts->halo = DOMAIN_DEFAULT_HALO;
+    opts->show_help = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = NULL;
+        long number = 0;
+
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            opts->show_help = true;
+        } else if (strcmp(arg, "--headless") == 0) {
+            opts->headless = true;
+        } else if (strcmp(arg, "--generations") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            if (parse_count(value, &number) != 0) {
+                printf("Invalid generation count: %s\n", value);
+                return -1;
+            }
+            opts->generations = number;
+        } else if (strcmp(arg, "--width") == 0 || strcmp(arg, "--height") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            if (parse_count(value, &number) != 0 || number == 0) {
+                printf("Invalid board size: %s\n", value);
+                return -1;
+            }
+            if (arg[2] == 'w') {
+                opts->width = (size_t)number;
+            } else {
+                opts->height = (size_t)number;
+            }
+        } else if (strcmp(arg, "--out") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            opts->out_filename = value;
+        } else if (strcmp(arg, "--threads") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            if (parse_count(value, &number) != 0 || number > 4096) {
+                printf("Invalid thread count: %s\n", value);
+                return -1;
+            }
+            opts->threads = (int)number;
+        } else if (strcmp(arg, "--engine") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            if (strcmp(value, "board") == 0) {
+                opts->engine = ENGINE_BOARD;
+            } else if (strcmp(value, "blocked") == 0) {
+                opts->engine = ENGINE_BLOCKED;
+            } else if (strcmp(value, "packed") == 0) {
+                opts->engine = ENGINE_PACKED;
+            } else if (strcmp(value, "hashlife") == 0) {
+                opts->engine = ENGINE_HASHLIFE;
+            } else if (strcmp(value, "sparse") == 0) {
+                opts->engine = ENGINE_SPARSE;
+            } else if (strcmp(value, "gpu") == 0) {
+                if (!gpu_board_supported()) {
+                    printf("This build has no GPU engine (rebuild with make GPU=1)\n");
+                    return -1;
+                }
+                opts->engine = ENGINE_GPU;
+            } else {
+                printf("Unknown engine: %s (expected board, blocked, packed, hashlife, sparse or gpu)\n", value);
+                return -1;
+            }
+        } else if (strcmp(arg, "--edge") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            if (strcmp(value, "dead") == 0) {
+                opts->edge = BOARD_EDGE_DEAD;
+            } else if (strcmp(value, "torus") == 0) {
+                opts->edge = BOARD_EDGE_TORUS;
+            } else {
+                printf("Unknown edge mode: %s (expected dead or torus)\n", value);
+                return -1;
+            }
+        } else if (strcmp(arg, "--cache-mb") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            if (parse_count(value, &number) != 0 || number == 0 || number > 1024 * 1024) {
+                printf("Invalid cache size: %s\n", value);
+                return -1;
+            }
+            opts->cache_mb = number;
+        } else if (strcmp(arg, "--checkpoint") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            opts->checkpoint_filename = value;
+        } else if (strcmp(arg, "--checkpoint-every") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            if (parse_count(value, &number) != 0 || number == 0) {
+                printf("Invalid checkpoint interval: %s\n", value);
+                return -1;
+            }
+            opts->checkpoint_every = number;
+        } else if (strcmp(arg, "--resume") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            opts->resume_filename = value;
+        } else if (strcmp(arg, "--speed") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            if (strcmp(value, "max") == 0) {
+                opts->speed = 0;
+            } else if (parse_count(value, &number) != 0 || number == 0 || number > MAX_SPEED) {
+                printf("Invalid speed: %s (expected 1-%d or max)\n", value, MAX_SPEED);
+                return -1;
+            } else {
+                opts->speed = number;
+            }
+        } else if (strcmp(arg, "--profile") == 0) {
+            opts->profile = true;
+        } else if (strcmp(arg, "--profile-csv") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            opts->profile = true;
+            opts->profile_csv = value;
+        } else if (strcmp(arg, "--stats") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            opts->stats_filename = value;
+        } else if (strcmp(arg, "--until-stable") == 0) {
+            opts->until_stable = true;
+        } else if (strcmp(arg, "--watch") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            if (parse_count(value, &number) != 0 || number == 0) {
+                printf("Invalid watch interval: %s\n", value);
+                return -1;
+            }
+            opts->watch = number;
+        } else if (strcmp(arg, "--watch-glyphs") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            if (strcmp(value, "braille") == 0) {
+                opts->watch_glyph = TERM_GLYPH_BRAILLE;
+            } else if (strcmp(value, "blocks") == 0) {
+                opts->watch_glyph = TERM_GLYPH_HALF_BLOCK;
+            } else {
+                printf("Unknown watch glyphs: %s (expected braille or blocks)\n", value);
+                return -1;
+            }
+        } else if (strcmp(arg, "--record") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            opts->record_filename = value;
+        } else if (strcmp(arg, "--record-every") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            if (parse_count(value, &number) != 0 || number == 0) {
+                printf("Invalid record interval: %s\n", value);
+                return -1;
+            }
+            opts->record_every = number;
+        } else if (strcmp(arg, "--record-drop") == 0) {
+            opts->record_drop = true;
+        } else if (strcmp(arg, "--batch") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            if (parse_count(value, &number) != 0 || number == 0 || number > UINT32_MAX) {
+                printf("Invalid batch size: %s\n", value);
+                return -1;
+            }
+            opts->batch = number;
+            opts->headless = true;
+        } else if (strcmp(arg, "--batch-out") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            opts->batch_filename = value;
+        } else if (strcmp(arg, "--seed") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            if (parse_count(value, &number) != 0) {
+                printf("Invalid seed: %s\n", value);
+                return -1;
+            }
+            opts->seed = number;
+            opts->seed_given = true;
+        } else if (strcmp(arg, "--density") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            char *end = NULL;
+            double density = strtod(value, &end);
+            // NaN भी यहीं reject होता है
+            if (end == value || *end != '\0' || !(density >= 0.0 && density <= 1.0)) {
+                printf("Invalid density: %s\n", value);
+                return -1;
+            }
+            opts->density = density;
+        } else if (strcmp(arg, "--domain") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            long rank = 0, count = 0;
+            const char *slash = strchr(value, '/');
+            char rank_text[16];
+            if (slash == NULL || (size_t)(slash - value) >= sizeof(rank_text)) {
+                printf("Invalid domain: %s (expected RANK/COUNT)\n", value);
+                return -1;
+            }
+            memcpy(rank_text, value, (size_t)(slash - value));
+            rank_text[slash - value] = '\0';
+            if (parse_count(rank_text, &rank) != 0 || parse_count(slash + 1, &count) != 0 ||
+                count == 0 || count > 4096 || rank >= count) {
+                printf("Invalid domain: %s (expected RANK/COUNT)\n", value);
+                return -1;
+            }
+            opts->domain_rank = (int)rank;
+            opts->domain_count = (int)count;
+            opts->headless = true;
+        } else if (strcmp(arg, "--peers") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            opts->peers = value;
+        } else if (strcmp(arg, "--halo") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            if (parse_count(value, &number) != 0 || number == 0 || number > DOMAIN_MAX_HALO) {
+                printf("Invalid halo depth: %s (expected 1-%d)\n", value, DOMAIN_MAX_HALO);
+                return -1;
+            }
+            opts->halo = number;
+        } else if (strcmp(arg, "--rule") == 0) {
+            if (!(value = option_value(argc, argv, &i))) return -1;
+            opts->rule_name = value;
+        } else if (arg[0] == '-' && arg[1] == '-') {
+            printf("Unknown option: %s\n", arg);
+            return -1;
+        } else if (opts->filename == NULL) {
+            opts->filename = arg;
+        } else {
+            printf("Unexpected argument: %s\n", arg);
+            return -1;
+        }
+    }
+
+    if (opts->edge == BOARD_EDGE_TORUS && opts->engine != ENGINE_BOARD && opts->engine != ENGINE_BLOCKED) {
+        printf("--edge torus is only supported by the board and blocked engines\n");
+        return -1;
+    }
+
+    // Checkpoint में सिर्फ board window आती है; unbounded plane के बाहर के cells खो जाते
+    if ((opts->checkpoint_filename || opts->resume_filename) &&
+        (opts->engine == ENGINE_HASHLIFE || opts->engine == ENGINE_SPARSE)) {
+        printf("--checkpoint and --resume are not supported by the hashlife and sparse engines\n");
+        return -1;
+    }
+
+    if (opts->stats_filename && opts->engine != ENGINE_BOARD) {
+        printf("--stats is only supported by the board engine\n");
+        return -1;
+    }
+
+    if (opts->until_stable && opts->engine != ENGINE_BOARD) {
+        printf("--until-stable is only supported by the board engine\n");
+        return -1;
+    }
+
+    if (opts->watch > 0 && (opts->engine != ENGINE_BOARD || !opts->headless)) {
+        printf("--watch is only supported by headless runs of the board engine\n");
+        return -1;
+    }
+
+    if (opts->record_filename && opts->headless && opts->engine != ENGINE_BOARD) {
+        printf("--record in headless mode is only supported by the board engine\n");
+        return -1;
+    } else if (!opts->record_filename && (opts->record_every != 1 || opts->record_drop)) {
+        printf("--record-every and --record-drop require --record FILE\n");
+        return -1;
+    }
+
+    if (opts->batch > 0) {
+        if (opts->engine != ENGINE_BOARD) {
+            printf("--batch is only supported by the board engine\n");
+            return -1;
+        }
+        if (opts->batch_filename == NULL) {
+            printf("--batch requires --batch-out FILE\n");
+            return -1;
+        }
+        if (opts->filename || opts->resume_filename || opts->checkpoint_filename || opts->stats_filename ||
+            opts->watch > 0 || opts->record_filename) {
+            printf("--batch cannot be combined with a pattern file, --resume, --checkpoint, --stats,\n"
+                   "--watch or --record\n");
+            return -1;
+        }
+    } else if (opts->batch_filename) {
+        printf("--batch-out requires --batch N\n");
+        return -1;
+    }
+
+    if (opts->domain_count > 0) {
+        if (opts->engine != ENGINE_PACKED) {
+            printf("--domain requires --engine packed\n");
+            return -1;
+        }
+        if (opts->peers == NULL) {
+            printf("--domain requires --peers HOST:PORT,...\n");
+            return -1;
+        }
+        if (opts->resume_filename || opts->batch > 0) {
+            printf("--domain cannot be combined with --resume or --batch\n");
+            return -1;
+        }
+    } else if (opts->peers || opts->halo != DOMAIN_DEFAULT_HALO) {
+        printf("--peers and --halo require --domain RANK/COUNT\n");
+        return -1;
+    }
+
+    if (opts->resume_filename && opts->filename) {
+        printf("--resume cannot be combined with a pattern file\n");
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief options और pattern file से final बोर्ड dimensions तय करता है
+ *
+ * Pattern file पढ़ी नहीं जा सके तो उसे ignore किया जाता है (caller बाद में
+ * load करते समय error report करता है)। --resume के checkpoint का size
+ * --width/--height से भी ऊपर है, क्योंकि board_load को exact size चाहिए।
+ *
+ * @param opts parsed options
+ * @param height final ऊंचाई store करने के लिए pointer
+ * @param width final चौड़ाई store करने के लिए pointer
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int options_board_size(const Options *opts, size_t *height, size_t *width) {
+    if (!opts || !height || !width) return -1;
+
+    CheckpointInfo info;
+    if (opts->resume_filename && checkpoint_read_info(opts->resume_filename, &info) == 0) {
+        *height = info.height;
+        *width = info.width;
+        return 0;
+    }
+
+    size_t file_height = 0, file_width = 0;
+    if (opts->filename && (opts->height == 0 || opts->width == 0)) {
+        if (board_file_dimensions(opts->filename, &file_height, &file_width) != 0) {
+            file_height = file_width = 0;
+        }
+    }
+
+    *height = opts->height ? opts->height : (file_height ? file_height : DEFAULT_BOARD_SIZE);
+    *width = opts->width ? opts->width : (file_width ? file_width : DEFAULT_BOARD_SIZE);
+    return 0;
+}
+
+/**
+ * @brief सभी options का usage text print करता है
+ *
+ * @param program program का नाम (argv[0])
+ */
+void options_print_usage(const char *program) {
+    printf("Usage: %s [options] [pattern-file]\n", program ? program : "gameoflife");
+    printf("Options:\n");
+    printf("  -h, --help          Show this help\n");
+    printf("  --width N           Board width in cells (default: pattern file or %d)\n", DEFAULT_BOARD_SIZE);
+    printf("  --height N          Board height in cells (default: pattern file or %d)\n", DEFAULT_BOARD_SIZE);
+    printf("  --headless          Run without a window, as fast as possible\n");
+    printf("  --generations N     Generations to run in headless mode (default 1000;\n");
+    printf("                      with --resume this counts from generation 0)\n");
+    printf("  --out FILE          Write the final board to FILE (headless mode)\n");
+    printf("  --threads N         Worker threads, 0 = all cores (default 0)\n");
+    printf("  --engine NAME       Stepping engine: board, blocked (headless only, several\n");
+    printf("                      generations per pass over large boards), packed\n");
+    printf("                      (headless only), hashlife, sparse or gpu (headless only,\n");
+    printf("                      GPU=1 builds); default board; hashlife and sparse run on\n");
+    printf("                      an unbounded plane and the board is a window onto it\n");
+    printf("  --edge MODE         Board edges: dead or torus (wraparound, board and blocked\n");
+    printf("                      engines only)\n");
+    printf("  --cache-mb N        Hashlife node cache limit in MB (default %d)\n", DEFAULT_CACHE_MB);
+    printf("  --rule NAME         Rule set: conway, highlife, daynight, maze or a rule string\n");
+    printf("                      such as B36/S23, 23/3, B2-a/S12 (Hensel) or B2/S/C3\n");
+    printf("                      (Generations); with --batch a comma-separated list\n");
+    printf("  --checkpoint FILE   Periodically save a binary checkpoint to FILE (not with\n");
+    printf("                      --engine hashlife or sparse, whose plane is larger than\n");
+    printf("                      the board)\n");
+    printf("  --checkpoint-every N\n");
+    printf("                      Generations between checkpoints (default %d)\n", DEFAULT_CHECKPOINT_EVERY);
+    printf("  --resume FILE       Restore board, rules and generation from a checkpoint\n");
+    printf("                      (not with --engine hashlife or sparse)\n");
+    printf("  --speed N|max       Generations per second in the window (default %d;\n", DEFAULT_SPEED);
+    printf("                      max = as many as fit in each frame)\n");
+    printf("  --profile           Time each main loop phase and show it in the title bar\n");
+    printf("  --profile-csv FILE  Profile and write per-frame timings to FILE on exit\n");
+    printf("  --stats FILE        Write population, births, deaths and bounding box per\n");
+    printf("                      generation to FILE as CSV (headless, board engine only)\n");
+    printf("  --until-stable      Stop a headless run once the board repeats a recent\n");
+    printf("                      state (still life or period <= %d, board engine only)\n", CYCLE_DEFAULT_WINDOW);
+    printf("  --watch N           Redraw a downsampled view of the board in the terminal\n");
+    printf("                      every N generations, sending only changed characters\n");
+    printf("                      (headless, board engine only)\n");
+    printf("  --watch-glyphs NAME braille (2x4 cells per character, default) or blocks\n");
+    printf("                      (half blocks, 1x2 cells) for --watch\n");
+    printf("  --record FILE       Record generations to FILE on a background thread: a .y4m\n");
+    printf("                      grayscale video, or otherwise a compact XOR delta stream\n");
+    printf("                      (headless: board engine only)\n");
+    printf("  --record-every K    Record every K-th generation (default 1)\n");
+    printf("  --record-drop       Drop frames when the encoder falls behind instead of\n");
+    printf("                      pausing the simulation\n");
+    printf("  --batch N           Run N random boards per rule in one process and collect\n");
+    printf("                      final population and stabilization per board (headless,\n");
+    printf("                      board engine only; with --until-stable boards stop early)\n");
+    printf("  --batch-out FILE    Write batch results to FILE as CSV (required with --batch)\n");
+    printf("  --seed N            Seed of the random board, identical for any thread count\n");
+    printf("                      (default: the current time; 1 for --batch and --domain);\n");
+    printf("                      batch boards use N, N+1, N+2, ... per rule\n");
+    printf("  --density P         Fraction of live cells in random boards, 0 to 1 (default %.1f)\n",
+           RNG_DEFAULT_DENSITY);
+    printf("  --domain R/N        Run as rank R of N processes, each owning a strip of rows\n");
+    printf("                      (headless, packed engine); --out and --checkpoint write\n");
+    printf("                      one file per rank, FILE.R\n");
+    printf("  --peers LIST        host:port of every rank in rank order, comma-separated\n");
+    printf("  --halo K            Exchange K-row halos every K generations (default %d,\n", DOMAIN_DEFAULT_HALO);
+    printf("                      at most %d)\n", DOMAIN_MAX_HALO);
+}
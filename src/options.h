@@ -0,0 +1,118 @@
+/**
+ * @file options.h
+ * @brief Command line options parsing का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * यह फाइल SDL version और headless version दोनों के लिए common
+ * command line options define करती है। इसमें SDL पर कोई dependency नहीं है।
+ */
+
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+#include <stddef.h>
+#include "board.h"
+#include "state.h"
+#include "term.h"
+
+/**
+ * @brief बोर्ड की default ऊंचाई और चौड़ाई
+ */
+#define DEFAULT_BOARD_SIZE 64
+
+/**
+ * @brief Hashlife node cache की default limit (MB)
+ */
+#define DEFAULT_CACHE_MB 256
+
+/**
+ * @brief Periodic checkpoints के बीच default generations
+ */
+#define DEFAULT_CHECKPOINT_EVERY 1000
+
+/**
+ * @brief Stepping engine का प्रकार
+ */
+typedef enum EngineKind {
+    ENGINE_BOARD = 0,   /**< Byte-per-cell Board (board_next_parallel) */
+    ENGINE_PACKED,      /**< Bit-packed PackedBoard (packed_board_next_parallel) */
+    ENGINE_HASHLIFE,    /**< Hashlife quadtree (hashlife_step, unbounded plane) */
+    ENGINE_SPARSE,      /**< Chunked SparseBoard (sparse_board_next, unbounded plane) */
+    ENGINE_GPU,         /**< OpenGL compute shaders (gpu_board_next, GPU=1 builds) */
+    ENGINE_BLOCKED      /**< Byte-per-cell Board, कई generations प्रति pass (board_step_n_parallel) */
+} EngineKind;
+
+/**
+ * @brief Parse किए गए command line options
+ */
+typedef struct Options {
+    const char *filename;       /**< Pattern file (NULL = random board) */
+    size_t width;               /**< बोर्ड की चौड़ाई (0 = pattern file से या default) */
+    size_t height;              /**< बोर्ड की ऊंचाई (0 = pattern file से या default) */
+    bool8 headless;             /**< SDL window के बिना batch mode */
+    long generations;           /**< Headless mode में कितनी generations चलानी हैं */
+    const char *out_filename;   /**< Headless run के बाद final board यहाँ लिखें (NULL = न लिखें) */
+    int threads;                /**< Worker threads (0 = सभी CPU cores) */
+    EngineKind engine;          /**< Stepping engine */
+    const char *rule_name;      /**< Initial rule set का नाम (NULL = Conway) */
+    long cache_mb;              /**< Hashlife node cache की memory limit (MB) */
+    BoardEdge edge;             /**< बोर्ड के किनारे: dead या torus (सिर्फ board और blocked engines) */
+    const char *checkpoint_filename; /**< Periodic checkpoints यहाँ लिखें (NULL = checkpoint नहीं) */
+    long checkpoint_every;      /**< कितनी generations के बाद checkpoint लिखना है */
+    const char *resume_filename; /**< इस checkpoint से बोर्ड, rules और generation restore करें */
+    long speed;                 /**< Initial simulation speed, generations/second (0 = max) */
+    bool8 profile;              /**< Main loop के phases time करें और window title में दिखाएं */
+    const char *profile_csv;    /**< Exit पर per-frame timings यहाँ लिखें (NULL = न लिखें) */
+    const char *stats_filename; /**< Headless run में हर generation के statistics यहाँ लिखें (CSV, सिर्फ board engine) */
+    bool8 until_stable;         /**< Headless run को still life या oscillator मिलते ही रोकें (सिर्फ board engine) */
+    long watch;                 /**< Headless run में हर कितनी generations पर terminal view बदले (0 = view नहीं, सिर्फ board engine) */
+    TermGlyph watch_glyph;      /**< Terminal view के glyphs: braille या half blocks */
+    const char *record_filename; /**< Generations इस file में record करें (".y4m" = video, बाकी delta stream; NULL = नहीं) */
+    long record_every;          /**< हर कितनी generations पर एक recorded frame */
+    bool8 record_drop;          /**< Encoder पीछे हो तो frames छोड़ें (वरना stepping रुकती है) */
+    long batch;                 /**< हर rule के लिए कितने independent random boards चलाने हैं (0 = batch mode नहीं) */
+    const char *batch_filename; /**< Batch results यहाँ लिखें (CSV, --batch के साथ जरूरी) */
+    long seed;                  /**< Random board का seed; batch में पहले board का (बाकी seed + 1, seed + 2, ...) */
+    bool8 seed_given;           /**< --seed दिया गया है (वरना single random boards time से seed होते हैं) */
+    double density;             /**< Random boards में जीवित cells का fraction */
+    int domain_rank;            /**< Distributed run में इस process का rank */
+    int domain_count;           /**< Distributed run के कुल processes (0 = distributed नहीं) */
+    const char *peers;          /**< हर rank का "host:port", comma-separated (--domain के साथ जरूरी) */
+    long halo;                  /**< Halo depth: हर कितनी generations में halo exchange */
+    bool8 show_help;            /**< --help दिया गया है (usage print करके exit करें) */
+} Options;
+
+/**
+ * @brief command line arguments को parse करता है
+ *
+ * Unknown option या गलत value होने पर error message print होता है।
+ *
+ * @param argc arguments की संख्या
+ * @param argv arguments का array
+ * @param opts parsed options store करने के लिए pointer
+ * @return सफल होने पर 0, invalid arguments होने पर -1
+ */
+int options_parse(int argc, char **argv, Options *opts);
+
+/**
+ * @brief options और pattern file से final बोर्ड dimensions तय करता है
+ *
+ * Priority: command line (--width/--height) > pattern file का size >
+ * DEFAULT_BOARD_SIZE। --resume देने पर size हमेशा checkpoint से आता है। अगर सिर्फ एक dimension दी गई है तो दूसरी file
+ * या default से ली जाती है।
+ *
+ * @param opts parsed options
+ * @param height final ऊंचाई store करने के लिए pointer
+ * @param width final चौड़ाई store करने के लिए pointer
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int options_board_size(const Options *opts, size_t *height, size_t *width);
+
+/**
+ * @brief सभी options का usage text print करता है
+ * @param program program का नाम (argv[0])
+ */
+void options_print_usage(const char *program);
+
+#endif // OPTIONS_H
@@ -0,0 +1,418 @@
+/**
+ * @file packed_board.c
+ * @brief Bit-packed बोर्ड और bit-sliced stepping kernel का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * हर word के 64 cells के neighbor counts को full-adder logic से एक साथ
+ * 4 bit-planes (1, 2, 4, 8) में calculate किया जाता है। फिर Rules के
+ * birth/survival masks को इन bit-planes पर boolean expressions के रूप में
+ * apply किया जाता है।
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "packed_board.h"
+
+/**
+ * @brief last word का valid bits mask return करता है
+ * @param width बोर्ड की चौड़ाई
+ * @return width के अंदर वाले bits set वाला mask
+ */
+static uint64_t tail_mask(size_t width) {
+    size_t rem = width % PACKED_WORD_BITS;
+    return rem == 0 ? ~(uint64_t)0 : (((uint64_t)1 << rem) - 1);
+}
+
+/**
+ * @brief नया packed बोर्ड initialize करता है और memory allocate करता है
+ *
+ * @param height बोर्ड की ऊंचाई (rows की संख्या)
+ * @param width बोर्ड की चौड़ाई (columns की संख्या)
+ * @return सफल होने पर PackedBoard pointer, memory allocation fail होने पर NULL
+ */
+PackedBoard *packed_board_init(size_t height, size_t width) {
+    PackedBoard *board = malloc(sizeof(PackedBoard));
+    if (!board) {
+        return NULL;
+    }
+
+    board->height = height;
+    board->width = width;
+    board->words_per_row = (width + PACKED_WORD_BITS - 1) / PACKED_WORD_BITS;
+    board->arena = NULL;
+
+    // सभी words को zero (मृत) state में initialize करें
+    board->words = calloc(board->words_per_row * height, sizeof(uint64_t));
+    if (!board->words && board->words_per_row * height > 0) {
+        free(board);
+        return NULL;
+    }
+
+    return board;
+}
+
+/**
+ * @brief packed_board_init_arena के एक बोर्ड को arena में चाहिए bytes
+ *
+ * @param height बोर्ड की ऊंचाई (rows की संख्या)
+ * @param width बोर्ड की चौड़ाई (columns की संख्या)
+ * @return arena capacity में जोड़ने वाले bytes
+ */
+size_t packed_board_arena_size(size_t height, size_t width) {
+    size_t words_per_row = (width + PACKED_WORD_BITS - 1) / PACKED_WORD_BITS;
+    return ARENA_SIZE(sizeof(PackedBoard)) + ARENA_SIZE(words_per_row * height * sizeof(uint64_t));
+}
+
+/**
+ * @brief arena में नया packed बोर्ड बनाता है (सभी cells मृत)
+ *
+ * Rows cache line aligned words से शुरू होते हैं। Memory arena_free के
+ * साथ जाती है; packed_board_free इस पर कुछ नहीं करता।
+ *
+ * @param arena source arena (कम से कम packed_board_arena_size bytes खाली)
+ * @param height बोर्ड की ऊंचाई (rows की संख्या)
+ * @param width बोर्ड की चौड़ाई (columns की संख्या)
+ * @return सफल होने पर PackedBoard pointer, NULL arena या arena भर जाने पर NULL
+ */
+PackedBoard *packed_board_init_arena(Arena *arena, size_t height, size_t width) {
+    PackedBoard *board = arena_alloc(arena, sizeof(PackedBoard));
+    if (!board) {
+        return NULL;
+    }
+
+    board->height = height;
+    board->width = width;
+    board->words_per_row = (width + PACKED_WORD_BITS - 1) / PACKED_WORD_BITS;
+    board->arena = arena;
+    board->words = arena_alloc(arena, board->words_per_row * height * sizeof(uint64_t));
+    return board->words != NULL ? board : NULL;
+}
+
+/**
+ * @brief packed बोर्ड की सारी allocated memory को free करता है
+ *
+ * @param board free करने वाला बोर्ड
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int packed_board_free(PackedBoard *board) {
+    if (board == NULL) return -1;
+    if (board->arena != NULL) return 0;
+
+    free(board->words);
+    free(board);
+
+    return 0;
+}
+
+/**
+ * @brief packed बोर्ड के सभी cells को clear करता है
+ *
+ * @param board clear करने वाला बोर्ड
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int packed_board_clear(PackedBoard *board) {
+    if (board == NULL) return -1;
+
+    memset(board->words, 0, board->words_per_row * board->height * sizeof(uint64_t));
+    return 0;
+}
+
+/**
+ * @brief एक cell की value पढ़ता है
+ *
+ * @param board source बोर्ड
+ * @param x row
+ * @param y column
+ * @return cell जीवित है तो 1, मृत या out of bounds है तो 0
+ */
+int packed_board_get(const PackedBoard *board, size_t x, size_t y) {
+    if (board == NULL || x >= board->height || y >= board->width) return 0;
+
+    uint64_t word = board->words[x * board->words_per_row + y / PACKED_WORD_BITS];
+    return (word >> (y % PACKED_WORD_BITS)) & 1;
+}
+
+/**
+ * @brief एक cell की value set करता है
+ *
+ * @param board target बोर्ड
+ * @param x row
+ * @param y column
+ * @param alive नई value (0=मृत, non-zero=जीवित)
+ * @return सफल होने पर 0, out of bounds होने पर -1
+ */
+int packed_board_set(PackedBoard *board, size_t x, size_t y, int alive) {
+    if (board == NULL || x >= board->height || y >= board->width) return -1;
+
+    uint64_t *word = &board->words[x * board->words_per_row + y / PACKED_WORD_BITS];
+    uint64_t bit = (uint64_t)1 << (y % PACKED_WORD_BITS);
+    if (alive) {
+        *word |= bit;
+    } else {
+        *word &= ~bit;
+    }
+    return 0;
+}
+
+/**
+ * @brief byte-per-cell Board से packed बोर्ड में convert करता है
+ *
+ * हर 64 cells को एक word में pack किया जाता है। Last word के extra bits
+ * 0 रहते हैं। Little-endian machines पर पूरे words 8 bytes एक साथ pack
+ * होते हैं: हर nonzero byte का high bit बनता है और एक multiply उन आठ bits
+ * को एक byte में इकट्ठा करता है (cell j का bit j पर)।
+ *
+ * @param dst target packed बोर्ड
+ * @param src source Board
+ * @return सफल होने पर 0, NULL pointer या dimensions mismatch होने पर -1
+ */
+int packed_board_from_board(PackedBoard *dst, const Board *src) {
+    if (dst == NULL || src == NULL) return -1;
+    if (dst->height != src->height || dst->width != src->width) return -1;
+
+    const uint64_t low7 = 0x7f7f7f7f7f7f7f7fULL, gather = 0x0102040810204080ULL;
+    for (size_t x = 0; x < src->height; x++) {
+        const char *row = &src->cells[BOARD_INDEX(src, x, 0)];
+        uint64_t *out = &dst->words[x * dst->words_per_row];
+
+        for (size_t w = 0; w < dst->words_per_row; w++) {
+            size_t base = w * PACKED_WORD_BITS;
+            size_t count = src->width - base < PACKED_WORD_BITS ? src->width - base : PACKED_WORD_BITS;
+            uint64_t word = 0;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            if (count == PACKED_WORD_BITS) {
+                for (size_t j = 0; j < PACKED_WORD_BITS; j += 8) {
+                    uint64_t bytes;
+                    memcpy(&bytes, &row[base + j], sizeof(bytes));
+                    uint64_t nonzero = (((bytes & low7) + low7) | bytes) & ~low7;
+                    word |= ((nonzero >> 7) * gather >> 56) << j;
+                }
+                out[w] = word;
+                continue;
+            }
+#endif
+            for (size_t j = 0; j < count; j++) {
+                word |= (uint64_t)(row[base + j] != 0) << j;
+            }
+            out[w] = word;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief packed बोर्ड को byte-per-cell Board में convert करता है
+ *
+ * @param src source packed बोर्ड
+ * @param dst target Board
+ * @return सफल होने पर 0, NULL pointer या dimensions mismatch होने पर -1
+ */
+int packed_board_to_board(const PackedBoard *src, Board *dst) {
+    if (dst == NULL || src == NULL) return -1;
+    if (dst->height != src->height || dst->width != src->width) return -1;
+
+    for (size_t x = 0; x < src->height; x++) {
+        const uint64_t *in = &src->words[x * src->words_per_row];
+        char *row = &dst->cells[BOARD_INDEX(dst, x, 0)];
+
+        for (size_t y = 0; y < src->width; y++) {
+            row[y] = (in[y / PACKED_WORD_BITS] >> (y % PACKED_WORD_BITS)) & 1;
+        }
+    }
+
+    board_mark_all_dirty(dst);
+    return 0;
+}
+
+/**
+ * @brief rows की एक range का stepping loop, एक fixed preset के लिए
+ *
+ * हमेशा inline होता है और callers preset constant देते हैं, इसलिए हर
+ * preset का अपना loop बनता है और rule का switch word loop से बाहर रहता है।
+ *
+ * @param board current generation का बोर्ड
+ * @param out next generation store करने के लिए output बोर्ड
+ * @param rules apply करने वाले game rules
+ * @param preset rules का preset (constant)
+ * @param row_begin पहली row (inclusive)
+ * @param row_end आखिरी row (exclusive, height तक clamp किया हुआ)
+ */
+PACKED_INLINE void packed_rows_preset(const PackedBoard *board, PackedBoard *out, const Rules *rules,
+                                      RulesPreset preset, size_t row_begin, size_t row_end) {
+    // सिर्फ वही counts check करें जो किसी rule में active हैं
+    int counts[MAX_NEIGHBORS + 1];
+    int num_counts = packed_active_counts(rules, counts);
+
+    const size_t wpr = board->words_per_row;
+    const uint64_t last_mask = tail_mask(board->width);
+
+    for (size_t x = row_begin; x < row_end; x++) {
+        const uint64_t *mid = &board->words[x * wpr];
+        const uint64_t *up = x > 0 ? mid - wpr : NULL;
+        const uint64_t *down = x + 1 < board->height ? mid + wpr : NULL;
+        uint64_t *dst = &out->words[x * wpr];
+
+        // Sliding window: हर word के लिए सिर्फ अगला word load होता है।
+        // बोर्ड के बाहर की rows/words को 0 माना जाता है।
+        uint64_t u_prev = 0, m_prev = 0, d_prev = 0;
+        uint64_t u = up ? up[0] : 0, m = mid[0], d = down ? down[0] : 0;
+
+        for (size_t w = 0; w < wpr; w++) {
+            int has_next = w + 1 < wpr;
+            uint64_t u_next = (up && has_next) ? up[w + 1] : 0;
+            uint64_t m_next = has_next ? mid[w + 1] : 0;
+            uint64_t d_next = (down && has_next) ? down[w + 1] : 0;
+
+            uint64_t next = packed_next_word(u_prev, u, u_next, m_prev, m, m_next, d_prev, d, d_next,
+                                             preset, counts, num_counts,
+                                             rules->birth_rules, rules->survival_rules);
+
+            // width के बाहर के bits हमेशा मृत रहें
+            if (w + 1 == wpr) next &= last_mask;
+            dst[w] = next;
+
+            u_prev = u; u = u_next;
+            m_prev = m; m = m_next;
+            d_prev = d; d = d_next;
+        }
+    }
+}
+
+/**
+ * @brief rows की एक range के लिए bit-sliced kernel से next generation compute करता है
+ *
+ * हर word के लिए ऊपर, current और नीचे की rows के words और उनके
+ * left/right shifted versions (adjacent words के carry bits के साथ) से
+ * आठ neighbor inputs बनते हैं। इन्हें adder tree से sum किया जाता है।
+ * बोर्ड के बाहर की cells मृत मानी जाती हैं। Built-in rule sets
+ * (rules->preset) के लिए compile time पर specialized loops हैं; बाकी
+ * rules generic masks वाले loop से चलते हैं।
+ *
+ * @param board current generation का बोर्ड
+ * @param out next generation store करने के लिए output बोर्ड
+ * @param rules apply करने वाले game rules
+ * @param row_begin पहली row (inclusive)
+ * @param row_end आखिरी row (exclusive)
+ * @return सफल होने पर 0, error होने पर -1
+ */
+int packed_board_next_rows(PackedBoard *board, PackedBoard *out, Rules *rules,
+                           size_t row_begin, size_t row_end) {
+    if (board == NULL || out == NULL || rules == NULL) return -1;
+    if (board->width != out->width || board->height != out->height) return -1;
+    if (rules->kernel != RULES_KERNEL_TOTALISTIC) return -1;
+    if (row_end > board->height) row_end = board->height;
+    if (board->words_per_row == 0) return 0;
+
+    switch (rules->preset) {
+        case RULES_PRESET_CONWAY:
+            packed_rows_preset(board, out, rules, RULES_PRESET_CONWAY, row_begin, row_end);
+            break;
+        case RULES_PRESET_HIGHLIFE:
+            packed_rows_preset(board, out, rules, RULES_PRESET_HIGHLIFE, row_begin, row_end);
+            break;
+        case RULES_PRESET_DAY_NIGHT:
+            packed_rows_preset(board, out, rules, RULES_PRESET_DAY_NIGHT, row_begin, row_end);
+            break;
+        case RULES_PRESET_MAZE:
+            packed_rows_preset(board, out, rules, RULES_PRESET_MAZE, row_begin, row_end);
+            break;
+        default:
+            packed_rows_preset(board, out, rules, RULES_PRESET_NONE, row_begin, row_end);
+            break;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief specified rules का उपयोग करके अगली generation का packed बोर्ड generate करता है
+ *
+ * @param board current generation का बोर्ड
+ * @param out next generation store करने के लिए output बोर्ड
+ * @param rules apply करने वाले game rules
+ * @return सफल होने पर 0, error होने पर -1
+ */
+int packed_board_next(PackedBoard *board, PackedBoard *out, Rules *rules) {
+    if (board == NULL) return -1;
+    return packed_board_next_rows(board, out, rules, 0, board->height);
+}
+
+/**
+ * @brief हर worker को कम से कम इतनी rows मिलें
+ */
+#define PARALLEL_MIN_ROWS 16
+
+/**
+ * @brief packed_board_next_parallel के workers के लिए shared arguments
+ */
+typedef struct PackedNextTask {
+    PackedBoard *board;
+    PackedBoard *out;
+    Rules *rules;
+    int num_bands;
+} PackedNextTask;
+
+/**
+ * @brief एक worker अपने row band की next generation compute करता है
+ * @param arg PackedNextTask pointer
+ * @param worker_index worker का index
+ * @param num_workers कुल workers (unused)
+ */
+static void packed_next_task(void *arg, int worker_index, int num_workers) {
+    (void)num_workers;
+    PackedNextTask *task = arg;
+    if (worker_index >= task->num_bands) return;
+
+    size_t height = task->board->height;
+    size_t begin = height * (size_t)worker_index / (size_t)task->num_bands;
+    size_t end = height * (size_t)(worker_index + 1) / (size_t)task->num_bands;
+    packed_board_next_rows(task->board, task->out, task->rules, begin, end);
+}
+
+/**
+ * @brief thread pool पर row bands में बांटकर अगली generation generate करता है
+ *
+ * board_next_parallel की तरह: एक band प्रति worker, और हर band में कम से कम
+ * PARALLEL_MIN_ROWS rows।
+ *
+ * @param board current generation का बोर्ड
+ * @param out next generation store करने के लिए output बोर्ड
+ * @param rules apply करने वाले game rules
+ * @param pool persistent thread pool (NULL होने पर single-threaded)
+ * @return सफल होने पर 0, error होने पर -1
+ */
+int packed_board_next_parallel(PackedBoard *board, PackedBoard *out, Rules *rules, ThreadPool *pool) {
+    if (board == NULL || out == NULL || rules == NULL) return -1;
+    if (board->width != out->width || board->height != out->height) return -1;
+    if (rules->kernel != RULES_KERNEL_TOTALISTIC) return -1;
+
+    int num_bands = pool_size(pool);
+    size_t max_bands = board->height / PARALLEL_MIN_ROWS;
+    if ((size_t)num_bands > max_bands) num_bands = max_bands > 0 ? (int)max_bands : 1;
+
+    if (pool == NULL || num_bands <= 1) {
+        return packed_board_next_rows(board, out, rules, 0, board->height);
+    }
+
+    PackedNextTask task = { board, out, rules, num_bands };
+    return pool_run(pool, packed_next_task, &task);
+}
+
+/**
+ * @brief बोर्ड में जीवित cells की संख्या return करता है
+ *
+ * @param board source बोर्ड
+ * @return जीवित cells की संख्या
+ */
+size_t packed_board_population(const PackedBoard *board) {
+    if (board == NULL) return 0;
+
+    size_t population = 0;
+    for (size_t i = 0; i < board->words_per_row * board->height; i++) {
+        population += (size_t)__builtin_popcountll(board->words[i]);
+    }
+    return population;
+}
@@ -0,0 +1,586 @@
+/**
+ * @file pattern.c
+ * @brief Pattern files (plain text, RLE, Macrocell) के loader का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * पूरी file एक buffer में आती है (regular files mmap होती हैं, बाकी
+ * PATTERN_READ_CHUNK के chunks में पढ़ी जाती हैं), इसलिए parsing में per
+ * character कोई I/O call नहीं होती। Plain text rows सीधे बोर्ड की rows में
+ * convert होती हैं और बची हुई cells उसी pass में clear होती हैं।
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "pattern.h"
+
+/**
+ * @brief mmap न हो सके तब read का chunk size (bytes)
+ */
+#define PATTERN_READ_CHUNK ((size_t)1 << 20)
+
+/**
+ * @brief Macrocell leaf (8x8) का level
+ */
+#define MACROCELL_LEAF_LEVEL 3
+
+/**
+ * @brief Macrocell का maximum level (coordinates int64_t में fit रहें)
+ */
+#define MACROCELL_MAX_LEVEL 60
+
+/**
+ * @brief Memory में loaded pattern file
+ */
+typedef struct PatternFile {
+    const char *data;   /**< File का content */
+    size_t size;        /**< Content का size */
+    void *map;          /**< mmap की गई memory (NULL = mmap नहीं हुई) */
+    char *buffer;       /**< Chunks में पढ़ी गई memory (NULL = use नहीं हुई) */
+} PatternFile;
+
+/**
+ * @brief file को memory में लाता है (पहले mmap, नहीं तो chunked read)
+ * @param filename file का नाम
+ * @param file result store करने के लिए pointer
+ * @return सफल होने पर 0, file error होने पर -1
+ */
+static int pattern_open(const char *filename, PatternFile *file) {
+    file->data = "";
+    file->size = 0;
+    file->map = NULL;
+    file->buffer = NULL;
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return -1;
+
+    struct stat info;
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+        if (info.st_size == 0) {
+            close(fd);
+            return 0;
+        }
+        void *map = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+            posix_madvise(map, (size_t)info.st_size, POSIX_MADV_SEQUENTIAL);
+            close(fd);
+            file->map = map;
+            file->data = map;
+            file->size = (size_t)info.st_size;
+            return 0;
+        }
+    }
+
+    // Pipes या mmap न होने वाली files: बड़े chunks में पढ़ें
+    size_t capacity = 0, size = 0;
+    char *buffer = NULL;
+    for (;;) {
+        if (capacity - size < PATTERN_READ_CHUNK) {
+            char *grown = realloc(buffer, capacity + PATTERN_READ_CHUNK);
+            if (!grown) {
+                free(buffer);
+                close(fd);
+                return -1;
+            }
+            buffer = grown;
+            capacity += PATTERN_READ_CHUNK;
+        }
+        ssize_t n = read(fd, buffer + size, capacity - size);
+        if (n < 0) {
+            free(buffer);
+            close(fd);
+            return -1;
+        }
+        if (n == 0) break;
+        size += (size_t)n;
+    }
+    close(fd);
+
+    file->buffer = buffer;
+    file->data = buffer ? buffer : "";
+    file->size = size;
+    return 0;
+}
+
+/**
+ * @brief pattern_open की memory release करता है
+ * @param file loaded file
+ */
+static void pattern_close(PatternFile *file) {
+    if (file->map) munmap(file->map, file->size);
+    free(file->buffer);
+}
+
+/**
+ * @brief अगली line return करता है ('\n' और आखिरी '\r' के बिना)
+ * @param pos current position (अगली line पर move होता है)
+ * @param end content का अंत
+ * @param len line की length store करने के लिए pointer
+ * @return line की शुरुआत, content खत्म होने पर NULL
+ */
+static const char *next_line(const char **pos, const char *end, size_t *len) {
+    if (*pos >= end) return NULL;
+
+    const char *line = *pos;
+    const char *newline = memchr(line, '\n', (size_t)(end - line));
+    const char *line_end = newline ? newline : end;
+    *pos = newline ? newline + 1 : end;
+
+    if (line_end > line && line_end[-1] == '\r') line_end--;
+    *len = (size_t)(line_end - line);
+    return line;
+}
+
+/**
+ * @brief file के content से उसका format पहचानता है
+ * @param data file का content
+ * @param size content का size bytes में
+ * @return format
+ */
+PatternFormat pattern_detect(const char *data, size_t size) {
+    if (data == NULL) return PATTERN_PLAIN;
+    if (size >= 4 && memcmp(data, "[M2]", 4) == 0) return PATTERN_MACROCELL;
+
+    const char *pos = data, *end = data + size;
+    const char *line;
+    size_t len;
+    while ((line = next_line(&pos, end, &len)) != NULL) {
+        if (len > 0 && line[0] == '#') continue;
+
+        // पहली non-comment line: "x = ..." हो तो RLE
+        size_t i = 0;
+        while (i < len && (line[i] == ' ' || line[i] == '\t')) i++;
+        if (i < len && line[i] == 'x') {
+            i++;
+            while (i < len && (line[i] == ' ' || line[i] == '\t')) i++;
+            if (i < len && line[i] == '=') return PATTERN_RLE;
+        }
+        return PATTERN_PLAIN;
+    }
+    return PATTERN_PLAIN;
+}
+
+/**
+ * @brief Plain text pattern का size
+ * @param data file का content
+ * @param size content का size
+ * @param height lines की संख्या
+ * @param width सबसे लंबी line की length
+ */
+static void plain_dimensions(const char *data, size_t size, size_t *height, size_t *width) {
+    const char *pos = data, *end = data + size;
+    size_t rows = 0, columns = 0, len;
+    while (next_line(&pos, end, &len) != NULL) {
+        rows++;
+        if (len > columns) columns = len;
+    }
+    *height = rows;
+    *width = columns;
+}
+
+/**
+ * @brief Plain text pattern को बोर्ड में convert करता है
+ *
+ * हर line सीधे बोर्ड की row में लिखी जाती है और row का बचा हिस्सा उसी
+ * समय clear होता है, इसलिए पहले पूरा बोर्ड clear नहीं करना पड़ता।
+ *
+ * @param data file का content
+ * @param size content का size
+ * @param board target बोर्ड
+ */
+static void plain_load(const char *data, size_t size, Board *board) {
+    const char *pos = data, *end = data + size;
+    const char *line;
+    size_t x = 0, len;
+
+    while (x < board->height && (line = next_line(&pos, end, &len)) != NULL) {
+        char *row = &board->cells[BOARD_INDEX(board, x, 0)];
+        size_t n = len < board->width ? len : board->width;
+        for (size_t y = 0; y < n; y++) {
+            // '0' को छोड़कर सभी characters जीवित cell हैं
+            row[y] = line[y] != '0';
+        }
+        memset(row + n, 0, board->width - n);
+        x++;
+    }
+
+    for (; x < board->height; x++) {
+        memset(&board->cells[BOARD_INDEX(board, x, 0)], 0, board->width);
+    }
+}
+
+/**
+ * @brief RLE header line ("x = W, y = H, rule = ...") से size पढ़ता है
+ * @param line header line
+ * @param len line की length
+ * @param height ऊंचाई (y) store करने के लिए pointer
+ * @param width चौड़ाई (x) store करने के लिए pointer
+ * @return दोनों values मिलने पर 0, वरना -1
+ */
+static int rle_parse_header(const char *line, size_t len, size_t *height, size_t *width) {
+    int found = 0;
+    for (size_t i = 0; i < len; i++) {
+        char key = line[i];
+        if (key != 'x' && key != 'y') continue;
+        if (i > 0 && line[i - 1] != ' ' && line[i - 1] != ',' && line[i - 1] != '\t') continue;
+
+        size_t j = i + 1;
+        while (j < len && (line[j] == ' ' || line[j] == '\t')) j++;
+        if (j >= len || line[j] != '=') continue;
+        j++;
+        while (j < len && (line[j] == ' ' || line[j] == '\t')) j++;
+
+        size_t value = 0;
+        if (j >= len || line[j] < '0' || line[j] > '9') return -1;
+        while (j < len && line[j] >= '0' && line[j] <= '9') {
+            value = value * 10 + (size_t)(line[j] - '0');
+            j++;
+        }
+
+        if (key == 'x') {
+            *width = value;
+            found |= 1;
+        } else {
+            *height = value;
+            found |= 2;
+        }
+        i = j;
+    }
+    return found == 3 ? 0 : -1;
+}
+
+/**
+ * @brief RLE pattern decode करता है
+ *
+ * board NULL हो तो सिर्फ size निकलता है। Header न हो तो size जीवित
+ * cells के extent से आता है।
+ *
+ * @param data file का content
+ * @param size content का size
+ * @param board target बोर्ड (NULL = सिर्फ size)
+ * @param height pattern की ऊंचाई store करने के लिए pointer
+ * @param width pattern की चौड़ाई store करने के लिए pointer
+ * @return सफल होने पर 0, invalid RLE होने पर -1
+ */
+static int rle_decode(const char *data, size_t size, Board *board, size_t *height, size_t *width) {
+    const char *pos = data, *end = data + size;
+    const char *line;
+    size_t len;
+    int have_header = 0;
+
+    // Comments और header
+    while ((line = next_line(&pos, end, &len)) != NULL) {
+        if (len > 0 && line[0] == '#') continue;
+        if (rle_parse_header(line, len, height, width) != 0) return -1;
+        have_header = 1;
+        break;
+    }
+    if (!have_header) return -1;
+
+    size_t run = 0, x = 0, y = 0, max_x = 0, max_y = 0;
+    int at_line_start = 1;
+    for (const char *p = pos; p < end; p++) {
+        char c = *p;
+        if (c == '\n') {
+            at_line_start = 1;
+            continue;
+        }
+        if (at_line_start && c == '#') {
+            const char *newline = memchr(p, '\n', (size_t)(end - p));
+            if (!newline) break;
+            p = newline - 1;
+            continue;
+        }
+        at_line_start = 0;
+
+        if (c >= '0' && c <= '9') {
+            if (run > SIZE_MAX / 10) return -1;
+            run = run * 10 + (size_t)(c - '0');
+            continue;
+        }
+
+        size_t count = run ? run : 1;
+        run = 0;
+        if (c == '!') {
+            break;
+        } else if (c == '$') {
+            x += count;
+            y = 0;
+        } else if (c == 'b' || c == '.') {
+            y += count;
+        } else if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) {
+            // 'o' और multi-state letters जीवित हैं
+            if (board && x < board->height && y < board->width) {
+                size_t n = count < board->width - y ? count : board->width - y;
+                memset(&board->cells[BOARD_INDEX(board, x, y)], 1, n);
+            }
+            y += count;
+            if (x + 1 > max_x) max_x = x + 1;
+            if (y > max_y) max_y = y;
+        }
+        // बाकी characters (spaces, '\r') ignore होते हैं
+    }
+
+    if (*height < max_x) *height = max_x;
+    if (*width < max_y) *width = max_y;
+    return 0;
+}
+
+/**
+ * @brief Macrocell का एक node (parse होने के बाद)
+ */
+typedef struct MacroNode {
+    int level;              /**< Square का size 2^level */
+    uint32_t child[4];      /**< nw, ne, sw, se (node numbers, 0 = खाली) */
+    uint64_t bits;          /**< Leaf: bit (row * 8 + column) */
+    int populated;          /**< कोई जीवित cell है? */
+    int64_t min_x, min_y;   /**< जीवित cells का bounding box (node के अंदर) */
+    int64_t max_x, max_y;   /**< Bounding box का अंत (inclusive) */
+} MacroNode;
+
+/**
+ * @brief Parsed Macrocell tree
+ */
+typedef struct MacroTree {
+    MacroNode *nodes;       /**< nodes[0] = खाली node, बाकी file के क्रम में */
+    size_t count;           /**< nodes की संख्या (खाली node सहित) */
+    size_t capacity;        /**< Allocated nodes */
+} MacroTree;
+
+/**
+ * @brief node का bounding box child के bounding box से बढ़ाता है
+ * @param node parent node
+ * @param child child node
+ * @param dx child की row offset
+ * @param dy child का column offset
+ */
+static void macro_extend(MacroNode *node, const MacroNode *child, int64_t dx, int64_t dy) {
+    if (!child->populated) return;
+    if (!node->populated) {
+        node->min_x = child->min_x + dx;
+        node->min_y = child->min_y + dy;
+        node->max_x = child->max_x + dx;
+        node->max_y = child->max_y + dy;
+        node->populated = 1;
+        return;
+    }
+    if (child->min_x + dx < node->min_x) node->min_x = child->min_x + dx;
+    if (child->min_y + dy < node->min_y) node->min_y = child->min_y + dy;
+    if (child->max_x + dx > node->max_x) node->max_x = child->max_x + dx;
+    if (child->max_y + dy > node->max_y) node->max_y = child->max_y + dy;
+}
+
+/**
+ * @brief Macrocell file parse करके tree बनाता है
+ * @param data file का content
+ * @param size content का size
+ * @param tree result tree (caller free करता है)
+ * @return सफल होने पर 0, invalid format या memory error होने पर -1
+ */
+static int macro_parse(const char *data, size_t size, MacroTree *tree) {
+    tree->count = 1;
+    tree->capacity = 1024;
+    tree->nodes = calloc(tree->capacity, sizeof(MacroNode));
+    if (!tree->nodes) return -1;
+
+    const char *pos = data, *end = data + size;
+    const char *line;
+    size_t len;
+    next_line(&pos, end, &len);  // "[M2] ..." header
+
+    while ((line = next_line(&pos, end, &len)) != NULL) {
+        if (len == 0 || line[0] == '#') continue;
+
+        if (tree->count == tree->capacity) {
+            MacroNode *grown = realloc(tree->nodes, tree->capacity * 2 * sizeof(MacroNode));
+            if (!grown) return -1;
+            tree->nodes = grown;
+            tree->capacity *= 2;
+        }
+        MacroNode *node = &tree->nodes[tree->count];
+        memset(node, 0, sizeof(MacroNode));
+
+        if (line[0] == '.' || line[0] == '*' || line[0] == '$') {
+            // 8x8 leaf: '.' मृत, '*' जीवित, '$' row का अंत
+            node->level = MACROCELL_LEAF_LEVEL;
+            int64_t x = 0, y = 0;
+            for (size_t i = 0; i < len; i++) {
+                if (line[i] == '$') {
+                    x++;
+                    y = 0;
+                } else if (line[i] == '.' || line[i] == '*') {
+                    if (x >= 8 || y >= 8) return -1;
+                    if (line[i] == '*') {
+                        node->bits |= (uint64_t)1 << (x * 8 + y);
+                        MacroNode cell = { 0, { 0, 0, 0, 0 }, 0, 1, 0, 0, 0, 0 };
+                        macro_extend(node, &cell, x, y);
+                    }
+                    y++;
+                } else {
+                    return -1;
+                }
+            }
+        } else {
+            // Inner node: "level nw ne sw se"
+            char text[128];
+            if (len >= sizeof(text)) return -1;
+            memcpy(text, line, len);
+            text[len] = '\0';
+
+            char *cursor = text, *after = NULL;
+            long level = strtol(cursor, &after, 10);
+            if (after == cursor || level <= MACROCELL_LEAF_LEVEL || level > MACROCELL_MAX_LEVEL) return -1;
+            node->level = (int)level;
+            cursor = after;
+
+            int64_t half = (int64_t)1 << (level - 1);
+            for (int q = 0; q < 4; q++) {
+                unsigned long index = strtoul(cursor, &after, 10);
+                if (after == cursor || index >= tree->count) return -1;
+                cursor = after;
+
+                const MacroNode *child = &tree->nodes[index];
+                if (index != 0 && child->level != level - 1) return -1;
+                node->child[q] = (uint32_t)index;
+                macro_extend(node, child, (q >> 1) * half, (q & 1) * half);
+            }
+        }
+        tree->count++;
+    }
+
+    return tree->count > 1 ? 0 : -1;
+}
+
+/**
+ * @brief node की जीवित cells बोर्ड में लिखता है (बोर्ड के बाहर वाली clip)
+ * @param tree parsed tree
+ * @param index node number
+ * @param board target बोर्ड
+ * @param x0 node की पहली row (बोर्ड coordinates)
+ * @param y0 node का पहला column (बोर्ड coordinates)
+ */
+static void macro_write(const MacroTree *tree, uint32_t index, Board *board, int64_t x0, int64_t y0) {
+    const MacroNode *node = &tree->nodes[index];
+    if (index == 0 || !node->populated) return;
+    if (x0 + node->max_x < 0 || y0 + node->max_y < 0) return;
+    if (x0 + node->min_x >= (int64_t)board->height || y0 + node->min_y >= (int64_t)board->width) return;
+
+    if (node->level == MACROCELL_LEAF_LEVEL) {
+        for (int64_t x = 0; x < 8; x++) {
+            for (int64_t y = 0; y < 8; y++) {
+                if (!((node->bits >> (x * 8 + y)) & 1)) continue;
+                int64_t bx = x0 + x, by = y0 + y;
+                if (bx < 0 || by < 0 || bx >= (int64_t)board->height || by >= (int64_t)board->width) continue;
+                board->cells[BOARD_INDEX(board, (size_t)bx, (size_t)by)] = 1;
+            }
+        }
+        return;
+    }
+
+    int64_t half = (int64_t)1 << (node->level - 1);
+    for (int q = 0; q < 4; q++) {
+        macro_write(tree, node->child[q], board, x0 + (q >> 1) * half, y0 + (q & 1) * half);
+    }
+}
+
+/**
+ * @brief Macrocell pattern decode करता है
+ *
+ * Pattern का bounding box बोर्ड के (0, 0) पर रखा जाता है। board NULL हो
+ * तो सिर्फ size निकलता है।
+ *
+ * @param data file का content
+ * @param size content का size
+ * @param board target बोर्ड (NULL = सिर्फ size)
+ * @param height bounding box की ऊंचाई store करने के लिए pointer
+ * @param width bounding box की चौड़ाई store करने के लिए pointer
+ * @return सफल होने पर 0, invalid format होने पर -1
+ */
+static int macro_decode(const char *data, size_t size, Board *board, size_t *height, size_t *width) {
+    MacroTree tree = { NULL, 0, 0 };
+    int status = macro_parse(data, size, &tree);
+
+    if (status == 0) {
+        uint32_t root = (uint32_t)(tree.count - 1);
+        const MacroNode *node = &tree.nodes[root];
+        *height = node->populated ? (size_t)(node->max_x - node->min_x + 1) : 0;
+        *width = node->populated ? (size_t)(node->max_y - node->min_y + 1) : 0;
+        if (board) macro_write(&tree, root, board, -node->min_x, -node->min_y);
+    }
+
+    free(tree.nodes);
+    return status;
+}
+
+/**
+ * @brief pattern file को बोर्ड में load करता है (बाकी बोर्ड मृत)
+ * @param filename pattern file का नाम
+ * @param board target बोर्ड
+ * @return सफल होने पर 0, file या format error होने पर -1
+ */
+int pattern_load(const char *filename, Board *board) {
+    if (filename == NULL || board == NULL) return -1;
+
+    PatternFile file;
+    if (pattern_open(filename, &file) != 0) return -1;
+
+    int status = 0;
+    size_t height = 0, width = 0;
+    switch (pattern_detect(file.data, file.size)) {
+        case PATTERN_RLE:
+            board_clear(board);
+            status = rle_decode(file.data, file.size, board, &height, &width);
+            break;
+        case PATTERN_MACROCELL:
+            board_clear(board);
+            status = macro_decode(file.data, file.size, board, &height, &width);
+            break;
+        default:
+            plain_load(file.data, file.size, board);
+            break;
+    }
+
+    pattern_close(&file);
+    board_mark_all_dirty(board);
+    return status;
+}
+
+/**
+ * @brief pattern का natural size पता करता है
+ * @param filename pattern file का नाम
+ * @param height rows की संख्या store करने के लिए pointer
+ * @param width columns की संख्या store करने के लिए pointer
+ * @return सफल होने पर 0, file या format error होने पर -1
+ */
+int pattern_dimensions(const char *filename, size_t *height, size_t *width) {
+    if (filename == NULL || height == NULL || width == NULL) return -1;
+
+    PatternFile file;
+    if (pattern_open(filename, &file) != 0) return -1;
+
+    int status = 0;
+    *height = 0;
+    *width = 0;
+    switch (pattern_detect(file.data, file.size)) {
+        case PATTERN_RLE:
+            status = rle_decode(file.data, file.size, NULL, height, width);
+            break;
+        case PATTERN_MACROCELL:
+            status = macro_decode(file.data, file.size, NULL, height, width);
+            break;
+        default:
+            plain_dimensions(file.data, file.size, height, width);
+            break;
+    }
+
+    pattern_close(&file);
+    return status;
+}
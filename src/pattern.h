@@ -0,0 +1,69 @@
+/**
+ * @file pattern.h
+ * @brief Pattern files (plain text, RLE, Macrocell) का loader
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * File एक बार में memory में map होती है (mmap, और जहाँ mmap न हो वहाँ
+ * बड़े chunks में read), फिर हर row bulk में सीधे बोर्ड buffer में
+ * convert होती है। तीन formats support हैं:
+ *
+ * - Plain text: हर line एक row, '0' = मृत और बाकी characters जीवित
+ *   (grids/gun.txt वाला पुराना format)।
+ * - RLE: "x = W, y = H" header के बाद run-length encoded cells
+ *   (b = मृत, o = जीवित, $ = row का अंत, ! = pattern का अंत)।
+ * - Macrocell ([M2]): quadtree nodes की list, 8x8 leaves के साथ।
+ *
+ * बोर्ड से बड़े patterns बोर्ड के size पर clip होते हैं।
+ */
+
+#ifndef PATTERN_H
+#define PATTERN_H
+
+#include <stddef.h>
+#include "board.h"
+
+/**
+ * @brief Pattern file का format
+ */
+typedef enum PatternFormat {
+    PATTERN_PLAIN = 0,      /**< एक character प्रति cell, एक line प्रति row */
+    PATTERN_RLE,            /**< Run Length Encoded */
+    PATTERN_MACROCELL       /**< Golly Macrocell ([M2]) */
+} PatternFormat;
+
+/**
+ * @brief file के content से उसका format पहचानता है
+ *
+ * "[M2]" से शुरू होने वाली file Macrocell है; जिसकी पहली non-comment line
+ * "x =" से शुरू हो वो RLE है; बाकी सब plain text।
+ *
+ * @param data file का content
+ * @param size content का size bytes में
+ * @return format
+ */
+PatternFormat pattern_detect(const char *data, size_t size);
+
+/**
+ * @brief pattern file को बोर्ड में load करता है (बाकी बोर्ड मृत)
+ *
+ * @param filename pattern file का नाम
+ * @param board target बोर्ड (सभी tiles dirty mark होती हैं)
+ * @return सफल होने पर 0, file या format error होने पर -1
+ */
+int pattern_load(const char *filename, Board *board);
+
+/**
+ * @brief pattern का natural size पता करता है
+ *
+ * Plain text में lines और सबसे लंबी line, RLE में header का x/y, और
+ * Macrocell में जीवित cells का bounding box।
+ *
+ * @param filename pattern file का नाम
+ * @param height rows की संख्या store करने के लिए pointer
+ * @param width columns की संख्या store करने के लिए pointer
+ * @return सफल होने पर 0, file या format error होने पर -1
+ */
+int pattern_dimensions(const char *filename, size_t *height, size_t *width);
+
+#endif // PATTERN_H
@@ -0,0 +1,202 @@
+/**
+ * @file pool.c
+ * @brief Persistent worker thread pool का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Workers एक generation counter पर wait करते हैं। pool_run counter
+ * बढ़ाकर सबको जगाता है, खुद worker 0 का हिस्सा चलाता है, और फिर
+ * बाकी workers के खत्म होने का wait करता है।
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "pool.h"
+
+/**
+ * @brief Thread pool का internal structure
+ */
+struct ThreadPool {
+    pthread_t *threads;          /**< Background worker threads (num_workers - 1) */
+    int num_workers;             /**< कुल workers (calling thread सहित) */
+    pthread_mutex_t lock;        /**< नीचे के सभी fields को protect करता है */
+    pthread_cond_t start;        /**< नया task आने पर signal होता है */
+    pthread_cond_t done;         /**< सभी workers के खत्म होने पर signal होता है */
+    unsigned long generation;    /**< हर pool_run पर increment होता है */
+    int pending;                 /**< current task में बचे background workers */
+    int shutdown;                /**< workers को exit करना है या नहीं */
+    PoolTask task;               /**< current task */
+    void *arg;                   /**< current task का argument */
+};
+
+/**
+ * @brief Worker thread को उसका index और pool देने के लिए argument
+ */
+typedef struct WorkerArg {
+    ThreadPool *pool;
+    int index;
+} WorkerArg;
+
+/**
+ * @brief Background worker thread का main loop
+ *
+ * हर नई generation पर current task चलाता है और pending counter घटाता है।
+ *
+ * @param data WorkerArg pointer (worker इसे free करता है)
+ * @return हमेशा NULL
+ */
+static void *worker_main(void *data) {
+    WorkerArg *worker = data;
+    ThreadPool *pool = worker->pool;
+    int index = worker->index;
+    unsigned long seen = 0;
+    free(worker);
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->shutdown && pool->generation == seen) {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if (pool->shutdown) break;
+
+        seen = pool->generation;
+        PoolTask task = pool->task;
+        void *arg = pool->arg;
+        pthread_mutex_unlock(&pool->lock);
+
+        task(arg, index, pool->num_workers);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) {
+            pthread_cond_signal(&pool->done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+/**
+ * @brief नया thread pool create करता है
+ *
+ * @param num_threads कुल workers (0 या negative होने पर online CPUs की संख्या)
+ * @return सफल होने पर ThreadPool pointer, memory या thread creation fail होने पर NULL
+ */
+ThreadPool *pool_init(int num_threads) {
+    if (num_threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = cpus > 0 ? (int)cpus : 1;
+    }
+
+    ThreadPool *pool = malloc(sizeof(ThreadPool));
+    if (!pool) return NULL;
+
+    pool->threads = malloc(sizeof(pthread_t) * (size_t)num_threads);
+    if (!pool->threads) {
+        free(pool);
+        return NULL;
+    }
+
+    pool->num_workers = 1;
+    pool->generation = 0;
+    pool->pending = 0;
+    pool->shutdown = 0;
+    pool->task = NULL;
+    pool->arg = NULL;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    // Worker 0 calling thread है, बाकी के लिए threads बनाएं
+    for (int i = 1; i < num_threads; i++) {
+        WorkerArg *worker = malloc(sizeof(WorkerArg));
+        if (!worker) break;
+        worker->pool = pool;
+        worker->index = i;
+        if (pthread_create(&pool->threads[i - 1], NULL, worker_main, worker) != 0) {
+            free(worker);
+            break;
+        }
+        pool->num_workers++;
+    }
+
+    return pool;
+}
+
+/**
+ * @brief pool में workers की कुल संख्या return करता है
+ *
+ * @param pool thread pool
+ * @return workers की संख्या (NULL होने पर 1)
+ */
+int pool_size(const ThreadPool *pool) {
+    return pool ? pool->num_workers : 1;
+}
+
+/**
+ * @brief task को सभी workers पर चलाता है और सबके खत्म होने तक wait करता है
+ *
+ * Calling thread worker 0 का हिस्सा चलाता है। Return होने पर task के
+ * सभी side effects calling thread को visible होते हैं।
+ *
+ * @param pool thread pool
+ * @param task चलाने वाला task
+ * @param arg task का argument
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int pool_run(ThreadPool *pool, PoolTask task, void *arg) {
+    if (pool == NULL || task == NULL) return -1;
+
+    if (pool->num_workers > 1) {
+        pthread_mutex_lock(&pool->lock);
+        pool->task = task;
+        pool->arg = arg;
+        pool->pending = pool->num_workers - 1;
+        pool->generation++;
+        pthread_cond_broadcast(&pool->start);
+        pthread_mutex_unlock(&pool->lock);
+    }
+
+    task(arg, 0, pool->num_workers);
+
+    if (pool->num_workers > 1) {
+        pthread_mutex_lock(&pool->lock);
+        while (pool->pending > 0) {
+            pthread_cond_wait(&pool->done, &pool->lock);
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief सभी worker threads को रोककर pool की memory free करता है
+ *
+ * @param pool free करने वाला pool
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int pool_free(ThreadPool *pool) {
+    if (pool == NULL) return -1;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->num_workers - 1; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->start);
+    pthread_cond_destroy(&pool->done);
+    free(pool->threads);
+    free(pool);
+
+    return 0;
+}
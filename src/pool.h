@@ -0,0 +1,63 @@
+/**
+ * @file pool.h
+ * @brief Persistent worker thread pool का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * यह फाइल एक छोटा thread pool define करती है जो program की शुरुआत में
+ * एक बार बनता है। हर generation में pool_run सभी workers को एक ही task
+ * देता है और सबके खत्म होने तक wait करता है (barrier), इसलिए हर step में
+ * threads spawn नहीं करने पड़ते।
+ */
+
+#ifndef POOL_H
+#define POOL_H
+
+/**
+ * @brief Pool में चलने वाला task
+ * @param arg pool_run को दिया गया argument
+ * @param worker_index इस worker का index (0 से num_workers-1)
+ * @param num_workers कुल workers की संख्या
+ */
+typedef void (*PoolTask)(void *arg, int worker_index, int num_workers);
+
+/**
+ * @brief Opaque thread pool structure
+ */
+typedef struct ThreadPool ThreadPool;
+
+/**
+ * @brief नया thread pool create करता है
+ *
+ * Calling thread भी worker 0 के रूप में काम करता है, इसलिए
+ * num_threads - 1 background threads बनते हैं।
+ *
+ * @param num_threads कुल workers (0 या negative होने पर online CPUs की संख्या)
+ * @return सफल होने पर ThreadPool pointer, असफल होने पर NULL
+ */
+ThreadPool *pool_init(int num_threads);
+
+/**
+ * @brief pool में workers की कुल संख्या return करता है
+ * @param pool thread pool
+ * @return workers की संख्या (NULL होने पर 1)
+ */
+int pool_size(const ThreadPool *pool);
+
+/**
+ * @brief task को सभी workers पर चलाता है और सबके खत्म होने तक wait करता है
+ * @param pool thread pool
+ * @param task चलाने वाला task
+ * @param arg task का argument
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int pool_run(ThreadPool *pool, PoolTask task, void *arg);
+
+/**
+ * @brief सभी worker threads को रोककर pool की memory free करता है
+ * @param pool free करने वाला pool
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int pool_free(ThreadPool *pool);
+
+#endif // POOL_H
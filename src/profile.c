@@ -0,0 +1,262 @@
+/**
+ * @file profile.c
+ * @brief Main loop के per-phase timing instrumentation का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Timings CLOCK_MONOTONIC से आते हैं। Statistics stored frames की copy sort
+ * करके निकलती हैं; यह सिर्फ summary बनाते समय होता है (title update या
+ * exit), इसलिए per-frame cost सिर्फ clock reads है।
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "profile.h"
+
+/**
+ * @brief Phases के नाम, ProfilePhase के क्रम में
+ */
+static const char *phase_names[PROFILE_PHASE_COUNT] = {
+    "events", "clear", "draw", "present", "acquire", "delay", "frame", "sim_step", "sim_gens"
+};
+
+/**
+ * @brief monotonic clock का current time seconds में
+ *
+ * Profiler, simulator scheduler, headless runs और benchmarks सब यही clock
+ * पढ़ते हैं, इसलिए इनके times आपस में comparable हैं।
+ *
+ * @return seconds (fractional)
+ */
+double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief नया profiler बनाता है
+ * @param capacity कितने आखिरी frames रखने हैं (0 = PROFILE_DEFAULT_FRAMES)
+ * @return सफल होने पर Profiler pointer, memory allocation fail होने पर NULL
+ */
+Profiler *profiler_init(size_t capacity) {
+    if (capacity == 0) capacity = PROFILE_DEFAULT_FRAMES;
+
+    Profiler *profiler = calloc(1, sizeof(Profiler));
+    if (profiler == NULL) return NULL;
+
+    profiler->samples = calloc(capacity * PROFILE_PHASE_COUNT, sizeof(double));
+    if (profiler->samples == NULL) {
+        free(profiler);
+        return NULL;
+    }
+    profiler->capacity = capacity;
+    profiler->last_lap = now_seconds();
+    return profiler;
+}
+
+/**
+ * @brief profiler की memory free करता है
+ * @param profiler free करने वाला profiler (NULL हो सकता है)
+ */
+void profiler_free(Profiler *profiler) {
+    if (profiler == NULL) return;
+    free(profiler->samples);
+    free(profiler);
+}
+
+/**
+ * @brief नया frame शुरू करता है
+ * @param profiler profiler (NULL = कुछ नहीं)
+ */
+void profiler_begin_frame(Profiler *profiler) {
+    if (profiler == NULL) return;
+    memset(profiler->current, 0, sizeof(profiler->current));
+    profiler->last_lap = now_seconds();
+}
+
+/**
+ * @brief पिछले lap (या frame की शुरुआत) से अब तक का time phase में जोड़ता है
+ * @param profiler profiler (NULL = कुछ नहीं)
+ * @param phase जिस phase का काम अभी खत्म हुआ
+ */
+void profiler_lap(Profiler *profiler, ProfilePhase phase) {
+    if (profiler == NULL || phase >= PROFILE_TOTAL) return;
+
+    double now = now_seconds();
+    profiler->current[phase] += (now - profiler->last_lap) * 1e3;
+    profiler->last_lap = now;
+}
+
+/**
+ * @brief चल रहे frame में simulator thread की stepping जोड़ता है
+ * @param profiler profiler (NULL = कुछ नहीं)
+ * @param generations पिछले acquire हुए snapshot के बाद चली generations
+ * @param seconds उनकी stepping का time
+ */
+void profiler_record_step(Profiler *profiler, uint64_t generations, double seconds) {
+    if (profiler == NULL) return;
+    profiler->current[PROFILE_SIM_STEP] += seconds * 1e3;
+    profiler->current[PROFILE_SIM_GENERATIONS] += (double)generations;
+}
+
+/**
+ * @brief चल रहे frame को ring buffer में store करता है
+ * @param profiler profiler (NULL = कुछ नहीं)
+ */
+void profiler_end_frame(Profiler *profiler) {
+    if (profiler == NULL) return;
+
+    double total = 0;
+    for (int p = 0; p < PROFILE_TOTAL; p++) total += profiler->current[p];
+    profiler->current[PROFILE_TOTAL] = total;
+
+    memcpy(&profiler->samples[profiler->next * PROFILE_PHASE_COUNT], profiler->current, sizeof(profiler->current));
+    profiler->next = (profiler->next + 1) % profiler->capacity;
+    if (profiler->count < profiler->capacity) profiler->count++;
+    profiler->frames++;
+}
+
+/**
+ * @brief phase का नाम (CSV header और summaries के लिए)
+ * @param phase phase
+ * @return नाम, जैसे "draw"
+ */
+const char *profiler_phase_name(ProfilePhase phase) {
+    return phase < PROFILE_PHASE_COUNT ? phase_names[phase] : "unknown";
+}
+
+/**
+ * @brief qsort के लिए doubles की तुलना
+ * @param a पहली value
+ * @param b दूसरी value
+ * @return a < b तो negative, बराबर तो 0, वरना positive
+ */
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief stored frames पर एक phase की statistics निकालता है
+ * @param profiler profiler
+ * @param phase phase
+ * @param stats result store करने के लिए pointer
+ * @return सफल होने पर 0, कोई frame न हो या NULL pointer होने पर -1
+ */
+int profiler_stats(const Profiler *profiler, ProfilePhase phase, ProfileStats *stats) {
+    if (profiler == NULL || stats == NULL || phase >= PROFILE_PHASE_COUNT || profiler->count == 0) return -1;
+
+    double *values = malloc(profiler->count * sizeof(double));
+    if (values == NULL) return -1;
+
+    double sum = 0;
+    for (size_t i = 0; i < profiler->count; i++) {
+        values[i] = profiler->samples[i * PROFILE_PHASE_COUNT + phase];
+        sum += values[i];
+    }
+    qsort(values, profiler->count, sizeof(double), compare_double);
+
+    // Nearest-rank percentile
+    size_t rank = (size_t)ceil(0.99 * (double)profiler->count);
+    stats->min = values[0];
+    stats->avg = sum / (double)profiler->count;
+    stats->p99 = values[rank > 0 ? rank - 1 : 0];
+    stats->max = values[profiler->count - 1];
+    stats->samples = profiler->count;
+
+    free(values);
+    return 0;
+}
+
+/**
+ * @brief एक line का summary बनाता है (window title के लिए)
+ * @param profiler profiler
+ * @param buffer output buffer
+ * @param size buffer का size
+ * @return सफल होने पर 0, कोई frame न हो या NULL pointer होने पर -1
+ */
+int profiler_format_summary(const Profiler *profiler, char *buffer, size_t size) {
+    if (buffer == NULL || size == 0) return -1;
+
+    ProfileStats frame;
+    if (profiler_stats(profiler, PROFILE_TOTAL, &frame) != 0) return -1;
+
+    int used = snprintf(buffer, size, "frame %.1f ms (p99 %.1f)", frame.avg, frame.p99);
+    for (int p = 0; p < PROFILE_TOTAL && used >= 0 && (size_t)used < size; p++) {
+        ProfileStats stats;
+        if (profiler_stats(profiler, (ProfilePhase)p, &stats) != 0) return -1;
+        used += snprintf(buffer + used, size - (size_t)used, " | %s %.2f", phase_names[p], stats.avg);
+    }
+
+    ProfileStats step, generations;
+    if (profiler_stats(profiler, PROFILE_SIM_STEP, &step) != 0 ||
+        profiler_stats(profiler, PROFILE_SIM_GENERATIONS, &generations) != 0) return -1;
+    if (used >= 0 && (size_t)used < size) {
+        snprintf(buffer + used, size - (size_t)used, " | sim %.2f ms/%.0f gens", step.avg, generations.avg);
+    }
+    return 0;
+}
+
+/**
+ * @brief सभी phases की min/avg/p99/max table stdout पर print करता है
+ * @param profiler profiler (NULL = कुछ नहीं)
+ */
+void profiler_print_summary(const Profiler *profiler) {
+    if (profiler == NULL || profiler->count == 0) return;
+
+    printf("\n=== Frame timings (last %zu of %llu frames, ms) ===\n",
+           profiler->count, (unsigned long long)profiler->frames);
+    printf("%-8s %10s %10s %10s %10s\n", "phase", "min", "avg", "p99", "max");
+    for (int p = 0; p < PROFILE_SIM_GENERATIONS; p++) {
+        ProfileStats stats;
+        if (profiler_stats(profiler, (ProfilePhase)p, &stats) != 0) continue;
+        printf("%-8s %10.3f %10.3f %10.3f %10.3f\n", phase_names[p], stats.min, stats.avg, stats.p99, stats.max);
+    }
+
+    // Generations ms नहीं हैं, इसलिए अलग section में
+    ProfileStats generations;
+    if (profiler_stats(profiler, PROFILE_SIM_GENERATIONS, &generations) == 0) {
+        printf("\n=== Simulator generations per frame ===\n");
+        printf("%-8s %10s %10s %10s %10s\n", "", "min", "avg", "p99", "max");
+        printf("%-8s %10.0f %10.2f %10.0f %10.0f\n", "sim_gens", generations.min, generations.avg,
+               generations.p99, generations.max);
+    }
+}
+
+/**
+ * @brief stored frames CSV में लिखता है (एक row प्रति frame, ms में)
+ * @param profiler profiler
+ * @param filename CSV file का नाम
+ * @return सफल होने पर 0, file error या NULL pointer होने पर -1
+ */
+int profiler_write_csv(const Profiler *profiler, const char *filename) {
+    if (profiler == NULL || filename == NULL) return -1;
+
+    FILE *file = fopen(filename, "w");
+    if (file == NULL) return -1;
+
+    fprintf(file, "frame");
+    for (int p = 0; p < PROFILE_PHASE_COUNT; p++) {
+        fprintf(file, ",%s%s", phase_names[p], p == PROFILE_SIM_GENERATIONS ? "" : "_ms");
+    }
+    fprintf(file, "\n");
+
+    // Ring buffer को पुराने से नए क्रम में लिखें
+    uint64_t first_frame = profiler->frames - profiler->count;
+    size_t start = profiler->count < profiler->capacity ? 0 : profiler->next;
+    for (size_t i = 0; i < profiler->count; i++) {
+        const double *row = &profiler->samples[((start + i) % profiler->capacity) * PROFILE_PHASE_COUNT];
+        fprintf(file, "%llu", (unsigned long long)(first_frame + i));
+        for (int p = 0; p < PROFILE_PHASE_COUNT; p++) fprintf(file, ",%.4f", row[p]);
+        fprintf(file, "\n");
+    }
+
+    return fclose(file) == 0 ? 0 : -1;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file profile.h
+ * @brief Main loop के per-phase timing instrumentation का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * हर frame में loop के phases (events, clear, draw, present, acquire, delay)
+ * का time record होता है। Stepping अलग thread पर होती है, इसलिए उसका time
+ * और generations (profiler_record_step) frame के साथ अलग columns में रहते
+ * हैं। आखिरी frames एक ring buffer में रहते हैं, जिनसे min/avg/p99/max
+ * निकलते हैं और CSV dump होता है।
+ *
+ * सभी functions NULL profiler accept करते हैं और कुछ नहीं करते, इसलिए
+ * profiling बंद होने पर main loop में कोई अलग code path नहीं चाहिए।
+ * इस module में SDL पर कोई dependency नहीं है।
+ */
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Ring buffer में default frames की संख्या
+ */
+#define PROFILE_DEFAULT_FRAMES 4096
+
+/**
+ * @brief Main loop के phases
+ */
+typedef enum ProfilePhase {
+    PROFILE_EVENTS = 0,     /**< process_events */
+    PROFILE_CLEAR,          /**< SDL_RenderClear */
+    PROFILE_DRAW,           /**< board_draw */
+    PROFILE_PRESENT,        /**< SDL_RenderPresent */
+    PROFILE_ACQUIRE,        /**< Simulator से latest snapshot लेना (stepping अपने thread पर) */
+    PROFILE_DELAY,          /**< SDL_Delay */
+    PROFILE_TOTAL,          /**< पूरा frame (ऊपर के सभी phases का जोड़) */
+    PROFILE_SIM_STEP,       /**< इस frame में मिले snapshots तक simulator thread की stepping (frame का हिस्सा नहीं) */
+    PROFILE_SIM_GENERATIONS, /**< उस stepping की generations (ms नहीं, count) */
+    PROFILE_PHASE_COUNT
+} ProfilePhase;
+
+/**
+ * @brief एक phase की statistics (milliseconds)
+ */
+typedef struct ProfileStats {
+    double min;         /**< सबसे कम time */
+    double avg;         /**< औसत time */
+    double p99;         /**< 99th percentile */
+    double max;         /**< सबसे ज्यादा time */
+    size_t samples;     /**< कितने frames पर */
+} ProfileStats;
+
+/**
+ * @brief Per-frame timings का recorder
+ */
+typedef struct Profiler {
+    double *samples;                        /**< capacity frames x PROFILE_PHASE_COUNT (ms) */
+    size_t capacity;                        /**< Ring buffer में frames */
+    size_t count;                           /**< Stored frames (capacity तक) */
+    size_t next;                            /**< अगला frame किस slot में जाएगा */
+    uint64_t frames;                        /**< कुल recorded frames */
+    double current[PROFILE_PHASE_COUNT];    /**< चल रहे frame के phase times */
+    double last_lap;                        /**< पिछले lap का time (seconds) */
+} Profiler;
+
+/**
+ * @brief monotonic clock (CLOCK_MONOTONIC) का current time seconds में
+ * @return seconds (fractional)
+ */
+double now_seconds(void);
+
+/**
+ * @brief नया profiler बनाता है
+ * @param capacity कितने आखिरी frames रखने हैं (0 = PROFILE_DEFAULT_FRAMES)
+ * @return सफल होने पर Profiler pointer, memory allocation fail होने पर NULL
+ */
+Profiler *profiler_init(size_t capacity);
+
+/**
+ * @brief profiler की memory free करता है
+ * @param profiler free करने वाला profiler (NULL हो सकता है)
+ */
+void profiler_free(Profiler *profiler);
+
+/**
+ * @brief नया frame शुरू करता है
+ * @param profiler profiler (NULL = कुछ नहीं)
+ */
+void profiler_begin_frame(Profiler *profiler);
+
+/**
+ * @brief पिछले lap (या frame की शुरुआत) से अब तक का time phase में जोड़ता है
+ * @param profiler profiler (NULL = कुछ नहीं)
+ * @param phase जिस phase का काम अभी खत्म हुआ
+ */
+void profiler_lap(Profiler *profiler, ProfilePhase phase);
+
+/**
+ * @brief चल रहे frame में simulator thread की stepping जोड़ता है
+ * @param profiler profiler (NULL = कुछ नहीं)
+ * @param generations पिछले acquire हुए snapshot के बाद चली generations
+ * @param seconds उनकी stepping का time
+ */
+void profiler_record_step(Profiler *profiler, uint64_t generations, double seconds);
+
+/**
+ * @brief चल रहे frame को ring buffer में store करता है
+ * @param profiler profiler (NULL = कुछ नहीं)
+ */
+void profiler_end_frame(Profiler *profiler);
+
+/**
+ * @brief phase का नाम (CSV header और summaries के लिए)
+ * @param phase phase
+ * @return नाम, जैसे "draw"
+ */
+const char *profiler_phase_name(ProfilePhase phase);
+
+/**
+ * @brief stored frames पर एक phase की statistics निकालता है
+ * @param profiler profiler
+ * @param phase phase
+ * @param stats result store करने के लिए pointer
+ * @return सफल होने पर 0, कोई frame न हो या NULL pointer होने पर -1
+ */
+int profiler_stats(const Profiler *profiler, ProfilePhase phase, ProfileStats *stats);
+
+/**
+ * @brief एक line का summary बनाता है (window title के लिए)
+ *
+ * Format: "frame 52.1 ms (p99 55.0) | events 0.02 | clear 0.10 | ... |
+ * sim 12.40 ms/38 gens" (हर phase और simulator stepping का per-frame avg)।
+ *
+ * @param profiler profiler
+ * @param buffer output buffer
+ * @param size buffer का size
+ * @return सफल होने पर 0, कोई frame न हो या NULL pointer होने पर -1
+ */
+int profiler_format_summary(const Profiler *profiler, char *buffer, size_t size);
+
+/**
+ * @brief सभी phases की min/avg/p99/max table stdout पर print करता है
+ * @param profiler profiler (NULL = कुछ नहीं)
+ */
+void profiler_print_summary(const Profiler *profiler);
+
+/**
+ * @brief stored frames CSV में लिखता है (एक row प्रति frame, ms में)
+ *
+ * Columns: frame, फिर हर phase का "<name>_ms", आखिर में "sim_gens" (count)।
+ *
+ * @param profiler profiler
+ * @param filename CSV file का नाम
+ * @return सफल होने पर 0, file error या NULL pointer होने पर -1
+ */
+int profiler_write_csv(const Profiler *profiler, const char *filename);
+
+#endif // PROFILE_H
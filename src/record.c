@@ -0,0 +1,443 @@
+/**
+ * @file record.c
+ * @brief Generations को background thread पर file में dump करने वाले recorder का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Queue PackedBoard slots का ring है, एक mutex और दो condition variables
+ * (frame आया / slot खाली हुआ) के साथ। Producer lock के अंदर सिर्फ slot
+ * reserve और publish करता है; packing lock के बाहर होती है, और encoder
+ * भी slot को lock के बाहर पढ़ता है, इसलिए lock बहुत कम देर रहता है।
+ *
+ * Delta encoder पिछला frame अपने पास एक PackedBoard में रखता है। Frame
+ * encode होने के बाद वो slot के साथ pointer swap होता है, इसलिए पिछले
+ * frame की कोई copy नहीं बनती।
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <ctype.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "packed_board.h"
+#include "record.h"
+
+/**
+ * @brief Delta header का size bytes में (magic, version, reserved, height, width)
+ */
+#define RECORD_HEADER_SIZE 32
+
+/**
+ * @brief Frame header का size bytes में (generation, payload size)
+ */
+#define RECORD_FRAME_HEADER_SIZE 16
+
+/**
+ * @brief एक LEB128 varint (uint64_t) की maximum bytes
+ */
+#define RECORD_VARINT_MAX 10
+
+/**
+ * @brief Recorder का पूरा state
+ */
+struct Recorder {
+    pthread_t thread;               /**< Encoder thread */
+    int running;                    /**< Thread चल रहा है (join बाकी है) */
+
+    pthread_mutex_t lock;           /**< head, count, quit और dropped को protect करता है */
+    pthread_cond_t ready;           /**< Queue में नया frame आने या quit पर signal */
+    pthread_cond_t space;           /**< Slot खाली होने पर signal */
+    PackedBoard **slots;            /**< Queue के frames */
+    uint64_t *generations;          /**< हर slot की generation */
+    size_t capacity;                /**< Slots की संख्या */
+    size_t head;                    /**< सबसे पुराना queued slot */
+    size_t count;                   /**< Queued frames */
+    int quit;                       /**< Queue खाली करके thread को रुकना है */
+    uint64_t dropped;               /**< Drop policy से छोड़े गए frames */
+    int failed;                     /**< Write error (atomic) */
+
+    RecordFormat format;            /**< Output format */
+    RecordPolicy policy;            /**< Queue भरी होने पर policy */
+    size_t height;                  /**< बोर्ड की ऊंचाई */
+    size_t width;                   /**< बोर्ड की चौड़ाई */
+    uint64_t every;                 /**< हर कितनी generations पर frame */
+
+    // नीचे के fields सिर्फ encoder thread के हैं
+    FILE *file;                     /**< Output file */
+    PackedBoard *previous;          /**< Delta: पिछला लिखा frame (शुरू में सभी मृत) */
+    uint8_t *delta;                 /**< Delta: पिछले frame से XOR के bytes */
+    uint8_t *payload;               /**< Delta payload या Y4M row का buffer */
+    uint64_t frames;                /**< लिखे गए frames */
+    uint64_t bytes;                 /**< लिखे गए bytes */
+};
+
+/**
+ * @brief little-endian में n bytes लिखता है
+ * @param p destination
+ * @param value लिखने वाली value
+ * @param n bytes की संख्या
+ */
+static void put_le(uint8_t *p, uint64_t value, int n) {
+    for (int i = 0; i < n; i++) {
+        p[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+/**
+ * @brief LEB128 varint लिखता है
+ * @param out destination (कम से कम RECORD_VARINT_MAX bytes)
+ * @param value लिखने वाली value
+ * @return varint के बाद की position
+ */
+static uint8_t *put_varint(uint8_t *out, uint64_t value) {
+    while (value >= 0x80) {
+        *out++ = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = (uint8_t)value;
+    return out;
+}
+
+/**
+ * @brief file में bytes लिखता है और गिनता है
+ * @param recorder recorder
+ * @param data bytes
+ * @param size bytes की संख्या
+ * @return सफल होने पर 0, write error पर -1
+ */
+static int record_write(Recorder *recorder, const void *data, size_t size) {
+    if (fwrite(data, 1, size, recorder->file) != size) return -1;
+    recorder->bytes += size;
+    return 0;
+}
+
+/**
+ * @brief frame का delta (पिछले frame से XOR, runs में) लिखता है
+ *
+ * पहले पूरा XOR stream little-endian bytes में बनता है, फिर उस पर runs।
+ * Zero bytes के runs जहाँ हो सके पूरे words में skip होते हैं। Literal
+ * run तब तक चलता है जब तक कम से कम दो zero bytes लगातार न आएं; एक
+ * अकेला zero byte literal में रखना नया run शुरू करने से सस्ता है।
+ *
+ * @param recorder recorder
+ * @param frame नया frame
+ * @param generation frame की generation
+ * @return सफल होने पर 0, write error पर -1
+ */
+static int record_write_delta(Recorder *recorder, const PackedBoard *frame, uint64_t generation) {
+    const uint64_t *cur = frame->words, *prev = recorder->previous->words;
+    const size_t words = frame->words_per_row * frame->height, n = words * sizeof(uint64_t);
+    uint8_t *delta = recorder->delta, *out = recorder->payload;
+
+    for (size_t w = 0; w < words; w++) {
+        put_le(&delta[w * 8], cur[w] ^ prev[w], 8);
+    }
+
+    for (size_t i = 0; i < n;) {
+        size_t start = i;
+        while (i < n && delta[i] == 0) {
+            uint64_t chunk;
+            if (i % 8 == 0 && (memcpy(&chunk, &delta[i], 8), chunk == 0)) {
+                i += 8;
+            } else {
+                i++;
+            }
+        }
+        size_t zeros = i - start, literal = i;
+        while (i < n && (delta[i] != 0 || (i + 1 < n && delta[i + 1] != 0))) {
+            i++;
+        }
+
+        out = put_varint(out, zeros);
+        out = put_varint(out, i - literal);
+        memcpy(out, &delta[literal], i - literal);
+        out += i - literal;
+    }
+
+    uint8_t header[RECORD_FRAME_HEADER_SIZE];
+    size_t size = (size_t)(out - recorder->payload);
+    put_le(header, generation, 8);
+    put_le(header + 8, size, 8);
+    return record_write(recorder, header, sizeof(header)) == 0 &&
+           record_write(recorder, recorder->payload, size) == 0 ? 0 : -1;
+}
+
+/**
+ * @brief frame को Y4M video frame (एक pixel प्रति cell) के रूप में लिखता है
+ * @param recorder recorder
+ * @param frame frame
+ * @return सफल होने पर 0, write error पर -1
+ */
+static int record_write_y4m(Recorder *recorder, const PackedBoard *frame) {
+    if (record_write(recorder, "FRAME\n", 6) != 0) return -1;
+
+    uint8_t *pixels = recorder->payload;
+    for (size_t x = 0; x < frame->height; x++) {
+        const uint64_t *row = &frame->words[x * frame->words_per_row];
+        for (size_t y = 0; y < frame->width; y++) {
+            pixels[y] = (row[y / PACKED_WORD_BITS] >> (y % PACKED_WORD_BITS)) & 1 ? 255 : 0;
+        }
+        if (record_write(recorder, pixels, frame->width) != 0) return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief format का file header लिखता है
+ * @param recorder recorder
+ * @return सफल होने पर 0, write error पर -1
+ */
+static int record_write_header(Recorder *recorder) {
+    if (recorder->format == RECORD_FORMAT_Y4M) {
+        char header[128];
+        int size = snprintf(header, sizeof(header), "YUV4MPEG2 W%zu H%zu F30:1 Ip A1:1 Cmono\n",
+                            recorder->width, recorder->height);
+        return record_write(recorder, header, (size_t)size);
+    }
+
+    uint8_t header[RECORD_HEADER_SIZE] = {0};
+    memcpy(header, RECORD_MAGIC, 8);
+    put_le(header + 8, RECORD_VERSION, 4);
+    put_le(header + 16, recorder->height, 8);
+    put_le(header + 24, recorder->width, 8);
+    return record_write(recorder, header, sizeof(header));
+}
+
+/**
+ * @brief encoder thread: queue के frames क्रम से encode करके लिखता है
+ *
+ * Write error के बाद भी queue खाली की जाती है (frames लिखे नहीं जाते),
+ * ताकि block policy वाला producer हमेशा के लिए न रुके।
+ *
+ * @param arg recorder
+ * @return NULL
+ */
+static void *recorder_main(void *arg) {
+    Recorder *recorder = arg;
+
+    pthread_mutex_lock(&recorder->lock);
+    for (;;) {
+        while (recorder->count == 0 && !recorder->quit) {
+            pthread_cond_wait(&recorder->ready, &recorder->lock);
+        }
+        if (recorder->count == 0) break;
+        size_t slot = recorder->head;
+        pthread_mutex_unlock(&recorder->lock);
+
+        if (!__atomic_load_n(&recorder->failed, __ATOMIC_RELAXED)) {
+            PackedBoard *frame = recorder->slots[slot];
+            int status;
+            if (recorder->format == RECORD_FORMAT_Y4M) {
+                status = record_write_y4m(recorder, frame);
+            } else {
+                status = record_write_delta(recorder, frame, recorder->generations[slot]);
+                // यह frame अगले का base बनता है; पुराना base slot में reuse होता है
+                recorder->slots[slot] = recorder->previous;
+                recorder->previous = frame;
+            }
+            if (status != 0) {
+                __atomic_store_n(&recorder->failed, 1, __ATOMIC_RELAXED);
+            } else {
+                recorder->frames++;
+            }
+        }
+
+        pthread_mutex_lock(&recorder->lock);
+        recorder->head = (recorder->head + 1) % recorder->capacity;
+        recorder->count--;
+        pthread_cond_signal(&recorder->space);
+    }
+    pthread_mutex_unlock(&recorder->lock);
+    return NULL;
+}
+
+/**
+ * @brief filename के extension से format चुनता है (".y4m" = Y4M, बाकी delta)
+ * @param filename output file का नाम
+ * @return format
+ */
+RecordFormat record_format_for(const char *filename) {
+    size_t length = filename != NULL ? strlen(filename) : 0;
+    if (length < 4) return RECORD_FORMAT_DELTA;
+
+    const char *extension = filename + length - 4;
+    char lower[5];
+    for (int i = 0; i < 4; i++) {
+        lower[i] = (char)tolower((unsigned char)extension[i]);
+    }
+    lower[4] = '\0';
+    return strcmp(lower, ".y4m") == 0 ? RECORD_FORMAT_Y4M : RECORD_FORMAT_DELTA;
+}
+
+/**
+ * @brief recorder की memory free करता है (thread रुका हुआ या कभी start न हुआ हो)
+ * @param recorder recorder
+ */
+static void recorder_release(Recorder *recorder) {
+    for (size_t i = 0; recorder->slots != NULL && i < recorder->capacity; i++) {
+        if (recorder->slots[i] != NULL) packed_board_free(recorder->slots[i]);
+    }
+    if (recorder->previous != NULL) packed_board_free(recorder->previous);
+    free(recorder->slots);
+    free(recorder->generations);
+    free(recorder->delta);
+    free(recorder->payload);
+    pthread_mutex_destroy(&recorder->lock);
+    pthread_cond_destroy(&recorder->ready);
+    pthread_cond_destroy(&recorder->space);
+    free(recorder);
+}
+
+/**
+ * @brief output file खोलता है, header लिखता है और encoder thread start करता है
+ *
+ * Delta payload buffer worst case के लिए एक बार allocate होता है: हर run
+ * pair कम से कम तीन input bytes cover करता है (या frame का अंत है), इसलिए
+ * payload कभी frame के दोगुने bytes से बड़ा नहीं होता।
+ *
+ * @param config settings
+ * @return सफल होने पर Recorder pointer, invalid config, file, memory या thread error पर NULL
+ */
+Recorder *recorder_start(const RecorderConfig *config) {
+    if (config == NULL || config->filename == NULL || config->every <= 0) return NULL;
+    if (config->height == 0 || config->width == 0) return NULL;
+    if (config->format != RECORD_FORMAT_DELTA && config->format != RECORD_FORMAT_Y4M) return NULL;
+
+    Recorder *recorder = calloc(1, sizeof(Recorder));
+    if (recorder == NULL) return NULL;
+
+    pthread_mutex_init(&recorder->lock, NULL);
+    pthread_cond_init(&recorder->ready, NULL);
+    pthread_cond_init(&recorder->space, NULL);
+    recorder->format = config->format;
+    recorder->policy = config->policy;
+    recorder->height = config->height;
+    recorder->width = config->width;
+    recorder->every = (uint64_t)config->every;
+    recorder->capacity = config->queue > 0 ? config->queue : RECORD_DEFAULT_QUEUE;
+
+    recorder->slots = calloc(recorder->capacity, sizeof(PackedBoard *));
+    recorder->generations = calloc(recorder->capacity, sizeof(uint64_t));
+    if (recorder->slots == NULL || recorder->generations == NULL) goto fail;
+    for (size_t i = 0; i < recorder->capacity; i++) {
+        recorder->slots[i] = packed_board_init(config->height, config->width);
+        if (recorder->slots[i] == NULL) goto fail;
+    }
+
+    if (recorder->format == RECORD_FORMAT_Y4M) {
+        recorder->payload = malloc(config->width);
+    } else {
+        recorder->previous = packed_board_init(config->height, config->width);
+        if (recorder->previous == NULL) goto fail;
+        size_t frame_bytes = recorder->previous->words_per_row * config->height * sizeof(uint64_t);
+        recorder->delta = malloc(frame_bytes);
+        recorder->payload = malloc(2 * frame_bytes + 2 * RECORD_VARINT_MAX);
+        if (recorder->delta == NULL) goto fail;
+    }
+    if (recorder->payload == NULL) goto fail;
+
+    recorder->file = fopen(config->filename, "wb");
+    if (recorder->file == NULL) {
+        printf("Error opening recording: %s\n", config->filename);
+        goto fail;
+    }
+    if (record_write_header(recorder) != 0) {
+        printf("Error writing recording: %s\n", config->filename);
+        fclose(recorder->file);
+        goto fail;
+    }
+
+    if (pthread_create(&recorder->thread, NULL, recorder_main, recorder) != 0) {
+        fclose(recorder->file);
+        goto fail;
+    }
+    recorder->running = 1;
+    return recorder;
+
+fail:
+    recorder_release(recorder);
+    return NULL;
+}
+
+/**
+ * @brief previous से generation तक आगे बढ़ने पर frame record होना है या नहीं
+ *
+ * (previous, generation] में every का कोई multiple हो तो frame due है,
+ * इसलिए एक साथ कई generations की jumps (Hashlife) भी interval पर record होती हैं।
+ *
+ * @param recorder recorder (NULL हो सकता है)
+ * @param previous पिछली generation
+ * @param generation नई generation
+ * @return record होना है तो 1, वरना 0
+ */
+int recorder_due(const Recorder *recorder, uint64_t previous, uint64_t generation) {
+    return recorder != NULL && generation / recorder->every != previous / recorder->every;
+}
+
+/**
+ * @brief generation का frame queue में डालता है
+ *
+ * Reserve किया हुआ slot (head + count) encoder की range के बाहर है,
+ * इसलिए packing lock के बिना होती है; count बढ़ने पर ही encoder उसे देखता है।
+ *
+ * @param recorder recorder
+ * @param board बोर्ड (config जितना size)
+ * @param generation बोर्ड की generation
+ * @return queue हुआ तो 0, drop हुआ तो 1, size mismatch या encoder error पर -1
+ */
+int recorder_push(Recorder *recorder, const Board *board, uint64_t generation) {
+    if (recorder == NULL || board == NULL) return -1;
+    if (board->height != recorder->height || board->width != recorder->width) return -1;
+    if (__atomic_load_n(&recorder->failed, __ATOMIC_RELAXED)) return -1;
+
+    pthread_mutex_lock(&recorder->lock);
+    while (recorder->count == recorder->capacity) {
+        if (recorder->policy == RECORD_DROP) {
+            recorder->dropped++;
+            pthread_mutex_unlock(&recorder->lock);
+            return 1;
+        }
+        pthread_cond_wait(&recorder->space, &recorder->lock);
+    }
+    size_t slot = (recorder->head + recorder->count) % recorder->capacity;
+    pthread_mutex_unlock(&recorder->lock);
+
+    packed_board_from_board(recorder->slots[slot], board);
+    recorder->generations[slot] = generation;
+
+    pthread_mutex_lock(&recorder->lock);
+    recorder->count++;
+    pthread_cond_signal(&recorder->ready);
+    pthread_mutex_unlock(&recorder->lock);
+    return 0;
+}
+
+/**
+ * @brief queue के बचे frames लिखता है, thread रोकता है, file बंद करता है और memory free करता है
+ * @param recorder recorder (NULL हो सकता है)
+ * @param stats summary store करने के लिए pointer (NULL हो सकता है)
+ * @return सफल होने पर 0, कोई write error हुआ हो तो -1
+ */
+int recorder_close(Recorder *recorder, RecorderStats *stats) {
+    if (recorder == NULL) return 0;
+
+    pthread_mutex_lock(&recorder->lock);
+    recorder->quit = 1;
+    pthread_cond_signal(&recorder->ready);
+    pthread_mutex_unlock(&recorder->lock);
+    if (recorder->running) pthread_join(recorder->thread, NULL);
+
+    int status = recorder->failed ? -1 : 0;
+    if (fclose(recorder->file) != 0) status = -1;
+    if (stats != NULL) {
+        stats->frames = recorder->frames;
+        stats->dropped = recorder->dropped;
+        stats->bytes = recorder->bytes;
+    }
+
+    recorder_release(recorder);
+    return status;
+}
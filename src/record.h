@@ -0,0 +1,147 @@
+/**
+ * @file record.h
+ * @brief Generations को background thread पर file में dump करने वाले recorder का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Stepping thread हर k-th generation recorder_push से देता है: बोर्ड एक
+ * bounded queue के slot में bit-packed copy होता है (PackedBoard, 1 bit
+ * प्रति cell) और encoding व file I/O recorder के अपने thread पर होते हैं।
+ * Queue भरी हो तो policy तय करती है कि frame छोड़ा जाए (drop, stepping
+ * कभी नहीं रुकती) या encoder के slot खाली करने तक रुका जाए (block, कोई
+ * frame नहीं छूटता)।
+ *
+ * Formats:
+ *
+ * - Delta (RECORD_MAGIC): header magic[8], version u32, reserved u32,
+ *   height u64, width u64। फिर हर frame: generation u64, payload size
+ *   u64, payload। Payload पिछले frame (पहले frame के लिए सभी मृत) से XOR
+ *   किए हुए packed words हैं (हर row ceil(width / 64) words, हर word
+ *   little-endian bytes), runs में: zero bytes की संख्या (varint), फिर
+ *   literal bytes की संख्या (varint) और वो bytes, पूरे frame के bytes तक।
+ *   Varints LEB128 हैं और सभी numbers little-endian। Stable या sparse
+ *   boards के frames कुछ bytes के होते हैं।
+ * - Y4M: उसी size का grayscale (Cmono) video, हर cell एक pixel (जीवित
+ *   255, मृत 0), 30 fps। ffmpeg और ज्यादातर players सीधे पढ़ते हैं। Frames
+ *   में generation number नहीं है, इसलिए drop होने पर बीच के frames बस
+ *   नहीं होते।
+ *
+ * Generations rules में dying states भी जीवित लिखी जाती हैं।
+ */
+
+#ifndef RECORD_H
+#define RECORD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "board.h"
+
+/**
+ * @brief Delta stream file की पहली 8 bytes
+ */
+#define RECORD_MAGIC "GOLDELT1"
+
+/**
+ * @brief Delta stream format का version
+ */
+#define RECORD_VERSION 1
+
+/**
+ * @brief Queue के default slots (frames)
+ */
+#define RECORD_DEFAULT_QUEUE 8
+
+/**
+ * @brief Output file का format
+ */
+typedef enum {
+    RECORD_FORMAT_DELTA = 0,    /**< XOR deltas, run-length compressed */
+    RECORD_FORMAT_Y4M = 1       /**< Grayscale YUV4MPEG2 video */
+} RecordFormat;
+
+/**
+ * @brief Queue भरी होने पर क्या करें
+ */
+typedef enum {
+    RECORD_BLOCK = 0,           /**< Slot खाली होने तक stepping thread रुके */
+    RECORD_DROP = 1             /**< Frame छोड़ दें (dropped में गिना जाता है) */
+} RecordPolicy;
+
+/**
+ * @brief Recorder की settings
+ */
+typedef struct RecorderConfig {
+    const char *filename;       /**< Output file */
+    RecordFormat format;        /**< Output format */
+    size_t height;              /**< बोर्ड की ऊंचाई */
+    size_t width;               /**< बोर्ड की चौड़ाई */
+    long every;                 /**< हर कितनी generations पर एक frame (देखें recorder_due) */
+    size_t queue;               /**< Queue के slots (0 = RECORD_DEFAULT_QUEUE) */
+    RecordPolicy policy;        /**< Queue भरी होने पर policy */
+} RecorderConfig;
+
+/**
+ * @brief Recording का summary (recorder_close भरता है)
+ */
+typedef struct RecorderStats {
+    uint64_t frames;            /**< File में लिखे frames */
+    uint64_t dropped;           /**< Queue भरी होने से छोड़े गए frames */
+    uint64_t bytes;             /**< File के कुल bytes */
+} RecorderStats;
+
+/**
+ * @brief Opaque recorder (queue, encoder thread और output file)
+ */
+typedef struct Recorder Recorder;
+
+/**
+ * @brief filename के extension से format चुनता है (".y4m" = Y4M, बाकी delta)
+ * @param filename output file का नाम
+ * @return format
+ */
+RecordFormat record_format_for(const char *filename);
+
+/**
+ * @brief output file खोलता है, header लिखता है और encoder thread start करता है
+ * @param config settings
+ * @return सफल होने पर Recorder pointer, invalid config, file, memory या thread error पर NULL
+ */
+Recorder *recorder_start(const RecorderConfig *config);
+
+/**
+ * @brief previous से generation तक आगे बढ़ने पर frame record होना है या नहीं
+ *
+ * (previous, generation] में every का कोई multiple हो तो frame due है,
+ * इसलिए एक साथ कई generations की jumps (Hashlife) भी interval पर record होती हैं।
+ *
+ * @param recorder recorder (NULL हो सकता है)
+ * @param previous पिछली generation
+ * @param generation नई generation
+ * @return record होना है तो 1, वरना 0
+ */
+int recorder_due(const Recorder *recorder, uint64_t previous, uint64_t generation);
+
+/**
+ * @brief generation का frame queue में डालता है
+ *
+ * Caller recorder_due से तय करता है कि frame चाहिए या नहीं। सिर्फ एक
+ * thread push कर सकता है। Stepping thread पर काम सिर्फ बोर्ड की packed
+ * copy है; block policy पर queue भरी हो तो slot खाली होने तक रुकता है।
+ *
+ * @param recorder recorder
+ * @param board बोर्ड (config जितना size)
+ * @param generation बोर्ड की generation
+ * @return queue हुआ तो 0, drop हुआ तो 1, size mismatch या encoder error पर -1
+ */
+int recorder_push(Recorder *recorder, const Board *board, uint64_t generation);
+
+/**
+ * @brief queue के बचे frames लिखता है, thread रोकता है, file बंद करता है और memory free करता है
+ * @param recorder recorder (NULL हो सकता है)
+ * @param stats summary store करने के लिए pointer (NULL हो सकता है)
+ * @return सफल होने पर 0, कोई write error हुआ हो तो -1
+ */
+int recorder_close(Recorder *recorder, RecorderStats *stats);
+
+#endif // RECORD_H
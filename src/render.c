@@ -0,0 +1,243 @@
+/**
+ * @file render.c
+ * @brief Texture-streamed बोर्ड renderer का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Visible cells एक CPU-side pixel buffer में लिखे जाते हैं (सिर्फ बदली हुई
+ * tiles), फिर उनका bounding rectangle SDL_UpdateTexture से upload होता है
+ * और SDL_RenderCopy texture को zoom के अनुसार scale करके draw करता है।
+ * Scaling nearest-neighbor है ताकि cells के किनारे sharp रहें।
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "render.h"
+
+/**
+ * @brief Viewport में कितनी rows/columns दिखती हैं
+ *
+ * @param pixels window की dimension pixels में
+ * @param zoom प्रति cell pixels
+ * @return visible cells की संख्या (आखिरी partial cell सहित)
+ */
+long render_visible_cells(int pixels, int zoom) {
+    if (zoom < 1) zoom = 1;
+    return (pixels + zoom - 1) / zoom;
+}
+
+/**
+ * @brief नया board renderer और उसकी streaming texture create करता है
+ *
+ * @param renderer SDL renderer
+ * @param window_width window की चौड़ाई pixels में
+ * @param window_height window की ऊंचाई pixels में
+ * @return सफल होने पर BoardRenderer pointer, error होने पर NULL
+ */
+BoardRenderer *board_renderer_init(SDL_Renderer *renderer, int window_width, int window_height) {
+    if (renderer == NULL || window_width <= 0 || window_height <= 0) return NULL;
+
+    BoardRenderer *view = malloc(sizeof(BoardRenderer));
+    if (!view) return NULL;
+
+    // Zoom के समय cells blur न हों
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "0");
+
+    view->renderer = renderer;
+    view->texture_width = window_width;
+    view->texture_height = window_height;
+    view->drawn_stamp = NULL;
+    view->drawn_tiles = 0;
+    view->drawn_height = 0;
+    view->drawn_width = 0;
+    view->drawn_row = -1;
+    view->drawn_col = -1;
+    view->drawn_zoom = 0;
+    view->pixels = malloc((size_t)window_width * (size_t)window_height * sizeof(uint32_t));
+    view->texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                      SDL_TEXTUREACCESS_STREAMING,
+                                      window_width, window_height);
+    if (!view->texture || !view->pixels) {
+        if (view->texture) SDL_DestroyTexture(view->texture);
+        free(view->pixels);
+        free(view);
+        return NULL;
+    }
+
+    return view;
+}
+
+/**
+ * @brief renderer की texture और memory free करता है
+ *
+ * @param view free करने वाला renderer
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int board_renderer_free(BoardRenderer *view) {
+    if (view == NULL) return -1;
+
+    if (view->texture) SDL_DestroyTexture(view->texture);
+    free(view->pixels);
+    free(view->drawn_stamp);
+    free(view);
+    return 0;
+}
+
+/**
+ * @brief viewport बदलने पर सभी tiles को "draw नहीं हुई" mark करता है
+ *
+ * @param view board renderer
+ * @param board draw करने वाला board
+ * @param state current game state (viewport)
+ * @return सफल होने पर 0, memory allocation fail होने पर -1
+ */
+static int renderer_sync_view(BoardRenderer *view, Board *board, State *state) {
+    size_t tiles = board->tile_rows * board->tile_cols;
+    
+    if (tiles != view->drawn_tiles) {
+        uint64_t *stamps = realloc(view->drawn_stamp, (tiles ? tiles : 1) * sizeof(uint64_t));
+        if (!stamps) return -1;
+        view->drawn_stamp = stamps;
+        view->drawn_tiles = tiles;
+    } else if (board->height == view->drawn_height && board->width == view->drawn_width &&
+               state->view_row == view->drawn_row && state->view_col == view->drawn_col &&
+               state->zoom == view->drawn_zoom) {
+        return 0;
+    }
+    
+    // Stamps 1 से शुरू होते हैं, इसलिए 0 किसी tile से match नहीं करता
+    for (size_t i = 0; i < tiles; i++) {
+        view->drawn_stamp[i] = 0;
+    }
+    view->drawn_height = board->height;
+    view->drawn_width = board->width;
+    view->drawn_row = state->view_row;
+    view->drawn_col = state->view_col;
+    view->drawn_zoom = state->zoom;
+    return 0;
+}
+
+/**
+ * @brief check करता है कि board_draw से screen पर कुछ बदलेगा या नहीं
+ *
+ * Viewport, zoom या बोर्ड size पिछली draw से अलग हो, या किसी visible tile
+ * का stamp उस stamp से अलग हो जो आखिरी बार draw हुआ, तो draw pending है।
+ * सिर्फ visible tiles के stamps पढ़े जाते हैं, कोई cell नहीं।
+ *
+ * @param view board renderer
+ * @param board draw करने वाला board
+ * @param state current game state (viewport)
+ * @return draw करना है तो 1, screen पहले से up to date है तो 0
+ */
+int board_draw_pending(const BoardRenderer *view, const Board *board, const State *state) {
+    if (view == NULL || board == NULL || state == NULL) return 1;
+    if (board->tile_rows * board->tile_cols != view->drawn_tiles || board->height != view->drawn_height ||
+        board->width != view->drawn_width || state->view_row != view->drawn_row ||
+        state->view_col != view->drawn_col || state->zoom != view->drawn_zoom) {
+        return 1;
+    }
+
+    long rows = render_visible_cells(state->window_height, state->zoom);
+    long cols = render_visible_cells(state->window_width, state->zoom);
+    if (rows > (long)board->height - state->view_row) rows = (long)board->height - state->view_row;
+    if (cols > (long)board->width - state->view_col) cols = (long)board->width - state->view_col;
+    if (rows > view->texture_height) rows = view->texture_height;
+    if (cols > view->texture_width) cols = view->texture_width;
+    if (rows <= 0 || cols <= 0) return 0;
+
+    size_t row0 = (size_t)state->view_row, col0 = (size_t)state->view_col;
+    size_t tile_x_end = (row0 + (size_t)rows - 1) / BOARD_TILE_SIZE + 1;
+    size_t tile_y_end = (col0 + (size_t)cols - 1) / BOARD_TILE_SIZE + 1;
+    for (size_t tx = row0 / BOARD_TILE_SIZE; tx < tile_x_end; tx++) {
+        for (size_t ty = col0 / BOARD_TILE_SIZE; ty < tile_y_end; ty++) {
+            size_t tile = tx * board->tile_cols + ty;
+            if (view->drawn_stamp[tile] != board->tile_stamp[tile]) return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief board का viewport वाला हिस्सा screen पर draw करता है
+ *
+ * Visible rows/columns texture के top-left हिस्से में जाती हैं (एक texel
+ * प्रति cell, बिना branch के color select)। जिन visible tiles का stamp
+ * पिछली draw से अलग है सिर्फ वही pixel buffer में फिर से लिखी जाती हैं,
+ * और हर tile row की बदली tiles का bounding rectangle एक SDL_UpdateTexture
+ * में upload होता है (बोर्ड के दो दूर के कोनों पर paint करने से बीच का
+ * पूरा हिस्सा upload नहीं होता)।
+ * फिर एक SDL_RenderCopy उस हिस्से को zoom गुना scale करके draw करता है।
+ *
+ * @param view board renderer
+ * @param board draw करने वाला board
+ * @param state current game state (viewport)
+ * @return सफल होने पर 0, error होने पर -1
+ */
+int board_draw(BoardRenderer *view, Board *board, State *state) {
+    if (view == NULL || board == NULL || state == NULL) return -1;
+    if (state->view_row < 0 || state->view_col < 0) return -1;
+
+    long rows = render_visible_cells(state->window_height, state->zoom);
+    long cols = render_visible_cells(state->window_width, state->zoom);
+    if (rows > (long)board->height - state->view_row) rows = (long)board->height - state->view_row;
+    if (cols > (long)board->width - state->view_col) cols = (long)board->width - state->view_col;
+    if (rows > view->texture_height) rows = view->texture_height;
+    if (cols > view->texture_width) cols = view->texture_width;
+    if (rows <= 0 || cols <= 0) return 0;
+
+    if (renderer_sync_view(view, board, state) != 0) return -1;
+
+    // Visible tiles की range
+    size_t row0 = (size_t)state->view_row, col0 = (size_t)state->view_col;
+    size_t tile_x_end = (row0 + (size_t)rows - 1) / BOARD_TILE_SIZE + 1;
+    size_t tile_y_end = (col0 + (size_t)cols - 1) / BOARD_TILE_SIZE + 1;
+    const size_t pitch = (size_t)view->texture_width;
+
+    for (size_t tx = row0 / BOARD_TILE_SIZE; tx < tile_x_end; tx++) {
+        // इस tile row का upload rectangle (texture coordinates में)
+        long dirty_x0 = rows, dirty_y0 = cols, dirty_x1 = 0, dirty_y1 = 0;
+
+        for (size_t ty = col0 / BOARD_TILE_SIZE; ty < tile_y_end; ty++) {
+            size_t tile = tx * board->tile_cols + ty;
+            uint64_t stamp = board->tile_stamp[tile];
+            if (view->drawn_stamp[tile] == stamp) continue;
+            view->drawn_stamp[tile] = stamp;
+
+            // Tile का visible हिस्सा (texture coordinates में)
+            long x0 = (long)(tx * BOARD_TILE_SIZE) - state->view_row;
+            long y0 = (long)(ty * BOARD_TILE_SIZE) - state->view_col;
+            long x1 = x0 + BOARD_TILE_SIZE, y1 = y0 + BOARD_TILE_SIZE;
+            if (x0 < 0) x0 = 0;
+            if (y0 < 0) y0 = 0;
+            if (x1 > rows) x1 = rows;
+            if (y1 > cols) y1 = cols;
+
+            for (long x = x0; x < x1; x++) {
+                const char *row = &board->cells[BOARD_INDEX(board, row0 + (size_t)x, col0)];
+                uint32_t *dst = &view->pixels[(size_t)x * pitch];
+                for (long y = y0; y < y1; y++) {
+                    // मृत = सिर्फ alpha, जीवित (state 1) = सभी channels; Generations की dying states मृत दिखती हैं
+                    dst[y] = RENDER_DEAD_COLOR | ((RENDER_ALIVE_COLOR ^ RENDER_DEAD_COLOR) & (0u - (uint32_t)(row[y] == 1)));
+                }
+            }
+
+            if (x0 < dirty_x0) dirty_x0 = x0;
+            if (y0 < dirty_y0) dirty_y0 = y0;
+            if (x1 > dirty_x1) dirty_x1 = x1;
+            if (y1 > dirty_y1) dirty_y1 = y1;
+        }
+
+        if (dirty_x0 < dirty_x1 && dirty_y0 < dirty_y1) {
+            SDL_Rect dirty = { (int)dirty_y0, (int)dirty_x0, (int)(dirty_y1 - dirty_y0), (int)(dirty_x1 - dirty_x0) };
+            const uint32_t *first = &view->pixels[(size_t)dirty_x0 * pitch + (size_t)dirty_y0];
+            if (SDL_UpdateTexture(view->texture, &dirty, first, (int)(pitch * sizeof(uint32_t))) != 0) {
+                return -1;
+            }
+        }
+    }
+
+    SDL_Rect src = { 0, 0, (int)cols, (int)rows };
+    SDL_Rect dst = { 0, 0, (int)cols * state->zoom, (int)rows * state->zoom };
+    return SDL_RenderCopy(view->renderer, view->texture, &src, &dst) == 0 ? 0 : -1;
+}
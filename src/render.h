@@ -0,0 +1,109 @@
+/**
+ * @file render.h
+ * @brief Texture-streamed बोर्ड renderer का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Renderer हर cell के लिए SDL_RenderFillRect call करने के बजाय viewport की
+ * cells को एक streaming SDL_Texture में (एक texel प्रति cell) लिखता है और
+ * फिर एक SDL_RenderCopy से GPU पर zoom के अनुसार scale करता है। इसलिए
+ * प्रति frame ज्यादा से ज्यादा एक upload और एक draw call होती है।
+ *
+ * Upload सिर्फ उन tiles (BOARD_TILE_SIZE) का होता है जिनका stamp पिछली
+ * draw के बाद बदला है; stable बोर्ड पर कोई texel upload नहीं होता, और
+ * board_draw_pending से caller ऐसे frames का draw और present पूरी तरह
+ * skip कर सकता है।
+ */
+
+#ifndef RENDER_H
+#define RENDER_H
+
+#include <stdint.h>
+#include <SDL2/SDL.h>
+
+#include "board.h"
+#include "state.h"
+
+/**
+ * @brief जीवित cell का color (ARGB8888)
+ */
+#define RENDER_ALIVE_COLOR 0xFFFFFFFFu
+
+/**
+ * @brief मृत cell का color (ARGB8888)
+ */
+#define RENDER_DEAD_COLOR 0xFF000000u
+
+/**
+ * @brief Texture-streamed renderer का state
+ */
+typedef struct BoardRenderer {
+    SDL_Renderer *renderer;   /**< Target SDL renderer (owned नहीं) */
+    SDL_Texture *texture;     /**< Streaming texture, एक texel प्रति visible cell */
+    int texture_width;        /**< Texture की चौड़ाई texels में (zoom 1 पर visible columns) */
+    int texture_height;       /**< Texture की ऊंचाई texels में (zoom 1 पर visible rows) */
+    uint32_t *pixels;         /**< Texture का CPU copy (dirty tiles इसमें लिखकर upload होती हैं) */
+    uint64_t *drawn_stamp;    /**< हर tile का stamp जो आखिरी बार draw हुआ (0 = कभी नहीं) */
+    size_t drawn_tiles;       /**< drawn_stamp में tiles की संख्या */
+    size_t drawn_height;      /**< आखिरी draw वाले बोर्ड की ऊंचाई */
+    size_t drawn_width;       /**< आखिरी draw वाले बोर्ड की चौड़ाई */
+    long drawn_row;           /**< आखिरी draw का view_row */
+    long drawn_col;           /**< आखिरी draw का view_col */
+    int drawn_zoom;           /**< आखिरी draw का zoom */
+} BoardRenderer;
+
+/**
+ * @brief Viewport में कितनी rows/columns दिखती हैं (आखिरी partial cell सहित)
+ * @param pixels window की dimension pixels में
+ * @param zoom प्रति cell pixels
+ * @return visible cells की संख्या
+ */
+long render_visible_cells(int pixels, int zoom);
+
+/**
+ * @brief नया board renderer और उसकी streaming texture create करता है
+ *
+ * Texture window size (pixels) की होती है ताकि zoom 1 पर भी पूरा viewport
+ * उसमें आ जाए; बड़े zoom पर उसका सिर्फ top-left हिस्सा use होता है।
+ *
+ * @param renderer SDL renderer
+ * @param window_width window की चौड़ाई pixels में
+ * @param window_height window की ऊंचाई pixels में
+ * @return सफल होने पर BoardRenderer pointer, error होने पर NULL
+ */
+BoardRenderer *board_renderer_init(SDL_Renderer *renderer, int window_width, int window_height);
+
+/**
+ * @brief renderer की texture और memory free करता है
+ * @param view free करने वाला renderer
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int board_renderer_free(BoardRenderer *view);
+
+/**
+ * @brief check करता है कि board_draw से screen पर कुछ बदलेगा या नहीं
+ *
+ * Viewport या कोई visible tile पिछली draw के बाद बदली हो तो 1। Window
+ * expose/resize जैसे events caller को अलग से देखने होते हैं।
+ *
+ * @param view board renderer
+ * @param board draw करने वाला board
+ * @param state current game state (viewport)
+ * @return draw करना है तो 1 (NULL pointer पर भी), screen up to date है तो 0
+ */
+int board_draw_pending(const BoardRenderer *view, const Board *board, const State *state);
+
+/**
+ * @brief board का viewport वाला हिस्सा texture में लिखकर screen पर draw करता है
+ *
+ * Viewport, zoom या बोर्ड size बदलने पर पूरा viewport फिर से लिखा जाता है,
+ * वरना सिर्फ बदली हुई tiles।
+ *
+ * @param view board renderer
+ * @param board draw करने वाला board
+ * @param state current game state (viewport)
+ * @return सफल होने पर 0, error होने पर -1
+ */
+int board_draw(BoardRenderer *view, Board *board, State *state);
+
+#endif // RENDER_H
@@ -0,0 +1,112 @@
+/**
+ * @file rng.c
+ * @brief Random boards के लिए seeded, counter-based random cells का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rng.h"
+
+/**
+ * @brief splitmix64 stream का increment (golden ratio)
+ */
+#define RNG_GOLDEN 0x9e3779b97f4a7c15ULL
+
+/**
+ * @brief 64-bit value को mix करता है (splitmix64 का finalizer)
+ * @param value input
+ * @return mixed value
+ */
+static inline uint64_t rng_mix(uint64_t value) {
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+/**
+ * @brief row की stream key
+ * @param seed board का seed
+ * @param row board की row
+ * @return key
+ */
+static inline uint64_t rng_row_key(uint64_t seed, uint64_t row) {
+    return rng_mix(seed ^ rng_mix(row + RNG_GOLDEN));
+}
+
+/**
+ * @brief row key से एक word के 64 cells बनाता है
+ * @param fill settings
+ * @param key row की key
+ * @param word row में word का index
+ * @return 64 cells के bits
+ */
+static inline uint64_t rng_word(const RngFill *fill, uint64_t key, uint64_t word) {
+    if (fill->threshold == 0) return 0;
+    if (fill->threshold >= (uint32_t)1 << RNG_DENSITY_BITS) return ~(uint64_t)0;
+
+    uint64_t counter = key + word * RNG_DENSITY_BITS * RNG_GOLDEN;
+    uint64_t result = 0;
+    for (int bit = fill->first_bit; bit < RNG_DENSITY_BITS; bit++) {
+        uint64_t random = rng_mix(counter + (uint64_t)(bit + 1) * RNG_GOLDEN);
+        result = (fill->threshold >> bit) & 1 ? result | random : result & random;
+    }
+    return result;
+}
+
+/**
+ * @brief seed और density से fill settings बनाता है
+ * @param fill settings store करने के लिए pointer
+ * @param seed board का seed
+ * @param density जीवित cells का fraction (0 से 1)
+ * @return सफल होने पर 0, NULL pointer या density range के बाहर होने पर -1
+ */
+int rng_fill_init(RngFill *fill, uint64_t seed, double density) {
+    // NaN भी यहीं reject होता है
+    if (fill == NULL || !(density >= 0.0 && density <= 1.0)) return -1;
+
+    fill->seed = seed;
+    fill->threshold = (uint32_t)(density * (double)((uint32_t)1 << RNG_DENSITY_BITS) + 0.5);
+    fill->first_bit = 0;
+    while (fill->first_bit < RNG_DENSITY_BITS && !((fill->threshold >> fill->first_bit) & 1)) {
+        fill->first_bit++;
+    }
+    return 0;
+}
+
+/**
+ * @brief row के एक word के 64 cells देता है (bit k = column 64 * word + k)
+ * @param fill settings
+ * @param row board की row (distributed runs में global row)
+ * @param word row में word का index
+ * @return 64 cells के bits
+ */
+uint64_t rng_fill_word(const RngFill *fill, uint64_t row, uint64_t word) {
+    return rng_word(fill, rng_row_key(fill->seed, row), word);
+}
+
+/**
+ * @brief packed rows भरता है (PackedBoard का layout, width के बाद के bits 0)
+ * @param fill settings
+ * @param words पहली row का पहला word
+ * @param words_per_row हर row के words
+ * @param width row के cells
+ * @param first_row words की पहली row की board row
+ * @param rows कितनी rows
+ */
+void rng_fill_rows(const RngFill *fill, uint64_t *words, size_t words_per_row, size_t width,
+                   uint64_t first_row, size_t rows) {
+    size_t used = (width + 63) / 64;
+    uint64_t last_mask = width % 64 != 0 ? ((uint64_t)1 << (width % 64)) - 1 : ~(uint64_t)0;
+
+    for (size_t x = 0; x < rows; x++) {
+        uint64_t key = rng_row_key(fill->seed, first_row + x);
+        uint64_t *row = &words[x * words_per_row];
+        for (size_t w = 0; w < words_per_row; w++) {
+            row[w] = w < used ? rng_word(fill, key, w) : 0;
+        }
+        if (used > 0) row[used - 1] &= last_mask;
+    }
+}
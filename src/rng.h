@@ -0,0 +1,76 @@
+/**
+ * @file rng.h
+ * @brief Random boards के लिए seeded, counter-based random cells का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * कोई generator state नहीं है: row x के word w (cells 64w से 64w + 63) के
+ * bits सिर्फ (seed, x, w) से बनते हैं। हर row की एक key होती है और word
+ * के random numbers उस key वाली splitmix64 stream की positions
+ * w * RNG_DENSITY_BITS, ... हैं, जिन्हें सीधे निकाला जा सकता है। इसलिए
+ * rows किसी भी क्रम में या कितने भी threads पर भरें, same seed और
+ * density हमेशा same board देते हैं।
+ *
+ * Density RNG_DENSITY_BITS bits की precision पर threshold t है (density
+ * t / 2^16)। t के bits lowest से शुरू करके हर random word r के साथ
+ * result = bit ? (result | r) : (result & r) होता है; हर step के बाद हर
+ * bit के जीवित होने का chance t के उतने bits वाले fraction जितना है, इसलिए
+ * एक word के 64 cells एक साथ बनते हैं (cell प्रति random byte की जगह)।
+ */
+
+#ifndef RNG_H
+#define RNG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Density की precision (bits); हर word के ज्यादा से ज्यादा इतने random numbers
+ */
+#define RNG_DENSITY_BITS 16
+
+/**
+ * @brief Random boards की default density (जीवित cells का fraction)
+ */
+#define RNG_DEFAULT_DENSITY 0.2
+
+/**
+ * @brief एक random board की settings (rng_fill_init बनाता है)
+ */
+typedef struct RngFill {
+    uint64_t seed;          /**< Board का seed */
+    uint32_t threshold;     /**< density * 2^RNG_DENSITY_BITS, rounded (0 से 2^RNG_DENSITY_BITS) */
+    int first_bit;          /**< threshold का lowest set bit (उससे नीचे के steps का result 0 है) */
+} RngFill;
+
+/**
+ * @brief seed और density से fill settings बनाता है
+ * @param fill settings store करने के लिए pointer
+ * @param seed board का seed
+ * @param density जीवित cells का fraction (0 से 1)
+ * @return सफल होने पर 0, NULL pointer या density range के बाहर होने पर -1
+ */
+int rng_fill_init(RngFill *fill, uint64_t seed, double density);
+
+/**
+ * @brief row के एक word के 64 cells देता है (bit k = column 64 * word + k)
+ * @param fill settings
+ * @param row board की row (distributed runs में global row)
+ * @param word row में word का index
+ * @return 64 cells के bits
+ */
+uint64_t rng_fill_word(const RngFill *fill, uint64_t row, uint64_t word);
+
+/**
+ * @brief packed rows भरता है (PackedBoard का layout, width के बाद के bits 0)
+ * @param fill settings
+ * @param words पहली row का पहला word
+ * @param words_per_row हर row के words
+ * @param width row के cells
+ * @param first_row words की पहली row की board row
+ * @param rows कितनी rows
+ */
+void rng_fill_rows(const RngFill *fill, uint64_t *words, size_t words_per_row, size_t width,
+                   uint64_t first_row, size_t rows);
+
+#endif // RNG_H
@@ -8,11 +8,99 @@
  * Bit mask technique का उपयोग करके fast rule checking प्रदान करती है।
  */
 
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "rules.h"
 
+/**
+ * @brief हर neighbor count के Hensel letters, standard order में
+ */
+const char *const rules_hensel_letters[MAX_NEIGHBORS + 1] = {
+    "", "ce", "ceaikn", "ceaiknjqry", "ceaiknjqrtwyz", "ceaiknjqry", "ceaikn", "ce", ""
+};
+
+/**
+ * @brief Count 1-4 के हर Hensel letter की एक representative arrangement
+ *
+ * Bits 3x3 reading order में हैं (NW=1, N=2, NE=4, W=8, center=16,
+ * E=32, SW=64, S=128, SE=256), Golly की rule tables जैसे। Count 5-7 की
+ * हर arrangement का letter उसके complement (8 - count) का letter है।
+ */
+static const uint16_t hensel_shapes[5][13] = {
+    {0},
+    {1, 2},
+    {5, 10, 3, 40, 33, 68},
+    {69, 42, 11, 7, 98, 13, 14, 70, 41, 97},
+    {325, 170, 15, 45, 99, 71, 106, 102, 43, 101, 105, 78, 108},
+};
+
+/**
+ * @brief reading order की arrangement को 90 degree घुमाता है
+ * @param bits reading order bits
+ * @return घुमाई गई arrangement
+ */
+static unsigned hensel_rotate(unsigned bits) {
+    unsigned out = 0;
+    for (int r = 0; r < 3; r++) {
+        for (int c = 0; c < 3; c++) {
+            if ((bits >> (3 * (2 - c) + r)) & 1) out |= 1u << (3 * r + c);
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief reading order की arrangement को बाएं-दाएं mirror करता है
+ * @param bits reading order bits
+ * @return mirrored arrangement
+ */
+static unsigned hensel_flip(unsigned bits) {
+    unsigned out = 0;
+    for (int r = 0; r < 3; r++) {
+        for (int c = 0; c < 3; c++) {
+            if ((bits >> (3 * r + c)) & 1) out |= 1u << (3 * r + 2 - c);
+        }
+    }
+    return out;
+}
+
+/**
+ * @brief neighborhood index की arrangement का Hensel letter ढूंढता है
+ *
+ * Index का column layout (देखें RULES_NEIGHBORHOOD_SIZE) पहले reading
+ * order में बदला जाता है, फिर हर representative की आठों symmetries से
+ * तुलना होती है।
+ *
+ * @param index 3x3 neighborhood index (center bit ignore होता है)
+ * @return rules_hensel_letters[count] में letter का index (count 0/8 पर 0)
+ */
+static int hensel_letter(unsigned index) {
+    unsigned bits = 0;
+    for (int j = 0; j < 9; j++) {
+        // Index bit j: column 2 - j / 3, row 2 - j % 3
+        if ((index >> j) & 1) bits |= 1u << (3 * (2 - j % 3) + (2 - j / 3));
+    }
+    bits &= ~(1u << 4);
+
+    int count = __builtin_popcount(bits);
+    if (count > 4) {
+        bits = ~bits & 0x1ef;
+        count = MAX_NEIGHBORS - count;
+    }
+
+    int letters = (int)strlen(rules_hensel_letters[count]);
+    for (int k = 0; k < letters; k++) {
+        unsigned shape = hensel_shapes[count][k];
+        for (int i = 0; i < 4; i++) {
+            if (shape == bits || hensel_flip(shape) == bits) return k;
+            shape = hensel_rotate(shape);
+        }
+    }
+    return 0;
+}
+
 /**
  * @brief custom rules initialize करता है given birth और survival conditions के साथ
  * 
@@ -50,13 +138,273 @@ Rules *rules_init(const char *name, const int *birth_counts, int birth_len,
         }
     }
     
+    // Hensel exclusions नहीं और two-state: plain outer-totalistic rules
+    memset(rules->birth_excluded, 0, sizeof(rules->birth_excluded));
+    memset(rules->survival_excluded, 0, sizeof(rules->survival_excluded));
+    rules->states = 2;
+    
     // rule set का नाम copy करें
     strncpy(rules->name, name ? name : "Custom", sizeof(rules->name) - 1);
     rules->name[sizeof(rules->name) - 1] = '\0';
     
+    // hot path के लिए lookup tables एक बार में बना लें
+    rules_compile(rules);
+    
     return rules;
 }
 
+/**
+ * @brief birth/survival masks से compiled lookup tables बनाता है
+ * 
+ * next_state table (current_state, neighbor_count) से next state देती है।
+ * neighborhood table पूरे 3x3 neighborhood (9 bits) से सीधे next state
+ * देती है, ताकि stepping loop में न function call हो न neighbor count।
+ * sum_state table 3x3 sum (center सहित) से next state देती है; SIMD
+ * kernels इसे byte shuffle से lookup करते हैं।
+ * 
+ * Hensel exclusions सिर्फ neighborhood table में लगते हैं, क्योंकि बाकी
+ * tables सिर्फ count देखती हैं। इसलिए kernel यहीं एक बार चुना जाता है:
+ * exclusions न हों तो count वाले fast kernels, वरना table kernel, और
+ * states > 2 पर Generations kernel। Rule switch पर यही एक बार होता है;
+ * stepping loop में per-cell कोई check नहीं जुड़ता। Outer-totalistic masks
+ * किसी built-in rule set के हों तो rules->preset भी set होता है।
+ * 
+ * @param rules compile करने वाले rules
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int rules_compile(Rules *rules) {
+    if (!rules) return -1;
+    
+    for (int count = 0; count <= MAX_NEIGHBORS; count++) {
+        rules->next_state[0][count] = (rules->birth_rules >> count) & 1;
+        rules->next_state[1][count] = (rules->survival_rules >> count) & 1;
+    }
+    
+    rules->kernel = rules->states > 2 ? RULES_KERNEL_GENERATIONS : RULES_KERNEL_TOTALISTIC;
+    for (int index = 0; index < RULES_NEIGHBORHOOD_SIZE; index++) {
+        int center = (index >> RULES_NEIGHBORHOOD_CENTER_BIT) & 1;
+        int count = __builtin_popcount(index & ~(1 << RULES_NEIGHBORHOOD_CENTER_BIT));
+        uint8_t next = rules->next_state[center][count];
+        uint16_t excluded = center ? rules->survival_excluded[count] : rules->birth_excluded[count];
+        if (next && excluded) {
+            if (rules->kernel == RULES_KERNEL_TOTALISTIC) rules->kernel = RULES_KERNEL_TABLE;
+            if ((excluded >> hensel_letter((unsigned)index)) & 1) next = 0;
+        }
+        rules->neighborhood[index] = next;
+    }
+    
+    // Built-in masks के लिए specialized kernels
+    rules->preset = RULES_PRESET_NONE;
+    if (rules->kernel == RULES_KERNEL_TOTALISTIC) {
+        static const struct { uint16_t birth, survival; RulesPreset preset; } presets[] = {
+            {RULES_CONWAY_BIRTH, RULES_CONWAY_SURVIVAL, RULES_PRESET_CONWAY},
+            {RULES_HIGHLIFE_BIRTH, RULES_HIGHLIFE_SURVIVAL, RULES_PRESET_HIGHLIFE},
+            {RULES_DAY_NIGHT_BIRTH, RULES_DAY_NIGHT_SURVIVAL, RULES_PRESET_DAY_NIGHT},
+            {RULES_MAZE_BIRTH, RULES_MAZE_SURVIVAL, RULES_PRESET_MAZE},
+        };
+        for (size_t i = 0; i < sizeof(presets) / sizeof(presets[0]); i++) {
+            if (rules->birth_rules == presets[i].birth && rules->survival_rules == presets[i].survival) {
+                rules->preset = presets[i].preset;
+            }
+        }
+    }
+    
+    // sum में center भी शामिल है: जीवित cell के neighbors = sum - 1
+    for (int sum = 0; sum < RULES_SUM_STATE_SIZE; sum++) {
+        rules->sum_state[0][sum] = sum <= MAX_NEIGHBORS ? rules->next_state[0][sum] : 0;
+        rules->sum_state[1][sum] = sum >= 1 && sum <= MAX_NEIGHBORS + 1 ? rules->next_state[1][sum - 1] : 0;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief rule string के एक B या S part के counts और Hensel letters parse करता है
+ *
+ * @param text part (prefix के बिना, '/' या '\0' पर खत्म)
+ * @param mask counts का bit mask store करने के लिए
+ * @param excluded हर count के excluded letters store करने के लिए
+ * @return सफल होने पर 0, invalid digit/letter या duplicate count पर -1
+ */
+static int parse_counts(const char *text, uint16_t *mask, uint16_t excluded[MAX_NEIGHBORS + 1]) {
+    const char *p = text;
+    while (*p != '\0' && *p != '/') {
+        if (*p < '0' || *p > '0' + MAX_NEIGHBORS) return -1;
+        int count = *p++ - '0';
+        if ((*mask >> count) & 1) return -1;
+        
+        const char *letters = rules_hensel_letters[count];
+        uint16_t all = (uint16_t)((1u << strlen(letters)) - 1);
+        uint16_t listed = 0;
+        int negate = *p == '-';
+        if (negate) p++;
+        for (; isalpha((unsigned char)*p); p++) {
+            const char *found = *letters ? strchr(letters, tolower((unsigned char)*p)) : NULL;
+            if (found == NULL) return -1;
+            listed |= (uint16_t)(1u << (found - letters));
+        }
+        if (negate && listed == 0) return -1;
+        
+        uint16_t out = negate ? listed : (listed ? (uint16_t)(all & ~listed) : 0);
+        // सभी arrangements excluded: यह count rule में है ही नहीं
+        if (all != 0 && out == all) continue;
+        *mask |= (uint16_t)(1u << count);
+        excluded[count] = out;
+    }
+    return 0;
+}
+
+/**
+ * @brief rule string parse करके compiled rules बनाता है
+ *
+ * String पहले '/' पर parts में बंटती है। पहले part पर B/S prefix हो तो
+ * दोनों parts prefixed होने चाहिए, वरना Golly का S/B order माना जाता है।
+ * तीसरा part (optional "C" prefix के साथ) Generations states देता है।
+ *
+ * @param text rule string
+ * @return सफल होने पर Rules pointer, invalid string या memory fail होने पर NULL
+ */
+Rules *rules_parse(const char *text) {
+    if (!text) return NULL;
+    
+    const char *parts[3] = {text, NULL, NULL};
+    int num_parts = 1;
+    for (const char *p = text; *p != '\0'; p++) {
+        if (*p != '/') continue;
+        if (num_parts == 3) return NULL;
+        parts[num_parts++] = p + 1;
+    }
+    if (num_parts < 2) return NULL;
+    
+    Rules *rules = rules_init(NULL, NULL, 0, NULL, 0);
+    if (!rules) return NULL;
+    
+    int prefixed = toupper((unsigned char)parts[0][0]) == 'B' || toupper((unsigned char)parts[0][0]) == 'S';
+    int seen_birth = 0, seen_survival = 0;
+    for (int i = 0; i < 2; i++) {
+        const char *part = parts[i];
+        // Golly order: पहले survival, फिर birth
+        int birth = i == 1;
+        if (prefixed) {
+            char prefix = (char)toupper((unsigned char)*part++);
+            if (prefix != 'B' && prefix != 'S') goto invalid;
+            birth = prefix == 'B';
+        }
+        if (birth ? seen_birth++ : seen_survival++) goto invalid;
+        if (parse_counts(part, birth ? &rules->birth_rules : &rules->survival_rules,
+                         birth ? rules->birth_excluded : rules->survival_excluded) != 0) goto invalid;
+    }
+    
+    if (num_parts == 3) {
+        const char *p = parts[2];
+        if (toupper((unsigned char)*p) == 'C') p++;
+        char *end = NULL;
+        long states = strtol(p, &end, 10);
+        if (end == p || *end != '\0' || states < 2 || states > RULES_MAX_STATES) goto invalid;
+        rules->states = (int)states;
+    }
+    
+    rules_compile(rules);
+    if (rules_to_string(rules, rules->name, sizeof(rules->name)) != 0) {
+        // Canonical form बहुत लंबा हो तो दिया गया string ही नाम है
+        strncpy(rules->name, text, sizeof(rules->name) - 1);
+        rules->name[sizeof(rules->name) - 1] = '\0';
+    }
+    return rules;
+    
+invalid:
+    rules_free(rules);
+    return NULL;
+}
+
+/**
+ * @brief एक B या S part को canonical form में buffer में जोड़ता है
+ * @param out output buffer
+ * @param size buffer का size
+ * @param len अभी तक लिखी length (update होती है)
+ * @param mask counts का bit mask
+ * @param excluded हर count के excluded letters
+ * @return सफल होने पर 0, buffer छोटा होने पर -1
+ */
+static int format_counts(char *out, size_t size, size_t *len, uint16_t mask, const uint16_t *excluded) {
+    for (int count = 0; count <= MAX_NEIGHBORS; count++) {
+        if (!((mask >> count) & 1)) continue;
+        
+        const char *letters = rules_hensel_letters[count];
+        uint16_t all = (uint16_t)((1u << strlen(letters)) - 1);
+        uint16_t included = (uint16_t)(all & ~excluded[count]);
+        uint16_t list = excluded[count];
+        char text[2 + 13 + 1];
+        size_t n = 0;
+        
+        text[n++] = (char)('0' + count);
+        if (list != 0) {
+            // जो list छोटी हो वही लिखें
+            if (__builtin_popcount(included) <= __builtin_popcount(list)) {
+                list = included;
+            } else {
+                text[n++] = '-';
+            }
+            for (int k = 0; letters[k] != '\0'; k++) {
+                if ((list >> k) & 1) text[n++] = letters[k];
+            }
+        }
+        
+        if (*len + n >= size) return -1;
+        memcpy(out + *len, text, n);
+        *len += n;
+        out[*len] = '\0';
+    }
+    return 0;
+}
+
+/**
+ * @brief rules का canonical rule string बनाता है
+ *
+ * @param rules rules
+ * @param buffer output buffer
+ * @param size buffer का size (RULES_STRING_SIZE काफी है)
+ * @return सफल होने पर 0, NULL pointer या छोटा buffer होने पर -1
+ */
+int rules_to_string(const Rules *rules, char *buffer, size_t size) {
+    if (!rules || !buffer || size < 5) return -1;
+    
+    char text[RULES_STRING_SIZE * 2];
+    size_t len = 0;
+    text[len++] = 'B';
+    text[len] = '\0';
+    if (format_counts(text, sizeof(text), &len, rules->birth_rules, rules->birth_excluded) != 0) return -1;
+    if (len + 2 >= sizeof(text)) return -1;
+    text[len++] = '/';
+    text[len++] = 'S';
+    text[len] = '\0';
+    if (format_counts(text, sizeof(text), &len, rules->survival_rules, rules->survival_excluded) != 0) return -1;
+    if (rules->states > 2) {
+        int n = snprintf(text + len, sizeof(text) - len, "/C%d", rules->states);
+        if (n < 0 || (size_t)n >= sizeof(text) - len) return -1;
+        len += (size_t)n;
+    }
+    
+    if (len >= size) return -1;
+    memcpy(buffer, text, len + 1);
+    return 0;
+}
+
+/**
+ * @brief check करता है कि दोनों rules same transitions देते हैं या नहीं
+ * 
+ * Compiled neighborhood table में masks और Hensel exclusions दोनों आ
+ * जाते हैं, इसलिए table और states की तुलना काफी है।
+ * 
+ * @param a पहले rules
+ * @param b दूसरे rules
+ * @return same होने पर 1, नहीं तो 0
+ */
+int rules_equal(const Rules *a, const Rules *b) {
+    if (!a || !b) return 0;
+    return a->states == b->states && memcmp(a->neighborhood, b->neighborhood, sizeof(a->neighborhood)) == 0;
+}
+
 /**
  * @brief Classic Conway's Game of Life rules create करता है
  * 
@@ -124,6 +472,26 @@ Rules *rules_maze(void) {
     return rules_init("Maze (B3/S12345)", birth, 1, survival, 5);
 }
 
+/**
+ * @brief short नाम से built-in rule set create करता है
+ * 
+ * Command line (--rule) से rule set चुनने के लिए उपयोग होता है। Built-in
+ * नाम न हो तो name को rule string की तरह parse किया जाता है।
+ * 
+ * @param name rule set का short नाम ("conway", "highlife", "daynight", "maze") या rule string
+ * @return सफल होने पर Rules pointer, NULL, unknown नाम या invalid rule string होने पर NULL
+ */
+Rules *rules_from_name(const char *name) {
+    if (!name) return NULL;
+    
+    if (strcmp(name, "conway") == 0) return rules_conway();
+    if (strcmp(name, "highlife") == 0) return rules_highlife();
+    if (strcmp(name, "daynight") == 0) return rules_day_night();
+    if (strcmp(name, "maze") == 0) return rules_maze();
+    
+    return rules_parse(name);
+}
+
 /**
  * @brief given rules के अनुसार cell का next state determine करता है
  * 
@@ -179,7 +547,9 @@ void rules_free(Rules *rules) {
 void rules_print(Rules *rules) {
     if (!rules) return;
     
+    char text[RULES_STRING_SIZE];
     printf("Rules: %s\n", rules->name);
+    if (rules_to_string(rules, text, sizeof(text)) == 0) printf("Rule string: %s\n", text);
     printf("Birth conditions (neighbor count): ");
     for (int i = 0; i <= MAX_NEIGHBORS; i++) {
         if (rules->birth_rules & (1 << i)) {
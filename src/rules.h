@@ -12,6 +12,7 @@
 #ifndef RULES_H
 #define RULES_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 /**
@@ -19,6 +20,92 @@
  */
 #define MAX_NEIGHBORS 8
 
+/**
+ * @brief 3x3 neighborhood lookup table में entries की संख्या (2^9)
+ *
+ * Neighborhood index में हर column के 3 bits होते हैं (ऊपर=bit 2,
+ * बीच=bit 1, नीचे=bit 0)। बाएं column के bits 6-8, current column के
+ * bits 3-5 और दाएं column के bits 0-2 में होते हैं। इस layout से
+ * row में आगे बढ़ते समय index को 3 bits left shift करके नया column
+ * जोड़ा जा सकता है।
+ */
+#define RULES_NEIGHBORHOOD_SIZE 512
+
+/**
+ * @brief neighborhood index में center cell का bit
+ */
+#define RULES_NEIGHBORHOOD_CENTER_BIT 4
+
+/**
+ * @brief sum_state table में entries की संख्या
+ *
+ * 3x3 sum (center सहित) 0-9 होता है; table 16 bytes की है ताकि SIMD
+ * kernels उसे सीधे byte shuffle lookup table की तरह use कर सकें।
+ */
+#define RULES_SUM_STATE_SIZE 16
+
+/**
+ * @brief Generations rules में ज्यादा से ज्यादा cell states
+ *
+ * Cells एक byte में store होते हैं, इसलिए states 0-255 तक।
+ */
+#define RULES_MAX_STATES 256
+
+/**
+ * @brief Rule string (और canonical नाम) की maximum length, NUL सहित
+ */
+#define RULES_STRING_SIZE 64
+
+/**
+ * @brief हर neighbor count के Hensel letters, standard order में
+ *
+ * Count n के हर letter का मतलब n जीवित neighbors की एक arrangement
+ * (rotations और reflections सहित) है। Count 0 और 8 की एक ही arrangement
+ * है, इसलिए उनके कोई letters नहीं।
+ */
+extern const char *const rules_hensel_letters[MAX_NEIGHBORS + 1];
+
+/**
+ * @brief rules_compile द्वारा चुना गया stepping kernel
+ *
+ * Kernel rules compile होते समय एक बार तय होता है, इसलिए stepping loop
+ * में per-cell कोई rule check नहीं होता। Engines जो kernel support नहीं
+ * करते वो उन rules को reject करते हैं।
+ */
+typedef enum RulesKernel {
+    RULES_KERNEL_TOTALISTIC = 0,    /**< Outer-totalistic: सिर्फ neighbor count (SIMD sums, bit-sliced packed/sparse) */
+    RULES_KERNEL_TABLE,             /**< Isotropic non-totalistic (Hensel): 512-entry neighborhood table */
+    RULES_KERNEL_GENERATIONS        /**< Generations (states > 2): neighborhood table और dying states */
+} RulesKernel;
+
+/**
+ * @brief Built-in rule sets जिनके लिए stepping kernels compile time पर specialize होते हैं
+ *
+ * rules_compile outer-totalistic masks को इन presets से match करता है।
+ * Kernels preset को constant की तरह लेकर inline होते हैं, इसलिए compiler
+ * birth/survival logic को कुछ bitwise ops में fold कर देता है; बाकी rules
+ * generic path (RULES_PRESET_NONE) से चलते हैं।
+ */
+typedef enum RulesPreset {
+    RULES_PRESET_NONE = 0,      /**< Custom rules: runtime masks */
+    RULES_PRESET_CONWAY,        /**< B3/S23 */
+    RULES_PRESET_HIGHLIFE,      /**< B36/S23 */
+    RULES_PRESET_DAY_NIGHT,     /**< B3678/S34678 */
+    RULES_PRESET_MAZE           /**< B3/S12345 */
+} RulesPreset;
+
+/**
+ * @brief Built-in presets के birth/survival masks (bit k = neighbor count k)
+ */
+#define RULES_CONWAY_BIRTH 0x008
+#define RULES_CONWAY_SURVIVAL 0x00c
+#define RULES_HIGHLIFE_BIRTH 0x048
+#define RULES_HIGHLIFE_SURVIVAL 0x00c
+#define RULES_DAY_NIGHT_BIRTH 0x1c8
+#define RULES_DAY_NIGHT_SURVIVAL 0x1d8
+#define RULES_MAZE_BIRTH 0x008
+#define RULES_MAZE_SURVIVAL 0x03e
+
 /**
  * @brief Game rules को represent करने वाला structure
  * 
@@ -29,7 +116,15 @@
 typedef struct Rules {
     uint16_t birth_rules;    /**< Birth conditions का bit mask (index = neighbor count, bit = rule active) */
     uint16_t survival_rules; /**< Survival conditions का bit mask */
-    char name[64];           /**< Rule set का descriptive नाम */
+    char name[RULES_STRING_SIZE]; /**< Rule set का descriptive नाम */
+    uint16_t birth_excluded[MAX_NEIGHBORS + 1];    /**< Hensel: हर birth count के excluded neighborhoods (bit i = rules_hensel_letters[count] का i-th letter; 0 = पूरा count) */
+    uint16_t survival_excluded[MAX_NEIGHBORS + 1]; /**< Hensel: हर survival count के excluded neighborhoods */
+    int states;              /**< Cell states: 2 = normal, ज्यादा होने पर Generations (1 = जीवित, 2.. = dying) */
+    RulesKernel kernel;      /**< Compiled: stepping kernel (देखें rules_compile) */
+    RulesPreset preset;      /**< Compiled: matching built-in rule set (RULES_PRESET_NONE = कोई नहीं) */
+    uint8_t next_state[2][MAX_NEIGHBORS + 1];        /**< Compiled table: [current_state][neighbor_count] -> next state */
+    uint8_t neighborhood[RULES_NEIGHBORHOOD_SIZE];  /**< Compiled table: 3x3 neighborhood index -> next state */
+    uint8_t sum_state[2][RULES_SUM_STATE_SIZE];     /**< Compiled table: [current_state][3x3 sum, center सहित] -> next state */
 } Rules;
 
 /**
@@ -44,6 +139,57 @@ typedef struct Rules {
 Rules *rules_init(const char *name, const int *birth_counts, int birth_len, 
                   const int *survival_counts, int survival_len);
 
+/**
+ * @brief birth/survival masks से compiled lookup tables (next_state, neighborhood, sum_state) बनाता है
+ *
+ * rules_init इसे automatically call करता है। अगर masks, excluded letters
+ * या states को बाद में directly बदला जाए तो tables और kernel को sync
+ * करने के लिए इसे फिर से call करें।
+ *
+ * @param rules compile करने वाले rules
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int rules_compile(Rules *rules);
+
+/**
+ * @brief rule string parse करके compiled rules बनाता है
+ *
+ * Supported forms (letters case-insensitive):
+ * - B/S notation: "B36/S23" (S/B order भी चलता है: "S23/B3")
+ * - Golly का S/B notation: "23/36"
+ * - Hensel isotropic non-totalistic: हर digit के बाद उसके letters
+ *   ("B2a/S12") या '-' के बाद excluded letters ("B3/S23-a")
+ * - Generations: तीसरा part states की संख्या, "B2/S/C3", "B2/S/3" या
+ *   Golly का "/2/3" (S/B/C)
+ *
+ * Rules का नाम canonical rule string बनता है (जैसे "B2-a/S12")।
+ *
+ * @param text rule string
+ * @return सफल होने पर Rules pointer, invalid string या memory fail होने पर NULL
+ */
+Rules *rules_parse(const char *text);
+
+/**
+ * @brief rules का canonical rule string बनाता है
+ *
+ * Letters Hensel order में लिखे जाते हैं; जो list छोटी हो (included या
+ * '-' के बाद excluded) वो चुनी जाती है।
+ *
+ * @param rules rules
+ * @param buffer output buffer
+ * @param size buffer का size (RULES_STRING_SIZE काफी है)
+ * @return सफल होने पर 0, NULL pointer या छोटा buffer होने पर -1
+ */
+int rules_to_string(const Rules *rules, char *buffer, size_t size);
+
+/**
+ * @brief check करता है कि दोनों rules same transitions देते हैं या नहीं (नाम ignore होता है)
+ * @param a पहले rules
+ * @param b दूसरे rules
+ * @return same होने पर 1, नहीं तो 0
+ */
+int rules_equal(const Rules *a, const Rules *b);
+
 /**
  * @brief Classic Conway's Game of Life rules create करता है (B3/S23)
  * 
@@ -88,8 +234,23 @@ Rules *rules_day_night(void);
  */
 Rules *rules_maze(void);
 
+/**
+ * @brief short नाम से built-in rule set create करता है
+ * 
+ * Supported नाम: "conway", "highlife", "daynight", "maze"। बाकी नाम
+ * rule string की तरह parse होते हैं (देखें rules_parse)।
+ * 
+ * @param name rule set का short नाम या rule string
+ * @return सफल होने पर Rules pointer, unknown नाम या invalid rule string होने पर NULL
+ */
+Rules *rules_from_name(const char *name);
+
 /**
  * @brief rules के अनुसार check करता है कि cell अगली generation में जीवित होगी या नहीं
+ *
+ * सिर्फ count देखा जाता है, इसलिए Hensel letters और Generations states
+ * यहाँ लागू नहीं होते (उनके लिए compiled neighborhood table देखें)।
+ *
  * @param rules apply करने वाले rules
  * @param current_state cell की current state (1=जीवित, 0=मृत)
  * @param neighbor_count जीवित neighbors की संख्या
@@ -0,0 +1,84 @@
+/**
+ * @file scheduler.c
+ * @brief Fixed-timestep scheduler का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ */
+
+#include <limits.h>
+#include <stddef.h>
+
+#include "scheduler.h"
+
+/**
+ * @brief scheduler initialize करता है
+ * @param scheduler target scheduler
+ * @param rate target generations/second (0 = जितनी budget में fit हों)
+ * @param budget प्रति frame stepping का time budget (seconds)
+ * @return सफल होने पर 0, NULL pointer या negative values होने पर -1
+ */
+int scheduler_init(Scheduler *scheduler, double rate, double budget) {
+    if (scheduler == NULL || rate < 0 || budget < 0) return -1;
+
+    scheduler->rate = rate;
+    scheduler->budget = budget;
+    scheduler_reset(scheduler);
+    return 0;
+}
+
+/**
+ * @brief pending generations हटाता है (pause के बाद burst न आए)
+ * @param scheduler target scheduler
+ */
+void scheduler_reset(Scheduler *scheduler) {
+    if (scheduler == NULL) return;
+    scheduler->accumulator = 0;
+    scheduler->last_time = -1;
+}
+
+/**
+ * @brief इस frame में कितनी generations चलानी हैं
+ * @param scheduler target scheduler
+ * @param now current time (seconds, monotonic)
+ * @return generations की संख्या (rate 0 हो तो LONG_MAX, budget ही limit है)
+ */
+long scheduler_begin_frame(Scheduler *scheduler, double now) {
+    if (scheduler == NULL) return 0;
+
+    double elapsed = scheduler->last_time < 0 ? 0 : now - scheduler->last_time;
+    scheduler->last_time = now;
+    if (scheduler->rate <= 0) return LONG_MAX;
+
+    // Reset के बाद पहले frame में एक generation, ताकि resume तुरंत दिखे
+    scheduler->accumulator += elapsed > 0 ? elapsed * scheduler->rate : 1;
+
+    double backlog = scheduler->rate * SCHEDULER_MAX_BACKLOG;
+    if (backlog < 1) backlog = 1;
+    if (scheduler->accumulator > backlog) scheduler->accumulator = backlog;
+
+    return (long)scheduler->accumulator;
+}
+
+/**
+ * @brief check करता है कि stepping के लिए budget बचा है या नहीं
+ * @param scheduler target scheduler
+ * @param start इस frame में stepping शुरू होने का time (seconds)
+ * @param now current time (seconds)
+ * @return budget बचा है तो 1, वरना 0
+ */
+int scheduler_in_budget(const Scheduler *scheduler, double start, double now) {
+    if (scheduler == NULL) return 0;
+    return now - start < scheduler->budget;
+}
+
+/**
+ * @brief frame में चली generations को pending से घटाता है
+ * @param scheduler target scheduler
+ * @param done इस frame में चली generations
+ */
+void scheduler_end_frame(Scheduler *scheduler, long done) {
+    if (scheduler == NULL || scheduler->rate <= 0) return;
+
+    scheduler->accumulator -= (double)done;
+    if (scheduler->accumulator < 0) scheduler->accumulator = 0;
+}
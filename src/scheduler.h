@@ -0,0 +1,82 @@
+/**
+ * @file scheduler.h
+ * @brief Simulation rate को frame rate से अलग करने वाले fixed-timestep scheduler का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * हर frame में scheduler बताता है कि कितनी generations चलानी हैं: target
+ * rate (generations/second) पर बीते time के हिसाब से, या rate 0 होने पर
+ * जितनी frame budget में fit हों। दोनों modes में stepping frame budget से
+ * ज्यादा नहीं चलती, ताकि धीमे engine पर भी window responsive रहे; जो
+ * generations budget में नहीं हो पातीं उनका backlog SCHEDULER_MAX_BACKLOG
+ * तक ही रखा जाता है।
+ *
+ * Time caller देता है (seconds में), इसलिए module में SDL पर कोई
+ * dependency नहीं है।
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+/**
+ * @brief Frame period का कितना हिस्सा stepping को मिलता है
+ *
+ * बाकी हिस्सा events, draw और present के लिए है।
+ */
+#define SCHEDULER_BUDGET_FRACTION 0.75
+
+/**
+ * @brief ज्यादा से ज्यादा कितने seconds की generations pending रह सकती हैं
+ */
+#define SCHEDULER_MAX_BACKLOG 0.25
+
+/**
+ * @brief Fixed-timestep scheduler का state
+ */
+typedef struct Scheduler {
+    double rate;            /**< Target generations/second (0 = जितनी budget में fit हों) */
+    double budget;          /**< प्रति frame stepping का time budget (seconds) */
+    double accumulator;     /**< Pending generations (fractional) */
+    double last_time;       /**< पिछले scheduler_begin_frame का time (negative = reset के बाद) */
+} Scheduler;
+
+/**
+ * @brief scheduler initialize करता है
+ * @param scheduler target scheduler
+ * @param rate target generations/second (0 = जितनी budget में fit हों)
+ * @param budget प्रति frame stepping का time budget (seconds)
+ * @return सफल होने पर 0, NULL pointer या negative values होने पर -1
+ */
+int scheduler_init(Scheduler *scheduler, double rate, double budget);
+
+/**
+ * @brief pending generations हटाता है (pause के बाद burst न आए)
+ * @param scheduler target scheduler
+ */
+void scheduler_reset(Scheduler *scheduler);
+
+/**
+ * @brief इस frame में कितनी generations चलानी हैं
+ * @param scheduler target scheduler
+ * @param now current time (seconds, monotonic)
+ * @return generations की संख्या (rate 0 हो तो LONG_MAX, budget ही limit है)
+ */
+long scheduler_begin_frame(Scheduler *scheduler, double now);
+
+/**
+ * @brief check करता है कि stepping के लिए budget बचा है या नहीं
+ * @param scheduler target scheduler
+ * @param start इस frame में stepping शुरू होने का time (seconds)
+ * @param now current time (seconds)
+ * @return budget बचा है तो 1, वरना 0
+ */
+int scheduler_in_budget(const Scheduler *scheduler, double start, double now);
+
+/**
+ * @brief frame में चली generations को pending से घटाता है
+ * @param scheduler target scheduler
+ * @param done इस frame में चली generations
+ */
+void scheduler_end_frame(Scheduler *scheduler, long done);
+
+#endif // SCHEDULER_H
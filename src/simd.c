@@ -0,0 +1,290 @@
+/**
+ * @file simd.c
+ * @brief Byte-per-cell बोर्ड के लिए SIMD row kernels का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * AVX2 kernel target attribute से compile होता है, इसलिए बाकी program
+ * baseline flags पर ही रहता है और kernel सिर्फ AVX2 वाले CPUs पर चुना
+ * जाता है (__builtin_cpu_supports)। aarch64 पर NEON हमेशा उपलब्ध है।
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "simd.h"
+
+#if !defined(BOARD_NO_SIMD) && (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define SIMD_HAVE_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if !defined(BOARD_NO_SIMD) && defined(__aarch64__)
+#define SIMD_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
+#ifdef SIMD_HAVE_AVX2
+/**
+ * @brief AVX2 kernel: 32 columns प्रति iteration
+ *
+ * @param up ऊपर वाली row
+ * @param mid current row
+ * @param down नीचे वाली row
+ * @param up_mask ऊपर वाली row बोर्ड के अंदर है तो 1
+ * @param down_mask नीचे वाली row बोर्ड के अंदर है तो 1
+ * @param dst next generation की row
+ * @param count कितने columns चाहिए
+ * @param rules compiled rules
+ * @param changed कोई cell बदली तो non-zero OR होता है
+ * @return compute हुए columns
+ */
+__attribute__((target("avx2")))
+static size_t row_kernel_avx2(const char *up, const char *mid, const char *down,
+                              unsigned up_mask, unsigned down_mask, char *dst, size_t count,
+                              const Rules *rules, unsigned *changed) {
+    // shuffle_epi8 हर 128-bit lane में अलग lookup करता है, इसलिए table दोनों lanes में
+    const __m256i birth = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)rules->sum_state[0]));
+    const __m256i survive = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)rules->sum_state[1]));
+    const __m256i up_keep = _mm256_set1_epi8(up_mask ? -1 : 0);
+    const __m256i down_keep = _mm256_set1_epi8(down_mask ? -1 : 0);
+    __m256i diff = _mm256_setzero_si256();
+    size_t y = 0;
+
+    for (; y + 32 <= count; y += 32) {
+        __m256i center = _mm256_loadu_si256((const __m256i *)(mid + y));
+        __m256i row_up = _mm256_add_epi8(_mm256_add_epi8(_mm256_loadu_si256((const __m256i *)(up + y - 1)),
+                                                         _mm256_loadu_si256((const __m256i *)(up + y))),
+                                         _mm256_loadu_si256((const __m256i *)(up + y + 1)));
+        __m256i row_mid = _mm256_add_epi8(_mm256_add_epi8(_mm256_loadu_si256((const __m256i *)(mid + y - 1)), center),
+                                          _mm256_loadu_si256((const __m256i *)(mid + y + 1)));
+        __m256i row_down = _mm256_add_epi8(_mm256_add_epi8(_mm256_loadu_si256((const __m256i *)(down + y - 1)),
+                                                           _mm256_loadu_si256((const __m256i *)(down + y))),
+                                           _mm256_loadu_si256((const __m256i *)(down + y + 1)));
+        __m256i sum = _mm256_add_epi8(_mm256_add_epi8(_mm256_and_si256(row_up, up_keep), row_mid),
+                                      _mm256_and_si256(row_down, down_keep));
+
+        // center 1 हो तो survival table, वरना birth table
+        __m256i alive = _mm256_sub_epi8(_mm256_setzero_si256(), center);
+        __m256i next = _mm256_blendv_epi8(_mm256_shuffle_epi8(birth, sum), _mm256_shuffle_epi8(survive, sum), alive);
+
+        diff = _mm256_or_si256(diff, _mm256_xor_si256(next, center));
+        _mm256_storeu_si256((__m256i *)(dst + y), next);
+    }
+
+    *changed |= !_mm256_testz_si256(diff, diff);
+    return y;
+}
+
+/**
+ * @brief AVX2 count kernel: हर row के 32 columns प्रति iteration
+ *
+ * sad_epu8 zero के साथ हर 8 bytes का sum एक 64-bit lane में देता है।
+ *
+ * @param cur नई generation की पहली row
+ * @param cur_stride cur की rows के बीच bytes
+ * @param old पिछली generation की पहली row (NULL = births/deaths नहीं)
+ * @param old_stride old की rows के बीच bytes
+ * @param rows rows की संख्या
+ * @param count हर row के कितने columns
+ * @param counts population, births और deaths
+ * @param columns हर column का OR accumulator
+ * @param live_rows जीवित cells वाली rows का bitmask
+ * @return हर row के गिने गए columns
+ */
+__attribute__((target("avx2")))
+static size_t block_count_avx2(const char *cur, size_t cur_stride, const char *old, size_t old_stride,
+                               size_t rows, size_t count, uint64_t counts[3], unsigned char *columns,
+                               uint64_t *live_rows) {
+    const __m256i zero = _mm256_setzero_si256();
+    const size_t vectors = count / 32;
+    __m256i population = zero, births = zero, deaths = zero;
+    __m256i live[2] = {zero, zero};
+    uint64_t mask = 0;
+
+    // Tile की row में दो vectors तक; ज्यादा हों तो columns सीधे memory में OR होते हैं
+    for (size_t r = 0; r < rows; r++) {
+        const char *now_row = cur + r * cur_stride;
+        __m256i any = zero;
+        for (size_t v = 0; v < vectors; v++) {
+            __m256i now = _mm256_loadu_si256((const __m256i *)(now_row + v * 32));
+            population = _mm256_add_epi64(population, _mm256_sad_epu8(now, zero));
+            any = _mm256_or_si256(any, now);
+            if (old != NULL) {
+                __m256i before = _mm256_loadu_si256((const __m256i *)(old + r * old_stride + v * 32));
+                births = _mm256_add_epi64(births, _mm256_sad_epu8(_mm256_andnot_si256(before, now), zero));
+                deaths = _mm256_add_epi64(deaths, _mm256_sad_epu8(_mm256_andnot_si256(now, before), zero));
+            }
+            if (v < 2) {
+                live[v] = _mm256_or_si256(live[v], now);
+            } else {
+                __m256i column = _mm256_loadu_si256((const __m256i *)(columns + v * 32));
+                _mm256_storeu_si256((__m256i *)(columns + v * 32), _mm256_or_si256(column, now));
+            }
+        }
+        mask |= (uint64_t)!_mm256_testz_si256(any, any) << r;
+    }
+
+    for (size_t v = 0; v < vectors && v < 2; v++) {
+        __m256i column = _mm256_loadu_si256((const __m256i *)(columns + v * 32));
+        _mm256_storeu_si256((__m256i *)(columns + v * 32), _mm256_or_si256(column, live[v]));
+    }
+
+    uint64_t lanes[3][4];
+    _mm256_storeu_si256((__m256i *)lanes[0], population);
+    _mm256_storeu_si256((__m256i *)lanes[1], births);
+    _mm256_storeu_si256((__m256i *)lanes[2], deaths);
+    for (int i = 0; i < 3; i++) counts[i] += lanes[i][0] + lanes[i][1] + lanes[i][2] + lanes[i][3];
+    *live_rows |= mask;
+    return vectors * 32;
+}
+#endif
+
+#ifdef SIMD_HAVE_NEON
+/**
+ * @brief NEON kernel: 16 columns प्रति iteration
+ *
+ * @param up ऊपर वाली row
+ * @param mid current row
+ * @param down नीचे वाली row
+ * @param up_mask ऊपर वाली row बोर्ड के अंदर है तो 1
+ * @param down_mask नीचे वाली row बोर्ड के अंदर है तो 1
+ * @param dst next generation की row
+ * @param count कितने columns चाहिए
+ * @param rules compiled rules
+ * @param changed कोई cell बदली तो non-zero OR होता है
+ * @return compute हुए columns
+ */
+static size_t row_kernel_neon(const char *up, const char *mid, const char *down,
+                              unsigned up_mask, unsigned down_mask, char *dst, size_t count,
+                              const Rules *rules, unsigned *changed) {
+    const uint8x16_t birth = vld1q_u8(rules->sum_state[0]);
+    const uint8x16_t survive = vld1q_u8(rules->sum_state[1]);
+    const uint8x16_t up_keep = vdupq_n_u8(up_mask ? 0xFF : 0);
+    const uint8x16_t down_keep = vdupq_n_u8(down_mask ? 0xFF : 0);
+    const uint8_t *u = (const uint8_t *)up, *m = (const uint8_t *)mid, *d = (const uint8_t *)down;
+    uint8x16_t diff = vdupq_n_u8(0);
+    size_t y = 0;
+
+    for (; y + 16 <= count; y += 16) {
+        uint8x16_t center = vld1q_u8(m + y);
+        uint8x16_t row_up = vaddq_u8(vaddq_u8(vld1q_u8(u + y - 1), vld1q_u8(u + y)), vld1q_u8(u + y + 1));
+        uint8x16_t row_mid = vaddq_u8(vaddq_u8(vld1q_u8(m + y - 1), center), vld1q_u8(m + y + 1));
+        uint8x16_t row_down = vaddq_u8(vaddq_u8(vld1q_u8(d + y - 1), vld1q_u8(d + y)), vld1q_u8(d + y + 1));
+        uint8x16_t sum = vaddq_u8(vaddq_u8(vandq_u8(row_up, up_keep), row_mid), vandq_u8(row_down, down_keep));
+
+        // center 1 हो तो survival table, वरना birth table
+        uint8x16_t alive = vceqq_u8(center, vdupq_n_u8(1));
+        uint8x16_t next = vbslq_u8(alive, vqtbl1q_u8(survive, sum), vqtbl1q_u8(birth, sum));
+
+        diff = vorrq_u8(diff, veorq_u8(next, center));
+        vst1q_u8((uint8_t *)dst + y, next);
+    }
+
+    *changed |= vmaxvq_u8(diff) != 0;
+    return y;
+}
+
+/**
+ * @brief NEON count kernel: हर row के 16 columns प्रति iteration
+ * @param cur नई generation की पहली row
+ * @param cur_stride cur की rows के बीच bytes
+ * @param old पिछली generation की पहली row (NULL = births/deaths नहीं)
+ * @param old_stride old की rows के बीच bytes
+ * @param rows rows की संख्या
+ * @param count हर row के कितने columns
+ * @param counts population, births और deaths
+ * @param columns हर column का OR accumulator
+ * @param live_rows जीवित cells वाली rows का bitmask
+ * @return हर row के गिने गए columns
+ */
+static size_t block_count_neon(const char *cur, size_t cur_stride, const char *old, size_t old_stride,
+                               size_t rows, size_t count, uint64_t counts[3], unsigned char *columns,
+                               uint64_t *live_rows) {
+    const size_t vectors = count / 16;
+    uint64_t population = 0, births = 0, deaths = 0, mask = 0;
+
+    for (size_t r = 0; r < rows; r++) {
+        const uint8_t *c = (const uint8_t *)cur + r * cur_stride;
+        const uint8_t *o = old != NULL ? (const uint8_t *)old + r * old_stride : NULL;
+        uint8x16_t any = vdupq_n_u8(0);
+        for (size_t v = 0; v < vectors; v++) {
+            uint8x16_t now = vld1q_u8(c + v * 16);
+            population += vaddlvq_u8(now);
+            any = vorrq_u8(any, now);
+            if (o != NULL) {
+                uint8x16_t before = vld1q_u8(o + v * 16);
+                births += vaddlvq_u8(vbicq_u8(now, before));
+                deaths += vaddlvq_u8(vbicq_u8(before, now));
+            }
+            vst1q_u8(columns + v * 16, vorrq_u8(vld1q_u8(columns + v * 16), now));
+        }
+        mask |= (uint64_t)(vmaxvq_u8(any) != 0) << r;
+    }
+
+    counts[0] += population;
+    counts[1] += births;
+    counts[2] += deaths;
+    *live_rows |= mask;
+    return vectors * 16;
+}
+#endif
+
+/**
+ * @brief चुना गया kernel (simd_row_kernel की पहली call पर set)
+ */
+static SimdRowKernel selected_kernel = NULL;
+
+/**
+ * @brief चुने गए kernel वाला count kernel
+ */
+static SimdBlockCount selected_count = NULL;
+
+/**
+ * @brief चुने गए kernel का नाम
+ */
+static const char *selected_name = NULL;
+
+/**
+ * @brief इस CPU के लिए best SIMD kernel
+ * @return kernel, या SIMD उपलब्ध न हो तो NULL
+ */
+SimdRowKernel simd_row_kernel(void) {
+    if (selected_name != NULL) return selected_kernel;
+
+    selected_kernel = NULL;
+    selected_count = NULL;
+    selected_name = "scalar";
+#ifdef SIMD_HAVE_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        selected_kernel = row_kernel_avx2;
+        selected_count = block_count_avx2;
+        selected_name = "avx2";
+    }
+#endif
+#ifdef SIMD_HAVE_NEON
+    selected_kernel = row_kernel_neon;
+    selected_count = block_count_neon;
+    selected_name = "neon";
+#endif
+    return selected_kernel;
+}
+
+/**
+ * @brief simd_row_kernel वाले instruction set का count kernel
+ * @return kernel, या SIMD उपलब्ध न हो तो NULL
+ */
+SimdBlockCount simd_block_count(void) {
+    simd_row_kernel();
+    return selected_count;
+}
+
+/**
+ * @brief चुने गए kernel का नाम
+ * @return "avx2", "neon" या "scalar"
+ */
+const char *simd_kernel_name(void) {
+    simd_row_kernel();
+    return selected_name;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file simd.h
+ * @brief Byte-per-cell बोर्ड के लिए SIMD row kernels का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Kernels एक row के कई columns एक साथ compute करते हैं: ऊपर, बीच और नीचे
+ * की rows के तीन shifted loads जोड़कर 3x3 sum (center सहित) बनता है, और
+ * rules->sum_state table byte shuffle से next state देती है।
+ *
+ * Kernel runtime पर CPU के अनुसार चुना जाता है (x86 पर AVX2, aarch64 पर
+ * NEON)। उपलब्ध न हो तो simd_row_kernel NULL देता है और caller scalar
+ * table kernel use करता है। BOARD_NO_SIMD define करके SIMD पूरी तरह
+ * बंद किया जा सकता है।
+ */
+
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rules.h"
+
+/**
+ * @brief एक row के columns का SIMD kernel
+ *
+ * up/mid/down उस column पर point करते हैं जहाँ से compute शुरू होता है।
+ * Kernel हर column के बाएं और दाएं neighbors भी पढ़ता है, इसलिए caller
+ * को ensure करना है कि [-1, count] range row के अंदर हो। बोर्ड के बाहर
+ * की row के लिए mid pointer और 0 mask दें।
+ *
+ * @param up ऊपर वाली row
+ * @param mid current row
+ * @param down नीचे वाली row
+ * @param up_mask ऊपर वाली row बोर्ड के अंदर है तो 1, वरना 0
+ * @param down_mask नीचे वाली row बोर्ड के अंदर है तो 1, वरना 0
+ * @param dst next generation की row
+ * @param count कितने columns चाहिए
+ * @param rules compiled rules (sum_state)
+ * @param changed कोई cell बदली तो non-zero OR होता है
+ * @return कितने columns compute हुए (vector width का multiple, count से ज्यादा नहीं)
+ */
+typedef size_t (*SimdRowKernel)(const char *up, const char *mid, const char *down,
+                                unsigned up_mask, unsigned down_mask, char *dst, size_t count,
+                                const Rules *rules, unsigned *changed);
+
+/**
+ * @brief rows के एक block के cells गिनने का SIMD kernel (board_next_stats)
+ *
+ * Cells 0 या 1 हैं, इसलिए bytes का sum ही population है। counts[0] में
+ * cur की population, counts[1] में births (cur & ~old) और counts[2] में
+ * deaths (old & ~cur) जुड़ते हैं। columns[y] में हर row का cur[y] OR होता
+ * है और जिस row r में कोई जीवित cell है उसका bit r live_rows में set
+ * होता है। Horizontal sums पूरे block के बाद एक बार होते हैं।
+ *
+ * @param cur नई generation की पहली row
+ * @param cur_stride cur की rows के बीच bytes
+ * @param old पिछली generation की पहली row (NULL = births/deaths नहीं गिनने)
+ * @param old_stride old की rows के बीच bytes
+ * @param rows rows की संख्या (64 से ज्यादा नहीं)
+ * @param count हर row के कितने columns
+ * @param counts population, births और deaths जोड़ने के लिए array
+ * @param columns हर column का OR accumulator
+ * @param live_rows जीवित cells वाली rows का bitmask (OR होता है)
+ * @return हर row के कितने columns गिने गए (vector width का multiple, count से ज्यादा नहीं)
+ */
+typedef size_t (*SimdBlockCount)(const char *cur, size_t cur_stride, const char *old, size_t old_stride,
+                                 size_t rows, size_t count, uint64_t counts[3], unsigned char *columns,
+                                 uint64_t *live_rows);
+
+/**
+ * @brief इस CPU के लिए best SIMD kernel
+ *
+ * पहली call CPU features detect करती है, इसलिए पहली call worker threads
+ * शुरू होने से पहले होनी चाहिए।
+ *
+ * @return kernel, या SIMD उपलब्ध न हो तो NULL
+ */
+SimdRowKernel simd_row_kernel(void);
+
+/**
+ * @brief simd_row_kernel वाले instruction set का count kernel
+ * @return kernel, या SIMD उपलब्ध न हो तो NULL
+ */
+SimdBlockCount simd_block_count(void);
+
+/**
+ * @brief चुने गए kernel का नाम ("avx2", "neon" या "scalar")
+ * @return kernel का नाम
+ */
+const char *simd_kernel_name(void);
+
+#endif // SIMD_H
@@ -0,0 +1,746 @@
+/**
+ * @file simulator.c
+ * @brief अलग thread पर simulation चलाने वाले simulator का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Triple buffer का "ready" slot एक unsigned है: slot index और
+ * SIMULATOR_FRESH bit। Simulator अपना लिखा हुआ slot उससे exchange करता
+ * है (FRESH set), renderer FRESH दिखने पर अपना पढ़ा हुआ slot उससे
+ * exchange करता है; दोनों तरफ सिर्फ एक atomic exchange है, कोई lock नहीं।
+ *
+ * Command queue एक mutex वाला growable array है। Simulator हर बार पूरी
+ * queue अपने buffer से swap कर लेता है, इसलिए lock सिर्फ swap जितनी देर
+ * रहता है और commands lock के बाहर apply होते हैं।
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "checkpoint.h"
+#include "profile.h"
+#include "scheduler.h"
+#include "simulator.h"
+
+/**
+ * @brief Triple buffer में snapshot boards की संख्या
+ */
+#define SIMULATOR_SNAPSHOTS 3
+
+/**
+ * @brief Ready slot में "नया snapshot, renderer ने अभी नहीं लिया" bit
+ */
+#define SIMULATOR_FRESH 4u
+
+/**
+ * @brief Ready slot में से slot index का mask
+ */
+#define SIMULATOR_SLOT_MASK 3u
+
+/**
+ * @brief Command के प्रकार
+ */
+typedef enum SimCommandType {
+    SIM_PAINT_BATCH = 0, /**< कई cells एक value पर set करें */
+    SIM_CLEAR,          /**< बोर्ड clear करें (और pause) */
+    SIM_RANDOM,         /**< Random board (और pause) */
+    SIM_LOAD,           /**< Pattern file load करें (और pause) */
+    SIM_RULES,          /**< Rules बदलें */
+    SIM_PAUSE,          /**< Pause या resume */
+    SIM_SPEED           /**< Speed बदलें */
+} SimCommandType;
+
+/**
+ * @brief Render thread से simulator को भेजा गया एक command
+ */
+typedef struct SimCommand {
+    SimCommandType type;    /**< Command का प्रकार */
+    size_t count;           /**< SIM_PAINT_BATCH: cells की संख्या */
+    long value;             /**< SIM_PAINT_BATCH: cell value, SIM_PAUSE: paused, SIM_SPEED: generations/second */
+    char *filename;         /**< SIM_LOAD: file का नाम (command का अपना copy) */
+    Rules *rules;           /**< SIM_RULES: नए rules (command का अपना copy) */
+    SimulatorCell *cells;   /**< SIM_PAINT_BATCH: cells (command का अपना copy) */
+} SimCommand;
+
+/**
+ * @brief Simulator का पूरा state
+ */
+struct Simulator {
+    pthread_t thread;               /**< Simulator thread */
+    int running;                    /**< Thread चल रहा है (join बाकी है) */
+
+    pthread_mutex_t lock;           /**< queue, queue_count, queue_capacity और quit को protect करता है */
+    pthread_cond_t wake;            /**< नया command या quit आने पर signal */
+    SimCommand *queue;              /**< Pending commands */
+    size_t queue_count;             /**< Pending commands की संख्या */
+    size_t queue_capacity;          /**< queue की capacity */
+    int quit;                       /**< Thread को रुकना है */
+    int failed;                     /**< Stepping error (atomic) */
+
+    // नीचे के fields सिर्फ simulator thread के हैं (thread रुकने के बाद caller के)
+    SimCommand *work;               /**< Apply हो रहे commands (queue से swap होता है) */
+    size_t work_capacity;           /**< work की capacity */
+    Board *front;                   /**< Current generation */
+    Board *back;                    /**< Next generation का buffer */
+    Rules rules;                    /**< Current rules */
+    ThreadPool *pool;               /**< Board engine के workers */
+    HashLife *life;                 /**< Hashlife universe (NULL = board engine) */
+    uint64_t life_version;          /**< आखिरी Hashlife sync पर front->version (0 = कभी नहीं) */
+    SparseBoard *sparse;            /**< Sparse plane (NULL = sparse engine नहीं) */
+    uint64_t sparse_version;        /**< आखिरी sparse sync पर front->version (0 = कभी नहीं) */
+    int sparse_pending;             /**< Plane front से आगे है (front में लिखना बाकी) */
+    uint64_t generation;            /**< Current generation */
+    int paused;                     /**< Simulation paused है */
+    Scheduler scheduler;            /**< Speed के हिसाब से generations, budget = publish period */
+    const char *checkpoint_filename;    /**< Periodic checkpoints की file (NULL = नहीं) */
+    uint64_t checkpoint_every;      /**< कितनी generations पर checkpoint */
+    Recorder *recorder;             /**< Frame recorder (NULL = नहीं, write error के बाद भी NULL) */
+    SimulatorStepStats steps;       /**< अब तक की stepping (publish पर snapshot के साथ जाती है) */
+    uint64_t random_seed;           /**< अगले SIM_RANDOM board का seed */
+    double random_density;          /**< SIM_RANDOM boards की density */
+
+    // Triple buffer
+    Board *snapshots[SIMULATOR_SNAPSHOTS];              /**< Published generations की copies */
+    uint64_t snapshot_generation[SIMULATOR_SNAPSHOTS];  /**< हर snapshot की generation */
+    SimulatorStepStats snapshot_steps[SIMULATOR_SNAPSHOTS];  /**< हर snapshot तक की stepping stats */
+    unsigned write_slot;            /**< Simulator जिस snapshot में लिखता है */
+    unsigned read_slot;             /**< Renderer जिस snapshot को पढ़ता है */
+    unsigned ready;                 /**< दोनों के बीच वाला slot, SIMULATOR_FRESH के साथ (atomic) */
+};
+
+/**
+ * @brief command के owned buffers free करता है
+ * @param command free करने वाला command
+ */
+static void command_free(SimCommand *command) {
+    free(command->filename);
+    free(command->rules);
+    free(command->cells);
+    command->filename = NULL;
+    command->rules = NULL;
+    command->cells = NULL;
+}
+
+/**
+ * @brief command को queue में जोड़कर simulator को जगाता है
+ *
+ * Fail होने पर command के owned buffers free हो जाते हैं।
+ *
+ * @param sim simulator
+ * @param command जोड़ने वाला command (copy होता है)
+ * @return सफल होने पर 0, memory allocation fail होने पर -1
+ */
+static int simulator_push(Simulator *sim, SimCommand command) {
+    pthread_mutex_lock(&sim->lock);
+    if (sim->queue_count == sim->queue_capacity) {
+        size_t capacity = sim->queue_capacity ? sim->queue_capacity * 2 : 64;
+        SimCommand *queue = realloc(sim->queue, capacity * sizeof(SimCommand));
+        if (queue == NULL) {
+            pthread_mutex_unlock(&sim->lock);
+            command_free(&command);
+            return -1;
+        }
+        sim->queue = queue;
+        sim->queue_capacity = capacity;
+    }
+    sim->queue[sim->queue_count++] = command;
+    pthread_cond_signal(&sim->wake);
+    pthread_mutex_unlock(&sim->lock);
+    return 0;
+}
+
+/**
+ * @brief front को write slot में copy करके publish करता है
+ * @param sim simulator
+ */
+static void simulator_publish(Simulator *sim) {
+    board_copy(sim->snapshots[sim->write_slot], sim->front);
+    sim->snapshot_generation[sim->write_slot] = sim->generation;
+    sim->snapshot_steps[sim->write_slot] = sim->steps;
+
+    // Release: snapshot की writes renderer को exchange के बाद दिखें
+    unsigned previous = __atomic_exchange_n(&sim->ready, sim->write_slot | SIMULATOR_FRESH, __ATOMIC_ACQ_REL);
+    sim->write_slot = previous & SIMULATOR_SLOT_MASK;
+}
+
+/**
+ * @brief Hashlife engine से front को generations आगे बढ़ाता है
+ *
+ * अगर front पिछली sync के बाद बदला है (painting, clear, reload आदि) तो
+ * पहले universe उसी से फिर load होता है। सभी generations एक jump में
+ * होती हैं और result front में वापस लिखा जाता है ताकि publish हो सके।
+ *
+ * @param sim simulator
+ * @param generations कितनी generations
+ * @return सफल होने पर 0, error होने पर -1
+ */
+static int simulator_hashlife_advance(Simulator *sim, uint64_t generations) {
+    // board_init के बाद version कम से कम 1 होता है
+    if (sim->life_version == 0 || sim->front->version != sim->life_version) {
+        if (hashlife_from_board(sim->life, sim->front) != 0) return -1;
+    }
+
+    if (hashlife_step(sim->life, generations) != 0) return -1;
+    if (hashlife_to_board(sim->life, sim->front) != 0) return -1;
+
+    sim->life_version = sim->front->version;
+    return 0;
+}
+
+/**
+ * @brief Sparse engine से एक generation चलाता है
+ *
+ * अगर front पिछली sync के बाद बदला है तो plane उसी window से फिर load
+ * होता है (window के बाहर के cells भी हट जाते हैं)। Result front में तुरंत
+ * नहीं लिखा जाता; simulator_sparse_flush publish या checkpoint से पहले
+ * लिखता है, ताकि max speed पर हर generation window copy न करनी पड़े।
+ *
+ * @param sim simulator
+ * @return सफल होने पर 0, error होने पर -1
+ */
+static int simulator_sparse_advance(Simulator *sim) {
+    if (!sim->sparse_pending && (sim->sparse_version == 0 || sim->front->version != sim->sparse_version)) {
+        if (sparse_board_clear(sim->sparse) != 0) return -1;
+        if (sparse_board_from_board(sim->sparse, sim->front, 0, 0) != 0) return -1;
+    }
+
+    if (sparse_board_next(sim->sparse, &sim->rules) != 0) return -1;
+    sim->sparse_pending = 1;
+    return 0;
+}
+
+/**
+ * @brief Sparse plane की window front में लिखता है (pending हो तो)
+ * @param sim simulator
+ */
+static void simulator_sparse_flush(Simulator *sim) {
+    if (!sim->sparse_pending) return;
+    sparse_board_to_board(sim->sparse, sim->front, 0, 0);
+    sim->sparse_version = sim->front->version;
+    sim->sparse_pending = 0;
+}
+
+/**
+ * @brief front की एक cell set करता है (SIM_PAINT_BATCH की हर cell)
+ * @param sim simulator
+ * @param x cell की row
+ * @param y cell का column
+ * @param value नई cell value
+ * @return cell बदली तो 1, वरना 0
+ */
+static int simulator_set_cell(Simulator *sim, size_t x, size_t y, char value) {
+    Board *board = sim->front;
+    size_t index = BOARD_INDEX(board, x, y);
+
+    if (board->cells[index] == value) return 0;
+    board->cells[index] = value;
+    board_mark_dirty(board, x, y);
+    // Plane sync में हो तो उसे भी बदलें, ताकि पूरा reload न करना पड़े
+    if (sim->sparse != NULL && sim->sparse_version != 0 && sim->sparse_version + 1 == board->version &&
+        sparse_board_set(sim->sparse, (int64_t)x, (int64_t)y, (int)value) == 0) {
+        sim->sparse_version = board->version;
+    }
+    return 1;
+}
+
+/**
+ * @brief एक command apply करता है
+ * @param sim simulator
+ * @param command apply करने वाला command
+ * @return बोर्ड बदला तो 1, वरना 0
+ */
+static int simulator_apply(Simulator *sim, SimCommand *command) {
+    Board *board = sim->front;
+
+    switch (command->type) {
+        case SIM_PAINT_BATCH: {
+            int changed = 0;
+            for (size_t i = 0; i < command->count; i++) {
+                changed |= simulator_set_cell(sim, command->cells[i].x, command->cells[i].y, (char)command->value);
+            }
+            return changed;
+        }
+
+        case SIM_CLEAR:
+            board_clear(board);
+            printf("Board cleared\n");
+            sim->paused = 1;
+            return 1;
+
+        case SIM_RANDOM:
+            // Density simulator_start में ही check हो चुकी है
+            board_random_fill(board, sim->random_seed, sim->random_density, sim->pool);
+            printf("Random board generated (seed %llu)\n", (unsigned long long)sim->random_seed);
+            sim->random_seed++;
+            sim->paused = 1;
+            return 1;
+
+        case SIM_LOAD:
+            printf("Loading board from file: %s\n", command->filename);
+            if (board_from_file(command->filename, board) != 0) {
+                printf("Error loading file: %s\n", command->filename);
+            } else {
+                printf("Board loaded successfully from: %s\n", command->filename);
+            }
+            sim->paused = 1;
+            return 1;
+
+        case SIM_RULES:
+            sim->rules = *command->rules;
+            if (sim->life != NULL && hashlife_set_rules(sim->life, &sim->rules) != 0) {
+                printf("Hashlife does not support this rule set\n");
+                __atomic_store_n(&sim->failed, 1, __ATOMIC_RELEASE);
+            }
+            if (sim->sparse != NULL && ((sim->rules.birth_rules & 1) || sim->rules.kernel != RULES_KERNEL_TOTALISTIC)) {
+                printf("Sparse engine supports only outer-totalistic rules without B0\n");
+                __atomic_store_n(&sim->failed, 1, __ATOMIC_RELEASE);
+            }
+            // पुराने rules में stable tiles नए rules में stable हों, ऐसा जरूरी नहीं
+            board_mark_all_dirty(board);
+            // Cells नहीं बदले, इसलिए plane sync में था तो वैसा ही रहता है
+            if (sim->sparse != NULL && sim->sparse_version != 0 && sim->sparse_version + 1 == board->version) {
+                sim->sparse_version = board->version;
+            }
+            return 1;
+
+        case SIM_PAUSE:
+            sim->paused = command->value != 0;
+            // Pause के बाद pending generations का burst न आए
+            scheduler_reset(&sim->scheduler);
+            return 0;
+
+        case SIM_SPEED:
+            sim->scheduler.rate = (double)command->value;
+            return 0;
+    }
+    return 0;
+}
+
+/**
+ * @brief scheduler जितनी generations दे उतनी चलाता है, publish period के अंदर
+ *
+ * Checkpoint interval पार होने पर checkpoint भी यहीं लिखा जाता है।
+ *
+ * @param sim simulator
+ * @param wait अगली generation due होने तक कितना रुकना है (seconds) store करने के लिए pointer
+ * @return चली generations की संख्या, error होने पर -1
+ */
+static long simulator_run(Simulator *sim, double *wait) {
+    double start = now_seconds();
+    long due = scheduler_begin_frame(&sim->scheduler, start);
+    long done = 0;
+    long batch = 1;
+
+    while (done < due && scheduler_in_budget(&sim->scheduler, start, now_seconds())) {
+        long count = 1;
+        if (sim->life != NULL) {
+            // Hashlife बड़े jumps भी सस्ते में करता है: max speed पर batch दोगुना होता रहता है
+            count = due == LONG_MAX ? batch : due - done;
+            if (simulator_hashlife_advance(sim, (uint64_t)count) != 0) return -1;
+            if (batch < (1L << 30)) batch *= 2;
+        } else if (sim->sparse != NULL) {
+            if (simulator_sparse_advance(sim) != 0) return -1;
+        } else {
+            if (board_next_parallel(sim->front, sim->back, &sim->rules, sim->pool) != 0) return -1;
+            Board *temp = sim->front;
+            sim->front = sim->back;
+            sim->back = temp;
+        }
+        done += count;
+        sim->generation += (uint64_t)count;
+
+        // Checkpoint interval पार हुआ हो तो save करें
+        uint64_t every = sim->checkpoint_every;
+        if (sim->checkpoint_filename && sim->generation / every != (sim->generation - (uint64_t)count) / every) {
+            if (sim->sparse != NULL) simulator_sparse_flush(sim);
+            if (board_save(sim->checkpoint_filename, sim->front, sim->generation, &sim->rules) != 0) {
+                printf("Error writing checkpoint: %s\n", sim->checkpoint_filename);
+            }
+        }
+
+        // Recording fail होने पर simulation चलती रहती है, सिर्फ recording रुकती है
+        if (recorder_due(sim->recorder, sim->generation - (uint64_t)count, sim->generation)) {
+            if (sim->sparse != NULL) simulator_sparse_flush(sim);
+            if (recorder_push(sim->recorder, sim->front, sim->generation) < 0) {
+                printf("Error writing recording, recording stopped\n");
+                sim->recorder = NULL;
+            }
+        }
+    }
+    scheduler_end_frame(&sim->scheduler, done);
+    if (sim->sparse != NULL) simulator_sparse_flush(sim);
+    if (done > 0) {
+        sim->steps.generations += (uint64_t)done;
+        sim->steps.seconds += now_seconds() - start;
+    }
+
+    // Fixed rate पर अगली पूरी generation due होने तक रुकें; max speed पर नहीं
+    *wait = 0;
+    if (sim->scheduler.rate > 0 && sim->scheduler.accumulator < 1) {
+        *wait = (1 - sim->scheduler.accumulator) / sim->scheduler.rate;
+    }
+    return done;
+}
+
+/**
+ * @brief condition variable पर ज्यादा से ज्यादा seconds तक wait करता है (lock held)
+ * @param sim simulator
+ * @param seconds wait का time
+ */
+static void simulator_timed_wait(Simulator *sim, double seconds) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    long long nsec = deadline.tv_nsec + (long long)(seconds * 1e9);
+    deadline.tv_sec += (time_t)(nsec / 1000000000LL);
+    deadline.tv_nsec = (long)(nsec % 1000000000LL);
+
+    // Timeout और signal दोनों पर caller loop फिर से check करता है
+    pthread_cond_timedwait(&sim->wake, &sim->lock, &deadline);
+}
+
+/**
+ * @brief simulator thread का main loop
+ *
+ * हर iteration में pending commands apply होते हैं, फिर (paused न हो तो)
+ * एक publish period तक stepping होती है और बोर्ड बदला हो तो snapshot
+ * publish होता है। करने को कुछ न हो तो thread command या अगली due
+ * generation तक सोता है। Quit पर pending commands apply करके thread
+ * खत्म होता है।
+ *
+ * @param arg simulator
+ * @return NULL
+ */
+static void *simulator_main(void *arg) {
+    Simulator *sim = arg;
+
+    pthread_mutex_lock(&sim->lock);
+    for (;;) {
+        // Queue को अपने buffer से swap करें ताकि commands lock के बाहर apply हों
+        SimCommand *commands = sim->queue;
+        size_t count = sim->queue_count;
+        size_t capacity = sim->queue_capacity;
+        sim->queue = sim->work;
+        sim->queue_capacity = sim->work_capacity;
+        sim->queue_count = 0;
+        sim->work = commands;
+        sim->work_capacity = capacity;
+        int quit = sim->quit;
+        pthread_mutex_unlock(&sim->lock);
+
+        int changed = 0;
+        for (size_t i = 0; i < count; i++) {
+            changed |= simulator_apply(sim, &commands[i]);
+            command_free(&commands[i]);
+        }
+        // Stop से पहले के सभी commands apply हो चुके हैं (final state में दिखें)
+        if (quit) break;
+
+        // wait < 0: अगले command तक सोएं
+        double wait = -1;
+        if (!sim->paused && !simulator_failed(sim)) {
+            long done = simulator_run(sim, &wait);
+            if (done < 0) {
+                printf("Erreur lors du calcul de la prochaine génération\n");
+                __atomic_store_n(&sim->failed, 1, __ATOMIC_RELEASE);
+                wait = -1;
+            }
+            if (done > 0) changed = 1;
+        }
+        if (changed) simulator_publish(sim);
+
+        pthread_mutex_lock(&sim->lock);
+        if (sim->quit || sim->queue_count > 0) continue;
+        if (wait < 0) {
+            pthread_cond_wait(&sim->wake, &sim->lock);
+        } else if (wait > 0) {
+            simulator_timed_wait(sim, wait);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief simulator बनाता है और उसका thread paused state में start करता है
+ * @param config settings (pointer call के बाद रखना जरूरी नहीं, filename रखना जरूरी है)
+ * @return सफल होने पर Simulator pointer, invalid config, memory या thread error पर NULL
+ */
+Simulator *simulator_start(const SimulatorConfig *config) {
+    if (config == NULL || config->front == NULL || config->back == NULL || config->rules == NULL) return NULL;
+    if (config->speed < 0 || config->publish_period <= 0) return NULL;
+    if (config->checkpoint_filename && config->checkpoint_every <= 0) return NULL;
+    if (!(config->random_density >= 0.0 && config->random_density <= 1.0)) return NULL;
+
+    Simulator *sim = calloc(1, sizeof(Simulator));
+    if (sim == NULL) return NULL;
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_mutex_init(&sim->lock, NULL);
+    pthread_cond_init(&sim->wake, &attr);
+    pthread_condattr_destroy(&attr);
+
+    sim->front = config->front;
+    sim->back = config->back;
+    sim->rules = *config->rules;
+    sim->pool = config->pool;
+    sim->life = config->life;
+    sim->sparse = config->sparse;
+    sim->generation = config->generation;
+    sim->paused = 1;
+    sim->checkpoint_filename = config->checkpoint_filename;
+    sim->checkpoint_every = (uint64_t)config->checkpoint_every;
+    sim->recorder = config->recorder;
+    sim->random_seed = config->random_seed;
+    sim->random_density = config->random_density;
+    scheduler_init(&sim->scheduler, (double)config->speed, config->publish_period);
+
+    // Resume के बाद rules universe बनने के बाद बदले हो सकते हैं
+    if (sim->life != NULL && hashlife_set_rules(sim->life, &sim->rules) != 0) {
+        simulator_free(sim);
+        return NULL;
+    }
+    if (sim->sparse != NULL && ((sim->rules.birth_rules & 1) || sim->rules.kernel != RULES_KERNEL_TOTALISTIC)) {
+        simulator_free(sim);
+        return NULL;
+    }
+
+    for (int i = 0; i < SIMULATOR_SNAPSHOTS; i++) {
+        sim->snapshots[i] = board_init_padded(sim->front->height, sim->front->width, sim->front->edge);
+        if (sim->snapshots[i] == NULL) {
+            simulator_free(sim);
+            return NULL;
+        }
+    }
+    sim->read_slot = 0;
+    sim->ready = 1;
+    sim->write_slot = 2;
+    simulator_publish(sim);
+
+    if (pthread_create(&sim->thread, NULL, simulator_main, sim) != 0) {
+        simulator_free(sim);
+        return NULL;
+    }
+    sim->running = 1;
+    return sim;
+}
+
+/**
+ * @brief simulator thread को रोकता है और उसके खत्म होने तक wait करता है
+ * @param sim simulator
+ * @return सफल होने पर 0, NULL pointer या पहले ही रुका हो तो -1
+ */
+int simulator_stop(Simulator *sim) {
+    if (sim == NULL || !sim->running) return -1;
+
+    pthread_mutex_lock(&sim->lock);
+    sim->quit = 1;
+    pthread_cond_signal(&sim->wake);
+    pthread_mutex_unlock(&sim->lock);
+
+    pthread_join(sim->thread, NULL);
+    sim->running = 0;
+    return 0;
+}
+
+/**
+ * @brief simulator की memory free करता है (चल रहा हो तो पहले रोकता है)
+ * @param sim free करने वाला simulator (NULL हो सकता है)
+ */
+void simulator_free(Simulator *sim) {
+    if (sim == NULL) return;
+
+    if (sim->running) {
+        simulator_stop(sim);
+    }
+    for (int i = 0; i < SIMULATOR_SNAPSHOTS; i++) {
+        if (sim->snapshots[i] != NULL) board_free(sim->snapshots[i]);
+    }
+    free(sim->queue);
+    free(sim->work);
+    pthread_mutex_destroy(&sim->lock);
+    pthread_cond_destroy(&sim->wake);
+    free(sim);
+}
+
+/**
+ * @brief latest publish हुआ snapshot लेता है (render thread, कभी block नहीं होता)
+ * @param sim simulator
+ * @param generation snapshot की generation store करने के लिए pointer (NULL हो सकता है)
+ * @return snapshot board, NULL pointer होने पर NULL
+ */
+Board *simulator_acquire(Simulator *sim, uint64_t *generation) {
+    if (sim == NULL) return NULL;
+
+    if (__atomic_load_n(&sim->ready, __ATOMIC_ACQUIRE) & SIMULATOR_FRESH) {
+        // Acquire: simulator की snapshot writes exchange के बाद दिखती हैं
+        unsigned previous = __atomic_exchange_n(&sim->ready, sim->read_slot, __ATOMIC_ACQ_REL);
+        sim->read_slot = previous & SIMULATOR_SLOT_MASK;
+    }
+    if (generation) *generation = sim->snapshot_generation[sim->read_slot];
+    return sim->snapshots[sim->read_slot];
+}
+
+/**
+ * @brief पिछले simulator_acquire वाले snapshot तक की stepping stats देता है (render thread)
+ * @param sim simulator
+ * @param stats result store करने के लिए pointer
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int simulator_step_stats(const Simulator *sim, SimulatorStepStats *stats) {
+    if (sim == NULL || stats == NULL) return -1;
+    *stats = sim->snapshot_steps[sim->read_slot];
+    return 0;
+}
+
+/**
+ * @brief कई cells को एक ही value पर set करने का एक command queue करता है
+ *
+ * Out of bounds cells यहीं हट जाती हैं, ताकि simulator thread हर cell
+ * बिना check के apply करे।
+ *
+ * @param sim simulator
+ * @param cells cells का array (copy होता है)
+ * @param count cells की संख्या (0 पर कुछ queue नहीं होता)
+ * @param alive 1 = जीवित, 0 = मृत
+ * @return सफल होने पर 0, NULL pointer या memory error पर -1
+ */
+int simulator_paint_batch(Simulator *sim, const SimulatorCell *cells, size_t count, int alive) {
+    if (sim == NULL || (cells == NULL && count > 0)) return -1;
+    if (count == 0) return 0;
+
+    SimCommand command = { SIM_PAINT_BATCH, 0, alive != 0, NULL, NULL, malloc(count * sizeof(SimulatorCell)) };
+    if (command.cells == NULL) return -1;
+    const Board *board = sim->snapshots[0];
+    for (size_t i = 0; i < count; i++) {
+        if (cells[i].x < board->height && cells[i].y < board->width) command.cells[command.count++] = cells[i];
+    }
+    if (command.count == 0) {
+        command_free(&command);
+        return 0;
+    }
+    return simulator_push(sim, command);
+}
+
+/**
+ * @brief बोर्ड clear करने का command queue करता है (simulation pause होती है)
+ * @param sim simulator
+ * @return सफल होने पर 0, NULL pointer या memory error पर -1
+ */
+int simulator_clear(Simulator *sim) {
+    if (sim == NULL) return -1;
+
+    SimCommand command = { SIM_CLEAR, 0, 0, NULL, NULL, NULL };
+    return simulator_push(sim, command);
+}
+
+/**
+ * @brief random board का command queue करता है (simulation pause होती है)
+ * @param sim simulator
+ * @return सफल होने पर 0, NULL pointer या memory error पर -1
+ */
+int simulator_random_fill(Simulator *sim) {
+    if (sim == NULL) return -1;
+
+    SimCommand command = { SIM_RANDOM, 0, 0, NULL, NULL, NULL };
+    return simulator_push(sim, command);
+}
+
+/**
+ * @brief pattern file load करने का command queue करता है (simulation pause होती है)
+ * @param sim simulator
+ * @param filename pattern file (copy होता है)
+ * @return सफल होने पर 0, NULL pointer या memory error पर -1
+ */
+int simulator_load(Simulator *sim, const char *filename) {
+    if (sim == NULL || filename == NULL) return -1;
+
+    SimCommand command = { SIM_LOAD, 0, 0, malloc(strlen(filename) + 1), NULL, NULL };
+    if (command.filename == NULL) return -1;
+    strcpy(command.filename, filename);
+    return simulator_push(sim, command);
+}
+
+/**
+ * @brief rules बदलने का command queue करता है
+ * @param sim simulator
+ * @param rules नए rules (copy होते हैं)
+ * @return सफल होने पर 0, NULL pointer या memory error पर -1
+ */
+int simulator_set_rules(Simulator *sim, const Rules *rules) {
+    if (sim == NULL || rules == NULL) return -1;
+
+    SimCommand command = { SIM_RULES, 0, 0, NULL, malloc(sizeof(Rules)), NULL };
+    if (command.rules == NULL) return -1;
+    *command.rules = *rules;
+    return simulator_push(sim, command);
+}
+
+/**
+ * @brief simulation pause या resume करने का command queue करता है
+ * @param sim simulator
+ * @param paused 1 = pause, 0 = चलाएं
+ * @return सफल होने पर 0, NULL pointer या memory error पर -1
+ */
+int simulator_set_paused(Simulator *sim, int paused) {
+    if (sim == NULL) return -1;
+
+    SimCommand command = { SIM_PAUSE, 0, paused != 0, NULL, NULL, NULL };
+    return simulator_push(sim, command);
+}
+
+/**
+ * @brief simulation speed बदलने का command queue करता है
+ * @param sim simulator
+ * @param speed target generations/second (0 = max)
+ * @return सफल होने पर 0, NULL pointer, negative speed या memory error पर -1
+ */
+int simulator_set_speed(Simulator *sim, long speed) {
+    if (sim == NULL || speed < 0) return -1;
+
+    SimCommand command = { SIM_SPEED, 0, speed, NULL, NULL, NULL };
+    return simulator_push(sim, command);
+}
+
+/**
+ * @brief simulator thread में stepping error हुई या नहीं
+ * @param sim simulator
+ * @return error हुई तो 1, वरना 0
+ */
+int simulator_failed(const Simulator *sim) {
+    if (sim == NULL) return 0;
+    return __atomic_load_n(&sim->failed, __ATOMIC_ACQUIRE) != 0;
+}
+
+/**
+ * @brief simulator का current board (सिर्फ simulator_stop के बाद call करें)
+ * @param sim simulator
+ * @return current generation का board, NULL pointer होने पर NULL
+ */
+const Board *simulator_board(const Simulator *sim) {
+    return sim ? sim->front : NULL;
+}
+
+/**
+ * @brief simulator की current generation (सिर्फ simulator_stop के बाद call करें)
+ * @param sim simulator
+ * @return generation, NULL pointer होने पर 0
+ */
+uint64_t simulator_generation(const Simulator *sim) {
+    return sim ? sim->generation : 0;
+}
+
+/**
+ * @brief simulator के current rules (सिर्फ simulator_stop के बाद call करें)
+ * @param sim simulator
+ * @return rules, NULL pointer होने पर NULL
+ */
+const Rules *simulator_rules(const Simulator *sim) {
+    return sim ? &sim->rules : NULL;
+}
@@ -0,0 +1,231 @@
+/**
+ * @file simulator.h
+ * @brief अलग thread पर simulation चलाने वाले simulator का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Simulator अपने thread पर front/back boards (double buffer) को step करता
+ * है, ताकि बड़े बोर्ड पर धीमी generation से input और rendering न रुकें।
+ * हर completed generation (या max speed पर हर publish period में आखिरी
+ * generation) तीन snapshot boards के triple buffer में publish होती है:
+ * simulator एक snapshot में लिखता है, renderer दूसरा पढ़ता है, और तीसरा
+ * "ready" slot दोनों के बीच एक atomic exchange से बदलता है। इसलिए render
+ * thread कभी block नहीं होता और हमेशा latest publish हुई generation
+ * draw करता है। Snapshot में board_copy से सिर्फ बदली हुई tiles copy
+ * होती हैं।
+ *
+ * Board बदलने वाले सभी काम (painting, clear, random, reload, rule switch,
+ * pause, speed) commands के रूप में queue होते हैं और simulator उन्हें
+ * अगली generation से पहले उसी क्रम में apply करता है; render thread
+ * simulator के boards को कभी directly नहीं छूता। Periodic checkpoints भी
+ * simulator thread पर लिखे जाते हैं।
+ *
+ * इस module में SDL पर कोई dependency नहीं है।
+ */
+
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include <stdint.h>
+
+#include "board.h"
+#include "hashlife.h"
+#include "pool.h"
+#include "record.h"
+#include "rules.h"
+#include "sparse_board.h"
+
+/**
+ * @brief Simulator के शुरुआती settings
+ *
+ * Boards, pool, Hashlife universe और sparse plane caller के ही रहते हैं, पर simulator
+ * चलने के दौरान (simulator_stop तक) सिर्फ simulator thread उन्हें use करता है।
+ */
+typedef struct SimulatorConfig {
+    Board *front;                       /**< Current generation (simulator stepping के साथ front/back swap करता है) */
+    Board *back;                        /**< Next generation का buffer (front जैसी size और edge) */
+    const Rules *rules;                 /**< शुरुआती rules (copy होते हैं) */
+    ThreadPool *pool;                   /**< Board engine के workers */
+    HashLife *life;                     /**< Hashlife universe (NULL = board engine) */
+    SparseBoard *sparse;                /**< Sparse plane, जिसकी (0, 0) वाली window front है (NULL = नहीं) */
+    uint64_t generation;                /**< शुरुआती generation (resume के बाद non-zero) */
+    long speed;                         /**< Target generations/second (0 = max) */
+    double publish_period;              /**< Max speed पर snapshot कितनी बार publish हो (seconds, आमतौर पर frame period) */
+    const char *checkpoint_filename;    /**< Periodic checkpoints की file (NULL = नहीं) */
+    long checkpoint_every;              /**< कितनी generations पर checkpoint */
+    Recorder *recorder;                 /**< Stepping से बनी due generations यहाँ push होती हैं (NULL = recording नहीं, caller का) */
+    uint64_t random_seed;               /**< SIM_RANDOM के पहले board का seed (हर बार एक बढ़ता है) */
+    double random_density;              /**< SIM_RANDOM boards में जीवित cells का fraction */
+} SimulatorConfig;
+
+/**
+ * @brief Paint batch की एक cell
+ */
+typedef struct SimulatorCell {
+    size_t x;               /**< Cell की row */
+    size_t y;               /**< Cell का column */
+} SimulatorCell;
+
+/**
+ * @brief Simulator thread की stepping का हिसाब (start से cumulative)
+ */
+typedef struct SimulatorStepStats {
+    uint64_t generations;   /**< चली generations */
+    double seconds;         /**< उनकी stepping का time (commands और waits नहीं) */
+} SimulatorStepStats;
+
+/**
+ * @brief Opaque simulator structure
+ */
+typedef struct Simulator Simulator;
+
+/**
+ * @brief simulator बनाता है और उसका thread paused state में start करता है
+ *
+ * Start से पहले front का पहला snapshot publish हो जाता है।
+ *
+ * @param config settings (pointer call के बाद रखना जरूरी नहीं, filename रखना जरूरी है)
+ * @return सफल होने पर Simulator pointer, invalid config, memory या thread error पर NULL
+ */
+Simulator *simulator_start(const SimulatorConfig *config);
+
+/**
+ * @brief simulator thread को रोकता है और उसके खत्म होने तक wait करता है
+ *
+ * इसके बाद simulator_board, simulator_generation और simulator_rules
+ * final state देते हैं (जैसे exit checkpoint के लिए)। Stop से पहले queue
+ * हुए commands thread खत्म होने से पहले apply हो जाते हैं।
+ *
+ * @param sim simulator
+ * @return सफल होने पर 0, NULL pointer या पहले ही रुका हो तो -1
+ */
+int simulator_stop(Simulator *sim);
+
+/**
+ * @brief simulator की memory free करता है (चल रहा हो तो पहले रोकता है)
+ *
+ * Config के boards, pool, universe और sparse plane free नहीं होते।
+ *
+ * @param sim free करने वाला simulator (NULL हो सकता है)
+ */
+void simulator_free(Simulator *sim);
+
+/**
+ * @brief latest publish हुआ snapshot लेता है (render thread, कभी block नहीं होता)
+ *
+ * Returned board अगले simulator_acquire तक valid है और उस दौरान बदलता नहीं।
+ * नया snapshot न हो तो पिछला ही मिलता है।
+ *
+ * @param sim simulator
+ * @param generation snapshot की generation store करने के लिए pointer (NULL हो सकता है)
+ * @return snapshot board, NULL pointer होने पर NULL
+ */
+Board *simulator_acquire(Simulator *sim, uint64_t *generation);
+
+/**
+ * @brief पिछले simulator_acquire वाले snapshot तक की stepping stats देता है (render thread)
+ *
+ * Stats हर publish पर snapshot के साथ जाती हैं और cumulative हैं, इसलिए
+ * दो acquires के values का फर्क बीच में publish हुए सभी batches का step
+ * time है, renderer ने कोई snapshot छोड़ा हो तब भी।
+ *
+ * @param sim simulator
+ * @param stats result store करने के लिए pointer
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int simulator_step_stats(const Simulator *sim, SimulatorStepStats *stats);
+
+/**
+ * @brief कई cells को एक ही value पर set करने का एक command queue करता है
+ *
+ * एक frame के सभी paint edits (drag की interpolated line सहित) एक
+ * command में जाते हैं, इसलिए simulator उन्हें एक साथ apply करके एक ही
+ * snapshot publish करता है। Out of bounds cells skip होती हैं।
+ *
+ * @param sim simulator
+ * @param cells cells का array (copy होता है)
+ * @param count cells की संख्या (0 पर कुछ queue नहीं होता)
+ * @param alive 1 = जीवित, 0 = मृत
+ * @return सफल होने पर 0, NULL pointer या memory error पर -1
+ */
+int simulator_paint_batch(Simulator *sim, const SimulatorCell *cells, size_t count, int alive);
+
+/**
+ * @brief बोर्ड clear करने का command queue करता है (simulation pause होती है)
+ * @param sim simulator
+ * @return सफल होने पर 0, NULL pointer या memory error पर -1
+ */
+int simulator_clear(Simulator *sim);
+
+/**
+ * @brief random board का command queue करता है (simulation pause होती है)
+ * @param sim simulator
+ * @return सफल होने पर 0, NULL pointer या memory error पर -1
+ */
+int simulator_random_fill(Simulator *sim);
+
+/**
+ * @brief pattern file load करने का command queue करता है (simulation pause होती है)
+ * @param sim simulator
+ * @param filename pattern file (copy होता है)
+ * @return सफल होने पर 0, NULL pointer या memory error पर -1
+ */
+int simulator_load(Simulator *sim, const char *filename);
+
+/**
+ * @brief rules बदलने का command queue करता है
+ *
+ * Hashlife universe या sparse engine उन rules को support न करे तो
+ * simulator failed हो जाता है।
+ *
+ * @param sim simulator
+ * @param rules नए rules (copy होते हैं)
+ * @return सफल होने पर 0, NULL pointer या memory error पर -1
+ */
+int simulator_set_rules(Simulator *sim, const Rules *rules);
+
+/**
+ * @brief simulation pause या resume करने का command queue करता है
+ * @param sim simulator
+ * @param paused 1 = pause, 0 = चलाएं
+ * @return सफल होने पर 0, NULL pointer या memory error पर -1
+ */
+int simulator_set_paused(Simulator *sim, int paused);
+
+/**
+ * @brief simulation speed बदलने का command queue करता है
+ * @param sim simulator
+ * @param speed target generations/second (0 = max)
+ * @return सफल होने पर 0, NULL pointer, negative speed या memory error पर -1
+ */
+int simulator_set_speed(Simulator *sim, long speed);
+
+/**
+ * @brief simulator thread में stepping error हुई या नहीं
+ * @param sim simulator
+ * @return error हुई तो 1, वरना 0
+ */
+int simulator_failed(const Simulator *sim);
+
+/**
+ * @brief simulator का current board (सिर्फ simulator_stop के बाद call करें)
+ * @param sim simulator
+ * @return current generation का board, NULL pointer होने पर NULL
+ */
+const Board *simulator_board(const Simulator *sim);
+
+/**
+ * @brief simulator की current generation (सिर्फ simulator_stop के बाद call करें)
+ * @param sim simulator
+ * @return generation, NULL pointer होने पर 0
+ */
+uint64_t simulator_generation(const Simulator *sim);
+
+/**
+ * @brief simulator के current rules (सिर्फ simulator_stop के बाद call करें)
+ * @param sim simulator
+ * @return rules, NULL pointer होने पर NULL
+ */
+const Rules *simulator_rules(const Simulator *sim);
+
+#endif // SIMULATOR_H
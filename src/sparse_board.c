@@ -0,0 +1,631 @@
+/**
+ * @file sparse_board.c
+ * @brief Unbounded plane के लिए sparse (chunked) बोर्ड का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Stepping हर generation में नया map बनाती है: हर मौजूदा chunk और उसके
+ * वो खाली neighbor positions जिनकी तरफ किनारे पर जीवित cells हैं, compute
+ * होते हैं, और जिनमें कोई जीवित cell बची वही नए map में जाते हैं। B0 rules
+ * में खाली chunks भी जीवित हो जाते, इसलिए वो support नहीं हैं।
+ *
+ * Free हुए chunks एक free list में reuse के लिए रहते हैं, पर live chunks
+ * से ज्यादा नहीं; बाकी वापस free हो जाते हैं।
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "packed_board.h"
+#include "sparse_board.h"
+
+/**
+ * @brief नए map की शुरुआती capacity (2 की power)
+ */
+#define SPARSE_MAP_MIN_CAPACITY 64
+
+/**
+ * @brief खाली chunk (बाहर के neighbors के लिए)
+ */
+static const uint64_t empty_rows[SPARSE_CHUNK_SIZE];
+
+/**
+ * @brief cell coordinate का chunk coordinate (floor division)
+ * @param v cell coordinate
+ * @return chunk coordinate
+ */
+static inline int64_t chunk_coord(int64_t v) {
+    return v >= 0 ? v / SPARSE_CHUNK_SIZE : -((-(v + 1)) / SPARSE_CHUNK_SIZE) - 1;
+}
+
+/**
+ * @brief chunk coordinates का hash
+ * @param cx chunk row
+ * @param cy chunk column
+ * @return hash value
+ */
+static inline uint64_t chunk_hash(int64_t cx, int64_t cy) {
+    uint64_t h = (uint64_t)cx * 0x9E3779B97F4A7C15ULL ^ ((uint64_t)cy + 0x632BE59BD9B4E019ULL) * 0xC2B2AE3D27D4EB4FULL;
+    return h ^ (h >> 29);
+}
+
+/**
+ * @brief map की slots allocate करता है
+ * @param map target map
+ * @param capacity slots की संख्या (2 की power)
+ * @return सफल होने पर 0, memory allocation fail होने पर -1
+ */
+static int map_init(SparseMap *map, size_t capacity) {
+    map->slots = calloc(capacity, sizeof(SparseChunk *));
+    if (map->slots == NULL) return -1;
+    map->capacity = capacity;
+    map->count = 0;
+    return 0;
+}
+
+/**
+ * @brief chunk का slot ढूंढता है (chunk न हो तो वो खाली slot जहाँ वो जाएगा)
+ * @param map source map
+ * @param cx chunk row
+ * @param cy chunk column
+ * @return slot index
+ */
+static size_t map_slot(const SparseMap *map, int64_t cx, int64_t cy) {
+    size_t mask = map->capacity - 1;
+    size_t i = (size_t)chunk_hash(cx, cy) & mask;
+    while (map->slots[i] != NULL && (map->slots[i]->cx != cx || map->slots[i]->cy != cy)) {
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+/**
+ * @brief chunk ढूंढता है
+ * @param map source map
+ * @param cx chunk row
+ * @param cy chunk column
+ * @return chunk, या न हो तो NULL
+ */
+static SparseChunk *map_find(const SparseMap *map, int64_t cx, int64_t cy) {
+    return map->slots[map_slot(map, cx, cy)];
+}
+
+/**
+ * @brief chunk map में डालता है (same coordinates वाला chunk पहले से नहीं होना चाहिए)
+ *
+ * Load factor 1/2 से ऊपर जाने पर capacity दोगुनी होती है।
+ *
+ * @param map target map
+ * @param chunk डालने वाला chunk
+ * @return सफल होने पर 0, memory allocation fail होने पर -1
+ */
+static int map_insert(SparseMap *map, SparseChunk *chunk) {
+    if ((map->count + 1) * 2 > map->capacity) {
+        SparseMap grown;
+        if (map_init(&grown, map->capacity * 2) != 0) return -1;
+        for (size_t i = 0; i < map->capacity; i++) {
+            SparseChunk *c = map->slots[i];
+            if (c != NULL) grown.slots[map_slot(&grown, c->cx, c->cy)] = c;
+        }
+        grown.count = map->count;
+        free(map->slots);
+        *map = grown;
+    }
+
+    map->slots[map_slot(map, chunk->cx, chunk->cy)] = chunk;
+    map->count++;
+    return 0;
+}
+
+/**
+ * @brief chunk को map से हटाता है (backward-shift deletion, tombstones नहीं)
+ * @param map target map
+ * @param slot हटाने वाले chunk का slot
+ */
+static void map_remove_slot(SparseMap *map, size_t slot) {
+    size_t mask = map->capacity - 1;
+    map->slots[slot] = NULL;
+    map->count--;
+
+    // बाद वाले chunks जिनका home slot खाली हुए slot से पहले (या उस पर) है, पीछे खसकाएं
+    for (size_t i = (slot + 1) & mask; map->slots[i] != NULL; i = (i + 1) & mask) {
+        size_t home = (size_t)chunk_hash(map->slots[i]->cx, map->slots[i]->cy) & mask;
+        if (((i - home) & mask) >= ((i - slot) & mask)) {
+            map->slots[slot] = map->slots[i];
+            map->slots[i] = NULL;
+            slot = i;
+        }
+    }
+}
+
+/**
+ * @brief खाली chunk लेता है (free list से या नया)
+ * @param board sparse बोर्ड
+ * @param cx chunk row
+ * @param cy chunk column
+ * @return chunk (सभी cells मृत), memory allocation fail होने पर NULL
+ */
+static SparseChunk *chunk_alloc(SparseBoard *board, int64_t cx, int64_t cy) {
+    SparseChunk *chunk = board->free_chunks;
+    if (chunk != NULL) {
+        board->free_chunks = chunk->next_free;
+        board->free_count--;
+    } else {
+        chunk = malloc(sizeof(SparseChunk));
+        if (chunk == NULL) return NULL;
+    }
+
+    memset(chunk->rows, 0, sizeof(chunk->rows));
+    chunk->cx = cx;
+    chunk->cy = cy;
+    chunk->population = 0;
+    chunk->next_free = NULL;
+    return chunk;
+}
+
+/**
+ * @brief chunk को free list में वापस डालता है
+ * @param board sparse बोर्ड
+ * @param chunk free करने वाला chunk
+ */
+static void chunk_release(SparseBoard *board, SparseChunk *chunk) {
+    chunk->next_free = board->free_chunks;
+    board->free_chunks = chunk;
+    board->free_count++;
+}
+
+/**
+ * @brief map के सभी chunks free list में डालकर map खाली करता है
+ * @param board sparse बोर्ड
+ * @param map खाली करने वाला map
+ */
+static void map_release_all(SparseBoard *board, SparseMap *map) {
+    for (size_t i = 0; i < map->capacity; i++) {
+        if (map->slots[i] != NULL) chunk_release(board, map->slots[i]);
+        map->slots[i] = NULL;
+    }
+    map->count = 0;
+}
+
+/**
+ * @brief free list को live chunks की संख्या तक छोटा करता है
+ * @param board sparse बोर्ड
+ */
+static void trim_free_list(SparseBoard *board) {
+    while (board->free_count > board->map.count) {
+        SparseChunk *chunk = board->free_chunks;
+        board->free_chunks = chunk->next_free;
+        board->free_count--;
+        free(chunk);
+    }
+}
+
+/**
+ * @brief नया खाली sparse बोर्ड बनाता है
+ * @return सफल होने पर SparseBoard pointer, memory allocation fail होने पर NULL
+ */
+SparseBoard *sparse_board_init(void) {
+    SparseBoard *board = calloc(1, sizeof(SparseBoard));
+    if (board == NULL) return NULL;
+
+    if (map_init(&board->map, SPARSE_MAP_MIN_CAPACITY) != 0 ||
+        map_init(&board->scratch, SPARSE_MAP_MIN_CAPACITY) != 0) {
+        free(board->map.slots);
+        free(board);
+        return NULL;
+    }
+    return board;
+}
+
+/**
+ * @brief sparse बोर्ड और उसके सभी chunks की memory free करता है
+ * @param board free करने वाला बोर्ड
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int sparse_board_free(SparseBoard *board) {
+    if (board == NULL) return -1;
+
+    sparse_board_clear(board);
+    free(board->map.slots);
+    free(board->scratch.slots);
+    free(board);
+    return 0;
+}
+
+/**
+ * @brief सभी cells मृत करता है (सभी chunks free होते हैं)
+ * @param board clear करने वाला बोर्ड
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int sparse_board_clear(SparseBoard *board) {
+    if (board == NULL) return -1;
+
+    map_release_all(board, &board->map);
+    trim_free_list(board);
+    return 0;
+}
+
+/**
+ * @brief एक cell की value पढ़ता है
+ * @param board source बोर्ड
+ * @param x row
+ * @param y column
+ * @return cell जीवित है तो 1, वरना 0
+ */
+int sparse_board_get(const SparseBoard *board, int64_t x, int64_t y) {
+    if (board == NULL) return 0;
+
+    int64_t cx = chunk_coord(x), cy = chunk_coord(y);
+    const SparseChunk *chunk = map_find(&board->map, cx, cy);
+    if (chunk == NULL) return 0;
+    return (int)((chunk->rows[x - cx * SPARSE_CHUNK_SIZE] >> (y - cy * SPARSE_CHUNK_SIZE)) & 1);
+}
+
+/**
+ * @brief एक cell की value set करता है (जरूरत हो तो chunk allocate या free होता है)
+ * @param board target बोर्ड
+ * @param x row
+ * @param y column
+ * @param alive नई value (0=मृत, non-zero=जीवित)
+ * @return सफल होने पर 0, NULL pointer या memory allocation fail होने पर -1
+ */
+int sparse_board_set(SparseBoard *board, int64_t x, int64_t y, int alive) {
+    if (board == NULL) return -1;
+
+    int64_t cx = chunk_coord(x), cy = chunk_coord(y);
+    size_t slot = map_slot(&board->map, cx, cy);
+    SparseChunk *chunk = board->map.slots[slot];
+    if (chunk == NULL) {
+        if (!alive) return 0;
+        chunk = chunk_alloc(board, cx, cy);
+        if (chunk == NULL) return -1;
+        if (map_insert(&board->map, chunk) != 0) {
+            chunk_release(board, chunk);
+            return -1;
+        }
+        slot = map_slot(&board->map, cx, cy);
+    }
+
+    uint64_t *row = &chunk->rows[x - cx * SPARSE_CHUNK_SIZE];
+    uint64_t bit = (uint64_t)1 << (y - cy * SPARSE_CHUNK_SIZE);
+    if (((*row & bit) != 0) == (alive != 0)) return 0;
+
+    *row ^= bit;
+    if (alive) {
+        chunk->population++;
+    } else {
+        chunk->population--;
+    }
+
+    if (chunk->population == 0) {
+        map_remove_slot(&board->map, slot);
+        chunk_release(board, chunk);
+        trim_free_list(board);
+    }
+    return 0;
+}
+
+/**
+ * @brief map से खाली chunks हटाता है (scratch map में rebuild करके)
+ * @param board sparse बोर्ड
+ * @return सफल होने पर 0, memory allocation fail होने पर -1
+ */
+static int sparse_prune(SparseBoard *board) {
+    SparseMap *next = &board->scratch;
+    memset(next->slots, 0, next->capacity * sizeof(SparseChunk *));
+    next->count = 0;
+
+    for (size_t i = 0; i < board->map.capacity; i++) {
+        SparseChunk *chunk = board->map.slots[i];
+        if (chunk == NULL || chunk->population == 0) continue;
+        if (map_insert(next, chunk) != 0) {
+            // Map जैसा था वैसा रहता है (खाली chunks सहित)
+            memset(next->slots, 0, next->capacity * sizeof(SparseChunk *));
+            next->count = 0;
+            return -1;
+        }
+    }
+    for (size_t i = 0; i < board->map.capacity; i++) {
+        SparseChunk *chunk = board->map.slots[i];
+        if (chunk != NULL && chunk->population == 0) chunk_release(board, chunk);
+    }
+
+    SparseMap temp = board->map;
+    board->map = board->scratch;
+    board->scratch = temp;
+    trim_free_list(board);
+    return 0;
+}
+
+/**
+ * @brief Board के cells plane में (x0, y0) से शुरू होने वाली window में लिखता है
+ *
+ * हर row के cells chunk के हिसाब से segments में pack होकर एक mask से
+ * लिखे जाते हैं; खाली segments के लिए chunk allocate नहीं होता।
+ *
+ * @param dst target sparse बोर्ड
+ * @param src source Board
+ * @param x0 Board की row 0 की plane row
+ * @param y0 Board के column 0 का plane column
+ * @return सफल होने पर 0, NULL pointer या memory allocation fail होने पर -1
+ */
+int sparse_board_from_board(SparseBoard *dst, const Board *src, int64_t x0, int64_t y0) {
+    if (dst == NULL || src == NULL) return -1;
+
+    for (size_t x = 0; x < src->height; x++) {
+        const char *cells = &src->cells[BOARD_INDEX(src, x, 0)];
+        int64_t px = x0 + (int64_t)x;
+        int64_t cx = chunk_coord(px);
+        size_t r = (size_t)(px - cx * SPARSE_CHUNK_SIZE);
+
+        for (size_t y = 0; y < src->width;) {
+            int64_t py = y0 + (int64_t)y;
+            int64_t cy = chunk_coord(py);
+            size_t offset = (size_t)(py - cy * SPARSE_CHUNK_SIZE);
+            size_t n = SPARSE_CHUNK_SIZE - offset;
+            if (n > src->width - y) n = src->width - y;
+
+            uint64_t bits = 0;
+            for (size_t k = 0; k < n; k++) {
+                bits |= (uint64_t)(cells[y + k] & 1) << (offset + k);
+            }
+            uint64_t mask = (n == SPARSE_CHUNK_SIZE ? ~(uint64_t)0 : (((uint64_t)1 << n) - 1)) << offset;
+
+            SparseChunk *chunk = map_find(&dst->map, cx, cy);
+            if (chunk == NULL && bits != 0) {
+                chunk = chunk_alloc(dst, cx, cy);
+                if (chunk == NULL) return -1;
+                if (map_insert(&dst->map, chunk) != 0) {
+                    chunk_release(dst, chunk);
+                    return -1;
+                }
+            }
+            if (chunk != NULL) {
+                chunk->population -= (uint64_t)__builtin_popcountll(chunk->rows[r] & mask);
+                chunk->rows[r] = (chunk->rows[r] & ~mask) | bits;
+                chunk->population += (uint64_t)__builtin_popcountll(bits);
+            }
+            y += n;
+        }
+    }
+
+    return sparse_prune(dst);
+}
+
+/**
+ * @brief plane की (x0, y0) से शुरू होने वाली window Board में copy करता है
+ *
+ * Board tile by tile भरा जाता है; हर row में ज्यादा से ज्यादा दो chunks
+ * lookup होते हैं। जिन tiles का content बदला सिर्फ वही dirty mark होती
+ * हैं, ताकि renderer और stepping बाकी tiles skip कर सकें।
+ *
+ * @param src source sparse बोर्ड
+ * @param dst target Board
+ * @param x0 Board की row 0 की plane row
+ * @param y0 Board के column 0 का plane column
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int sparse_board_to_board(const SparseBoard *src, Board *dst, int64_t x0, int64_t y0) {
+    if (src == NULL || dst == NULL) return -1;
+
+    char row[BOARD_TILE_SIZE];
+    for (size_t tx = 0; tx < dst->tile_rows; tx++) {
+        size_t x_end = (tx + 1) * BOARD_TILE_SIZE < dst->height ? (tx + 1) * BOARD_TILE_SIZE : dst->height;
+        for (size_t ty = 0; ty < dst->tile_cols; ty++) {
+            size_t y_begin = ty * BOARD_TILE_SIZE;
+            size_t span = dst->width - y_begin < BOARD_TILE_SIZE ? dst->width - y_begin : BOARD_TILE_SIZE;
+            int changed = 0;
+
+            for (size_t x = tx * BOARD_TILE_SIZE; x < x_end; x++) {
+                int64_t px = x0 + (int64_t)x;
+                int64_t cx = chunk_coord(px);
+                size_t r = (size_t)(px - cx * SPARSE_CHUNK_SIZE);
+                int64_t last_cy = 0;
+                const SparseChunk *chunk = NULL;
+
+                for (size_t y = 0; y < span; y++) {
+                    int64_t py = y0 + (int64_t)(y_begin + y);
+                    int64_t cy = chunk_coord(py);
+                    if (y == 0 || cy != last_cy) {
+                        chunk = map_find(&src->map, cx, cy);
+                        last_cy = cy;
+                    }
+                    row[y] = chunk ? (char)((chunk->rows[r] >> (py - cy * SPARSE_CHUNK_SIZE)) & 1) : 0;
+                }
+
+                char *cells = &dst->cells[BOARD_INDEX(dst, x, y_begin)];
+                if (memcmp(cells, row, span) != 0) {
+                    memcpy(cells, row, span);
+                    changed = 1;
+                }
+            }
+            if (changed) board_mark_dirty(dst, tx * BOARD_TILE_SIZE, y_begin);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief chunk का कोई जीवित cell (di, dj) दिशा वाले neighbor को छूता है या नहीं
+ * @param chunk source chunk
+ * @param any chunk की सभी rows का OR
+ * @param di row दिशा (-1, 0, 1)
+ * @param dj column दिशा (-1, 0, 1)
+ * @return छूता है तो 1, वरना 0
+ */
+static int chunk_touches(const SparseChunk *chunk, uint64_t any, int di, int dj) {
+    uint64_t mask = dj < 0 ? (uint64_t)1 : dj > 0 ? (uint64_t)1 << (SPARSE_CHUNK_SIZE - 1) : ~(uint64_t)0;
+    if (di < 0) return (chunk->rows[0] & mask) != 0;
+    if (di > 0) return (chunk->rows[SPARSE_CHUNK_SIZE - 1] & mask) != 0;
+    return (any & mask) != 0;
+}
+
+/**
+ * @brief (cx, cy) chunk की next generation compute करता है, एक fixed preset के लिए
+ *
+ * हमेशा inline होता है; chunk_next हर preset के लिए इसे constant preset
+ * के साथ instantiate करता है।
+ *
+ * @param map current generation का map
+ * @param cx chunk row
+ * @param cy chunk column
+ * @param rules apply करने वाले rules
+ * @param preset rules का preset (constant)
+ * @param counts active neighbor counts की list
+ * @param num_counts list की length
+ * @param out result की rows
+ * @return result की population
+ */
+PACKED_INLINE uint64_t chunk_next_preset(const SparseMap *map, int64_t cx, int64_t cy, const Rules *rules,
+                                         RulesPreset preset, const int *counts, int num_counts,
+                                         uint64_t *out) {
+    // 3x3 neighborhood के chunks की rows (न हो तो खाली)
+    const uint64_t *n[3][3];
+    for (int di = 0; di < 3; di++) {
+        for (int dj = 0; dj < 3; dj++) {
+            const SparseChunk *c = map_find(map, cx + di - 1, cy + dj - 1);
+            n[di][dj] = c ? c->rows : empty_rows;
+        }
+    }
+
+    const size_t last = SPARSE_CHUNK_SIZE - 1;
+    uint64_t population = 0;
+    for (size_t r = 0; r < SPARSE_CHUNK_SIZE; r++) {
+        // ऊपर की row पहली row पर ऊपर वाले chunks की आखिरी row है, नीचे की row उसी तरह
+        const uint64_t *const *up = r == 0 ? n[0] : n[1];
+        const uint64_t *const *down = r == last ? n[2] : n[1];
+        size_t ur = r == 0 ? last : r - 1, dr = r == last ? 0 : r + 1;
+
+        uint64_t next = packed_next_word(up[0][ur], up[1][ur], up[2][ur],
+                                         n[1][0][r], n[1][1][r], n[1][2][r],
+                                         down[0][dr], down[1][dr], down[2][dr],
+                                         preset, counts, num_counts,
+                                         rules->birth_rules, rules->survival_rules);
+        out[r] = next;
+        population += (uint64_t)__builtin_popcountll(next);
+    }
+    return population;
+}
+
+/**
+ * @brief (cx, cy) chunk की next generation compute करता है
+ *
+ * Built-in rule sets (rules->preset) के specialized kernels चुनता है;
+ * बाकी rules generic masks वाले kernel से चलते हैं।
+ *
+ * @param map current generation का map
+ * @param cx chunk row
+ * @param cy chunk column
+ * @param rules apply करने वाले rules
+ * @param counts active neighbor counts की list
+ * @param num_counts list की length
+ * @param out result की rows
+ * @return result की population
+ */
+static uint64_t chunk_next(const SparseMap *map, int64_t cx, int64_t cy, const Rules *rules,
+                           const int *counts, int num_counts, uint64_t *out) {
+    switch (rules->preset) {
+        case RULES_PRESET_CONWAY:
+            return chunk_next_preset(map, cx, cy, rules, RULES_PRESET_CONWAY, counts, num_counts, out);
+        case RULES_PRESET_HIGHLIFE:
+            return chunk_next_preset(map, cx, cy, rules, RULES_PRESET_HIGHLIFE, counts, num_counts, out);
+        case RULES_PRESET_DAY_NIGHT:
+            return chunk_next_preset(map, cx, cy, rules, RULES_PRESET_DAY_NIGHT, counts, num_counts, out);
+        case RULES_PRESET_MAZE:
+            return chunk_next_preset(map, cx, cy, rules, RULES_PRESET_MAZE, counts, num_counts, out);
+        default:
+            return chunk_next_preset(map, cx, cy, rules, RULES_PRESET_NONE, counts, num_counts, out);
+    }
+}
+
+/**
+ * @brief अगली generation compute करता है
+ * @param board current generation (result भी इसी में आता है)
+ * @param rules apply करने वाले rules
+ * @return सफल होने पर 0, NULL pointer, B0 rules या memory allocation fail होने पर -1
+ */
+int sparse_board_next(SparseBoard *board, Rules *rules) {
+    if (board == NULL || rules == NULL) return -1;
+    // B0: खाली chunks भी जीवित हो जाते, plane sparse नहीं रहता
+    if (rules->birth_rules & 1) return -1;
+    // Bit-sliced kernel सिर्फ neighbor counts देखता है
+    if (rules->kernel != RULES_KERNEL_TOTALISTIC) return -1;
+
+    int counts[MAX_NEIGHBORS + 1];
+    int num_counts = packed_active_counts(rules, counts);
+
+    const SparseMap *cur = &board->map;
+    SparseMap *next = &board->scratch;
+    memset(next->slots, 0, next->capacity * sizeof(SparseChunk *));
+    next->count = 0;
+
+    uint64_t rows[SPARSE_CHUNK_SIZE];
+    for (size_t i = 0; i < cur->capacity; i++) {
+        const SparseChunk *chunk = cur->slots[i];
+        if (chunk == NULL) continue;
+
+        uint64_t any = 0;
+        for (size_t r = 0; r < SPARSE_CHUNK_SIZE; r++) any |= chunk->rows[r];
+
+        for (int di = -1; di <= 1; di++) {
+            for (int dj = -1; dj <= 1; dj++) {
+                int64_t cx = chunk->cx + di, cy = chunk->cy + dj;
+                if (di != 0 || dj != 0) {
+                    // मौजूदा neighbor अपनी iteration में compute होगा
+                    if (!chunk_touches(chunk, any, di, dj) || map_find(cur, cx, cy) != NULL) continue;
+                    if (map_find(next, cx, cy) != NULL) continue;
+                }
+
+                uint64_t population = chunk_next(cur, cx, cy, rules, counts, num_counts, rows);
+                if (population == 0) continue;
+
+                SparseChunk *result = chunk_alloc(board, cx, cy);
+                if (result == NULL) goto fail;
+                memcpy(result->rows, rows, sizeof(rows));
+                result->population = population;
+                if (map_insert(next, result) != 0) {
+                    chunk_release(board, result);
+                    goto fail;
+                }
+            }
+        }
+    }
+
+    // पुरानी generation के chunks reuse के लिए free list में
+    map_release_all(board, &board->map);
+
+    SparseMap temp = board->map;
+    board->map = board->scratch;
+    board->scratch = temp;
+    trim_free_list(board);
+    return 0;
+
+fail:
+    // Current generation जैसी थी वैसी रहती है
+    map_release_all(board, next);
+    return -1;
+}
+
+/**
+ * @brief allocated chunks की संख्या
+ * @param board source बोर्ड
+ * @return chunks (NULL होने पर 0)
+ */
+size_t sparse_board_chunk_count(const SparseBoard *board) {
+    return board ? board->map.count : 0;
+}
+
+/**
+ * @brief जीवित cells की संख्या
+ * @param board source बोर्ड
+ * @return population (NULL होने पर 0)
+ */
+uint64_t sparse_board_population(const SparseBoard *board) {
+    if (board == NULL) return 0;
+
+    uint64_t population = 0;
+    for (size_t i = 0; i < board->map.capacity; i++) {
+        if (board->map.slots[i] != NULL) population += board->map.slots[i]->population;
+    }
+    return population;
+}
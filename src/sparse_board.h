@@ -0,0 +1,161 @@
+/**
+ * @file sparse_board.h
+ * @brief Unbounded plane के लिए sparse (chunked) बोर्ड का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Plane SPARSE_CHUNK_SIZE x SPARSE_CHUNK_SIZE cells के chunks में बंटा
+ * है। सिर्फ जीवित cells वाले chunks allocate होते हैं, और उन्हें chunk
+ * coordinates की key वाले hash map (open addressing, linear probing) में
+ * रखा जाता है। Chunk खाली होते ही map से हट जाता है, इसलिए memory
+ * bounding box से नहीं बल्कि population से scale होती है, और gliders व
+ * guns किनारों पर मरने के बजाय plane में आगे बढ़ते रहते हैं।
+ *
+ * Chunk की हर row एक uint64_t है (bit j = chunk का column j), इसलिए
+ * stepping PackedBoard वाले bit-sliced kernel (packed_next_word) से
+ * होती है। Coordinates signed 64-bit हैं; x = row, y = column, जैसे Board
+ * में।
+ */
+
+#ifndef SPARSE_BOARD_H
+#define SPARSE_BOARD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "board.h"
+#include "rules.h"
+
+/**
+ * @brief Chunk की side (cells में); यह एक row का एक word है
+ */
+#define SPARSE_CHUNK_SIZE 64
+
+/**
+ * @brief Cell coordinate से chunk coordinate का shift (log2 SPARSE_CHUNK_SIZE)
+ */
+#define SPARSE_CHUNK_SHIFT 6
+
+/**
+ * @brief Plane का एक chunk
+ */
+typedef struct SparseChunk {
+    int64_t cx;                             /**< Chunk row (cell row >> SPARSE_CHUNK_SHIFT) */
+    int64_t cy;                             /**< Chunk column */
+    uint64_t rows[SPARSE_CHUNK_SIZE];       /**< हर row के cells (bit j = column j) */
+    uint64_t population;                    /**< जीवित cells की संख्या */
+    struct SparseChunk *next_free;          /**< Free list का अगला chunk */
+} SparseChunk;
+
+/**
+ * @brief Chunk coordinates से chunk का hash map
+ */
+typedef struct SparseMap {
+    SparseChunk **slots;        /**< capacity slots (NULL = खाली), capacity 2 की power है */
+    size_t capacity;            /**< Slots की संख्या */
+    size_t count;               /**< Stored chunks */
+} SparseMap;
+
+/**
+ * @brief Unbounded sparse बोर्ड
+ */
+typedef struct SparseBoard {
+    SparseMap map;              /**< Current generation के chunks */
+    SparseMap scratch;          /**< Stepping में next generation का map */
+    SparseChunk *free_chunks;   /**< दोबारा use के लिए खाली chunks */
+    size_t free_count;          /**< Free list की length */
+} SparseBoard;
+
+/**
+ * @brief नया खाली sparse बोर्ड बनाता है
+ * @return सफल होने पर SparseBoard pointer, memory allocation fail होने पर NULL
+ */
+SparseBoard *sparse_board_init(void);
+
+/**
+ * @brief sparse बोर्ड और उसके सभी chunks की memory free करता है
+ * @param board free करने वाला बोर्ड
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int sparse_board_free(SparseBoard *board);
+
+/**
+ * @brief सभी cells मृत करता है (सभी chunks free होते हैं)
+ * @param board clear करने वाला बोर्ड
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int sparse_board_clear(SparseBoard *board);
+
+/**
+ * @brief एक cell की value पढ़ता है
+ * @param board source बोर्ड
+ * @param x row
+ * @param y column
+ * @return cell जीवित है तो 1, वरना 0
+ */
+int sparse_board_get(const SparseBoard *board, int64_t x, int64_t y);
+
+/**
+ * @brief एक cell की value set करता है (जरूरत हो तो chunk allocate या free होता है)
+ * @param board target बोर्ड
+ * @param x row
+ * @param y column
+ * @param alive नई value (0=मृत, non-zero=जीवित)
+ * @return सफल होने पर 0, NULL pointer या memory allocation fail होने पर -1
+ */
+int sparse_board_set(SparseBoard *board, int64_t x, int64_t y, int alive);
+
+/**
+ * @brief Board के cells plane में (x0, y0) से शुरू होने वाली window में लिखता है
+ *
+ * Window के बाहर के cells नहीं बदलते।
+ *
+ * @param dst target sparse बोर्ड
+ * @param src source Board
+ * @param x0 Board की row 0 की plane row
+ * @param y0 Board के column 0 का plane column
+ * @return सफल होने पर 0, NULL pointer या memory allocation fail होने पर -1
+ */
+int sparse_board_from_board(SparseBoard *dst, const Board *src, int64_t x0, int64_t y0);
+
+/**
+ * @brief plane की (x0, y0) से शुरू होने वाली window Board में copy करता है
+ *
+ * सिर्फ window को छूने वाले chunks पढ़े जाते हैं। जिन tiles का content
+ * बदला, सिर्फ वही dirty mark होती हैं।
+ *
+ * @param src source sparse बोर्ड
+ * @param dst target Board
+ * @param x0 Board की row 0 की plane row
+ * @param y0 Board के column 0 का plane column
+ * @return सफल होने पर 0, NULL pointer होने पर -1
+ */
+int sparse_board_to_board(const SparseBoard *src, Board *dst, int64_t x0, int64_t y0);
+
+/**
+ * @brief अगली generation compute करता है
+ *
+ * सिर्फ मौजूदा chunks और उनके वो neighbors compute होते हैं जिनकी तरफ
+ * किनारे पर जीवित cells हैं; खाली हुए chunks free हो जाते हैं।
+ *
+ * @param board current generation (result भी इसी में आता है)
+ * @param rules apply करने वाले rules
+ * @return सफल होने पर 0, NULL pointer, B0 या non-totalistic rules या memory allocation fail होने पर -1
+ */
+int sparse_board_next(SparseBoard *board, Rules *rules);
+
+/**
+ * @brief allocated chunks की संख्या
+ * @param board source बोर्ड
+ * @return chunks (NULL होने पर 0)
+ */
+size_t sparse_board_chunk_count(const SparseBoard *board);
+
+/**
+ * @brief जीवित cells की संख्या
+ * @param board source बोर्ड
+ * @return population (NULL होने पर 0)
+ */
+uint64_t sparse_board_population(const SparseBoard *board);
+
+#endif // SPARSE_BOARD_H
@@ -39,6 +39,13 @@ int state_init(State **state_ptr) {
     (*state_ptr)->current_rule_index = 0;      // Default Conway's rules (index 0)
     (*state_ptr)->is_dragging = false;         // User initially drag नहीं कर रहा
     (*state_ptr)->drag_paint_mode = true;      // Default में alive cells paint करें
+    (*state_ptr)->view_row = 0;                // Viewport बोर्ड के top-left से शुरू
+    (*state_ptr)->view_col = 0;
+    (*state_ptr)->zoom = 1;                    // Window बनाते समय main इसे set करता है
+    (*state_ptr)->window_width = 0;
+    (*state_ptr)->window_height = 0;
+    (*state_ptr)->speed = DEFAULT_SPEED;       // पहले की fixed 20 gen/s जैसी speed
+    (*state_ptr)->needs_redraw = true;         // पहला frame हमेशा draw होता है
     
     return 0;
 }
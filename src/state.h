@@ -29,6 +29,21 @@ typedef uint8_t bool8;
  */
 #define false 0
 
+/**
+ * @brief Maximum zoom level (प्रति cell pixels)
+ */
+#define MAX_ZOOM 64
+
+/**
+ * @brief Default simulation speed (generations प्रति second)
+ */
+#define DEFAULT_SPEED 20
+
+/**
+ * @brief सबसे ज्यादा fixed speed; इससे आगे speed "max" (0) हो जाती है
+ */
+#define MAX_SPEED 65536
+
 /**
  * @brief Game की current state को represent करने वाला structure
  * 
@@ -42,6 +57,13 @@ typedef struct State {
     int current_rule_index;  /**< Current active rule set का index */
     bool8 is_dragging;       /**< User mouse drag कर रहा है या नहीं */
     bool8 drag_paint_mode;   /**< Drag करते समय क्या paint करना है (1=जीवित, 0=मृत) */
+    long view_row;           /**< Viewport की सबसे ऊपर वाली visible row (बोर्ड coordinates) */
+    long view_col;           /**< Viewport का सबसे बायां visible column (बोर्ड coordinates) */
+    int zoom;                /**< Zoom level: प्रति cell pixels (1 से MAX_ZOOM) */
+    int window_width;        /**< Window की चौड़ाई pixels में */
+    int window_height;       /**< Window की ऊंचाई pixels में */
+    long speed;              /**< Generations प्रति second (0 = max: जितनी frame budget में fit हों) */
+    bool8 needs_redraw;      /**< Window expose/resize के बाद अगला frame बोर्ड न बदलने पर भी draw हो */
 } State;
 
 /**
@@ -0,0 +1,291 @@
+/**
+ * @file term.c
+ * @brief Terminal में बोर्ड का downsampled live view (headless monitoring) का implementation
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * Glyph code dots का bit mask है। Braille में bits ठीक Unicode के dot
+ * numbers हैं (U+2800 + code), इसलिए encoding सिर्फ UTF-8 के तीन bytes
+ * है; half blocks में bit 0 ऊपर वाला और bit 1 नीचे वाला आधा है।
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include "term.h"
+
+/**
+ * @brief एक cursor move escape sequence ("ESC[row;colH") के ज्यादा से ज्यादा bytes
+ */
+#define TERM_MOVE_MAX 48
+
+/**
+ * @brief हर glyph के UTF-8 bytes
+ */
+#define TERM_GLYPH_BYTES 3
+
+/**
+ * @brief हर glyph प्रकार के character में dots की rows
+ */
+static const size_t term_dot_rows[2] = { 4, 2 };
+
+/**
+ * @brief हर glyph प्रकार के character में dots के columns
+ */
+static const size_t term_dot_cols[2] = { 2, 1 };
+
+/**
+ * @brief [glyph][dot row][dot column] का code bit
+ */
+static const uint8_t term_bits[2][4][2] = {
+    { { 0x01, 0x08 }, { 0x02, 0x10 }, { 0x04, 0x20 }, { 0x40, 0x80 } },
+    { { 0x01, 0x00 }, { 0x02, 0x00 }, { 0x00, 0x00 }, { 0x00, 0x00 } }
+};
+
+/**
+ * @brief half-block codes के UTF-8 glyphs (space, ▀, ▄, █)
+ */
+static const char term_half_blocks[4][TERM_GLYPH_BYTES + 1] = { " ", "\xe2\x96\x80", "\xe2\x96\x84", "\xe2\x96\x88" };
+
+/**
+ * @brief terminal का size पता करता है
+ *
+ * fd terminal न हो तो LINES/COLUMNS environment variables, और वो भी न हों
+ * तो 24 x 80।
+ *
+ * @param fd terminal का file descriptor
+ * @param rows character rows store करने के लिए pointer
+ * @param cols character columns store करने के लिए pointer
+ * @return सफल होने पर 0, NULL pointer पर -1
+ */
+int term_size(int fd, size_t *rows, size_t *cols) {
+    if (rows == NULL || cols == NULL) return -1;
+
+    struct winsize size;
+    if (ioctl(fd, TIOCGWINSZ, &size) == 0 && size.ws_row > 0 && size.ws_col > 0) {
+        *rows = size.ws_row;
+        *cols = size.ws_col;
+        return 0;
+    }
+
+    const char *lines = getenv("LINES"), *columns = getenv("COLUMNS");
+    long r = lines != NULL ? strtol(lines, NULL, 10) : 0;
+    long c = columns != NULL ? strtol(columns, NULL, 10) : 0;
+    *rows = r > 0 ? (size_t)r : 24;
+    *cols = c > 0 ? (size_t)c : 80;
+    return 0;
+}
+
+/**
+ * @brief बोर्ड size के लिए terminal view बनाता है
+ *
+ * Scale सबसे छोटा s है जिससे बोर्ड rows x cols characters में आ जाए; फिर
+ * view को उस scale पर बोर्ड जितना छोटा कर दिया जाता है।
+ *
+ * @param height बोर्ड की ऊंचाई
+ * @param width बोर्ड की चौड़ाई
+ * @param rows ज्यादा से ज्यादा character rows
+ * @param cols ज्यादा से ज्यादा character columns
+ * @param glyph glyphs का प्रकार
+ * @return सफल होने पर TermView pointer, invalid size या memory allocation fail होने पर NULL
+ */
+TermView *term_view_init(size_t height, size_t width, size_t rows, size_t cols, TermGlyph glyph) {
+    if (height == 0 || width == 0 || rows == 0 || cols == 0) return NULL;
+    if (glyph != TERM_GLYPH_BRAILLE && glyph != TERM_GLYPH_HALF_BLOCK) return NULL;
+
+    size_t dot_rows = term_dot_rows[glyph], dot_cols = term_dot_cols[glyph];
+    size_t scale_rows = (height + rows * dot_rows - 1) / (rows * dot_rows);
+    size_t scale_cols = (width + cols * dot_cols - 1) / (cols * dot_cols);
+    size_t scale = scale_rows > scale_cols ? scale_rows : scale_cols;
+    if (scale == 0) scale = 1;
+
+    TermView *view = calloc(1, sizeof(TermView));
+    if (view == NULL) return NULL;
+
+    view->height = height;
+    view->width = width;
+    view->scale = scale;
+    view->glyph = glyph;
+    view->rows = ((height + scale - 1) / scale + dot_rows - 1) / dot_rows;
+    view->cols = ((width + scale - 1) / scale + dot_cols - 1) / dot_cols;
+
+    // Worst case: हर glyph के पहले cursor move (diff frame) या हर row के पहले (पूरा frame)
+    size_t glyphs = view->rows * view->cols;
+    view->out_size = glyphs * (TERM_MOVE_MAX + TERM_GLYPH_BYTES) + (view->rows + 2) * TERM_MOVE_MAX;
+    view->codes = calloc(glyphs, sizeof(uint8_t));
+    view->next = calloc(glyphs, sizeof(uint8_t));
+    view->out = malloc(view->out_size);
+    if (view->codes == NULL || view->next == NULL || view->out == NULL) {
+        term_view_free(view);
+        return NULL;
+    }
+    return view;
+}
+
+/**
+ * @brief view की memory free करता है
+ * @param view free करने वाला view
+ * @return सफल होने पर 0, NULL pointer पर -1
+ */
+int term_view_free(TermView *view) {
+    if (view == NULL) return -1;
+    free(view->codes);
+    free(view->next);
+    free(view->out);
+    free(view);
+    return 0;
+}
+
+/**
+ * @brief अगला draw फिर से पूरा frame भेजे (screen साफ करके)
+ * @param view view
+ */
+void term_view_reset(TermView *view) {
+    if (view != NULL) view->drawn = 0;
+}
+
+/**
+ * @brief बोर्ड के cells से view->next में glyph codes बनाता है
+ *
+ * हर बोर्ड row एक बार पढ़ी जाती है। जिस dot का bit block की किसी पिछली
+ * row से set हो चुका है, उसका block दोबारा scan नहीं होता।
+ *
+ * @param view view
+ * @param board source बोर्ड
+ */
+static void term_sample(TermView *view, const Board *board) {
+    const size_t scale = view->scale, width = board->width;
+    const size_t dot_rows = term_dot_rows[view->glyph], dot_cols = term_dot_cols[view->glyph];
+    const size_t dots_wide = (width + scale - 1) / scale;
+
+    memset(view->next, 0, view->rows * view->cols);
+    for (size_t x = 0; x < board->height; x++) {
+        const char *row = &board->cells[BOARD_INDEX(board, x, 0)];
+        size_t dot_row = x / scale;
+        uint8_t *codes = &view->next[dot_row / dot_rows * view->cols];
+        const uint8_t *bits = term_bits[view->glyph][dot_row % dot_rows];
+
+        for (size_t d = 0; d < dots_wide; d++) {
+            uint8_t bit = bits[d % dot_cols];
+            uint8_t *code = &codes[d / dot_cols];
+            if (*code & bit) continue;
+
+            size_t end = (d + 1) * scale < width ? (d + 1) * scale : width;
+            for (size_t y = d * scale; y < end; y++) {
+                if (row[y] == 1) {
+                    *code |= bit;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief cursor को (row, col) पर ले जाने वाला escape sequence लिखता है
+ * @param out output position
+ * @param row 0-based character row
+ * @param col 0-based character column
+ * @return sequence के बाद की position
+ */
+static char *term_put_move(char *out, size_t row, size_t col) {
+    return out + sprintf(out, "\x1b[%zu;%zuH", row + 1, col + 1);
+}
+
+/**
+ * @brief एक glyph के UTF-8 bytes लिखता है
+ * @param out output position
+ * @param glyph glyphs का प्रकार
+ * @param code glyph code
+ * @return glyph के बाद की position
+ */
+static char *term_put_glyph(char *out, TermGlyph glyph, uint8_t code) {
+    if (glyph == TERM_GLYPH_HALF_BLOCK) {
+        memcpy(out, term_half_blocks[code & 3], code == 0 ? 1 : TERM_GLYPH_BYTES);
+        return out + (code == 0 ? 1 : TERM_GLYPH_BYTES);
+    }
+    out[0] = (char)0xe2;
+    out[1] = (char)(0xa0 | (code >> 6));
+    out[2] = (char)(0x80 | (code & 0x3f));
+    return out + TERM_GLYPH_BYTES;
+}
+
+/**
+ * @brief बोर्ड का frame fd पर भेजता है (पहली बार पूरा, बाद में सिर्फ बदले characters)
+ *
+ * Diff frame में cursor move तभी लिखा जाता है जब बदला character पिछले
+ * लिखे character के ठीक बाद न हो, इसलिए बदलावों के runs में सिर्फ glyphs
+ * जाते हैं।
+ *
+ * @param view view
+ * @param board बोर्ड (view जितना size)
+ * @param fd output file descriptor
+ * @return सफल होने पर 0, size mismatch या write error पर -1
+ */
+int term_view_draw(TermView *view, const Board *board, int fd) {
+    if (view == NULL || board == NULL) return -1;
+    if (board->height != view->height || board->width != view->width) return -1;
+
+    term_sample(view, board);
+
+    char *out = view->out;
+    if (!view->drawn) {
+        memcpy(out, "\x1b[H\x1b[2J", 7);
+        out += 7;
+        for (size_t r = 0; r < view->rows; r++) {
+            out = term_put_move(out, r, 0);
+            for (size_t c = 0; c < view->cols; c++) {
+                out = term_put_glyph(out, view->glyph, view->next[r * view->cols + c]);
+            }
+        }
+        view->drawn = 1;
+    } else {
+        // Cursor अभी कहाँ है (पिछला लिखा character के बाद); शुरू में अनजान
+        size_t cursor_row = (size_t)-1, cursor_col = 0;
+        for (size_t r = 0; r < view->rows; r++) {
+            const uint8_t *old = &view->codes[r * view->cols], *now = &view->next[r * view->cols];
+            for (size_t c = 0; c < view->cols; c++) {
+                if (old[c] == now[c]) continue;
+                if (r != cursor_row || c != cursor_col) out = term_put_move(out, r, c);
+                out = term_put_glyph(out, view->glyph, now[c]);
+                cursor_row = r;
+                cursor_col = c + 1;
+            }
+        }
+        if (out == view->out) return 0;
+    }
+    out = term_put_move(out, view->rows, 0);
+
+    uint8_t *temp = view->codes;
+    view->codes = view->next;
+    view->next = temp;
+
+    fflush(stdout);
+    return term_write(fd, view->out, (size_t)(out - view->out));
+}
+
+/**
+ * @brief पूरा buffer fd पर लिखता है (partial writes और EINTR पर retry)
+ * @param fd output file descriptor
+ * @param data bytes
+ * @param size bytes की संख्या
+ * @return सफल होने पर 0, write error पर -1
+ */
+int term_write(int fd, const char *data, size_t size) {
+    while (size > 0) {
+        ssize_t written = write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        data += written;
+        size -= (size_t)written;
+    }
+    return 0;
+}
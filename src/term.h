@@ -0,0 +1,114 @@
+/**
+ * @file term.h
+ * @brief Terminal में बोर्ड का downsampled live view (headless monitoring) का हेडर
+ * @author Game of Life Enhanced
+ * @date 2025
+ *
+ * हर terminal character कई cells दिखाता है: braille glyphs (U+2800 block)
+ * में 2x4 dots, half-block glyphs (▀ ▄ █) में 1x2। बोर्ड terminal से बड़ा
+ * हो तो हर dot s x s cells का block है (किसी एक के भी जीवित होने पर dot
+ * जलता है), जहाँ s सबसे छोटा scale है जिससे पूरा बोर्ड view में आ जाए।
+ *
+ * View पिछले frame के glyphs याद रखता है: पहला frame पूरा भेजा जाता है,
+ * उसके बाद सिर्फ बदले हुए characters, ANSI cursor moves के साथ। पूरा
+ * frame एक preallocated buffer में बनता है और एक write() में जाता है,
+ * इसलिए SSH जैसे slow links पर भी हर generation का output छोटा रहता है।
+ */
+
+#ifndef TERM_H
+#define TERM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "board.h"
+
+/**
+ * @brief View के glyphs का प्रकार
+ */
+typedef enum {
+    TERM_GLYPH_BRAILLE = 0,     /**< Braille: 2x4 dots प्रति character */
+    TERM_GLYPH_HALF_BLOCK = 1   /**< Half blocks: 1x2 प्रति character (braille font न हो तो) */
+} TermGlyph;
+
+/**
+ * @brief एक बोर्ड size का terminal view और उसके buffers
+ */
+typedef struct TermView {
+    size_t height;          /**< बोर्ड की ऊंचाई */
+    size_t width;           /**< बोर्ड की चौड़ाई */
+    size_t rows;            /**< View के character rows */
+    size_t cols;            /**< View के character columns */
+    size_t scale;           /**< हर dot कितने cells (s x s) का है */
+    TermGlyph glyph;        /**< Glyphs का प्रकार */
+    uint8_t *codes;         /**< पिछले frame के glyph codes (rows * cols, dots के bits) */
+    uint8_t *next;          /**< नए frame के codes का scratch */
+    char *out;              /**< Escape sequences और glyphs का output buffer */
+    size_t out_size;        /**< out के bytes (worst case frame) */
+    int drawn;              /**< पहला (पूरा) frame भेजा जा चुका है या नहीं */
+} TermView;
+
+/**
+ * @brief terminal का size पता करता है
+ *
+ * fd terminal न हो तो LINES/COLUMNS environment variables, और वो भी न हों
+ * तो 24 x 80।
+ *
+ * @param fd terminal का file descriptor
+ * @param rows character rows store करने के लिए pointer
+ * @param cols character columns store करने के लिए pointer
+ * @return सफल होने पर 0, NULL pointer पर -1
+ */
+int term_size(int fd, size_t *rows, size_t *cols);
+
+/**
+ * @brief बोर्ड size के लिए terminal view बनाता है
+ *
+ * View जरूरत से ज्यादा बड़ा हो तो (scale 1 पर) बोर्ड जितना छोटा हो जाता है।
+ *
+ * @param height बोर्ड की ऊंचाई
+ * @param width बोर्ड की चौड़ाई
+ * @param rows ज्यादा से ज्यादा character rows
+ * @param cols ज्यादा से ज्यादा character columns
+ * @param glyph glyphs का प्रकार
+ * @return सफल होने पर TermView pointer, invalid size या memory allocation fail होने पर NULL
+ */
+TermView *term_view_init(size_t height, size_t width, size_t rows, size_t cols, TermGlyph glyph);
+
+/**
+ * @brief view की memory free करता है
+ * @param view free करने वाला view
+ * @return सफल होने पर 0, NULL pointer पर -1
+ */
+int term_view_free(TermView *view);
+
+/**
+ * @brief अगला draw फिर से पूरा frame भेजे (screen साफ करके)
+ * @param view view
+ */
+void term_view_reset(TermView *view);
+
+/**
+ * @brief बोर्ड का frame fd पर भेजता है (पहली बार पूरा, बाद में सिर्फ बदले characters)
+ *
+ * पहले stdout का stdio buffer flush होता है ताकि printf output से क्रम न
+ * बिगड़े। अंत में cursor view के नीचे रहता है। कुछ न बदला हो तो कुछ नहीं
+ * लिखा जाता।
+ *
+ * @param view view
+ * @param board बोर्ड (view जितना size)
+ * @param fd output file descriptor
+ * @return सफल होने पर 0, size mismatch या write error पर -1
+ */
+int term_view_draw(TermView *view, const Board *board, int fd);
+
+/**
+ * @brief पूरा buffer fd पर लिखता है (partial writes और EINTR पर retry)
+ * @param fd output file descriptor
+ * @param data bytes
+ * @param size bytes की संख्या
+ * @return सफल होने पर 0, write error पर -1
+ */
+int term_write(int fd, const char *data, size_t size);
+
+#endif // TERM_H